@@ -1,15 +1,22 @@
 #include "bench/util/table.hpp"
 #include "test/util/path_util.hpp"
+#include "test/util/task_manager.hpp"
 
 #include "fly/coders/base64/base64_coder.hpp"
 #include "fly/coders/coder_config.hpp"
 #include "fly/coders/huffman/huffman_decoder.hpp"
 #include "fly/coders/huffman/huffman_encoder.hpp"
+#include "fly/coders/lz77/lz77_decoder.hpp"
+#include "fly/coders/lz77/lz77_encoder.hpp"
 #include "fly/fly.hpp"
+#include "fly/task/task_runner.hpp"
 
 #include "catch2/catch_test_macros.hpp"
 
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <string>
 
 namespace {
 
@@ -50,6 +57,150 @@ class Huffman final : public Coder
     fly::coders::HuffmanDecoder m_decoder;
 };
 
+class ConcurrentHuffman final : public Coder
+{
+public:
+    ConcurrentHuffman() :
+        m_encoder(
+            std::make_shared<fly::coders::CoderConfig>(),
+            fly::task::ParallelTaskRunner::create(fly::test::task_manager()))
+    {
+    }
+
+    void encode(std::filesystem::path const &input, std::filesystem::path const &output) final
+    {
+        FLY_UNUSED(m_encoder.encode_file(input, output));
+    }
+
+    void decode(std::filesystem::path const &input, std::filesystem::path const &output) final
+    {
+        FLY_UNUSED(m_decoder.decode_file(input, output));
+    }
+
+private:
+    fly::coders::HuffmanEncoder m_encoder;
+    fly::coders::HuffmanDecoder m_decoder;
+};
+
+class InterleavedHuffman final : public Coder
+{
+public:
+    InterleavedHuffman() :
+        m_encoder(std::make_shared<InterleavedConfig>())
+    {
+    }
+
+    void encode(std::filesystem::path const &input, std::filesystem::path const &output) final
+    {
+        FLY_UNUSED(m_encoder.encode_file(input, output));
+    }
+
+    void decode(std::filesystem::path const &input, std::filesystem::path const &output) final
+    {
+        FLY_UNUSED(m_decoder.decode_file(input, output));
+    }
+
+private:
+    class InterleavedConfig : public fly::coders::CoderConfig
+    {
+    public:
+        InterleavedConfig() noexcept
+        {
+            m_default_huffman_encoder_interleaved_streams = true;
+        }
+    };
+
+    fly::coders::HuffmanEncoder m_encoder;
+    fly::coders::HuffmanDecoder m_decoder;
+};
+
+class AdaptiveHuffman final : public Coder
+{
+public:
+    AdaptiveHuffman() :
+        m_encoder(std::make_shared<AdaptiveConfig>())
+    {
+    }
+
+    void encode(std::filesystem::path const &input, std::filesystem::path const &output) final
+    {
+        FLY_UNUSED(m_encoder.encode_file(input, output));
+    }
+
+    void decode(std::filesystem::path const &input, std::filesystem::path const &output) final
+    {
+        FLY_UNUSED(m_decoder.decode_file(input, output));
+    }
+
+private:
+    class AdaptiveConfig : public fly::coders::CoderConfig
+    {
+    public:
+        AdaptiveConfig() noexcept
+        {
+            m_default_huffman_encoder_adaptive_chunks = true;
+        }
+    };
+
+    fly::coders::HuffmanEncoder m_encoder;
+    fly::coders::HuffmanDecoder m_decoder;
+};
+
+class Lz77 final : public Coder
+{
+public:
+    Lz77() :
+        m_encoder(std::make_shared<fly::coders::CoderConfig>())
+    {
+    }
+
+    void encode(std::filesystem::path const &input, std::filesystem::path const &output) final
+    {
+        FLY_UNUSED(m_encoder.encode_file(input, output));
+    }
+
+    void decode(std::filesystem::path const &input, std::filesystem::path const &output) final
+    {
+        FLY_UNUSED(m_decoder.decode_file(input, output));
+    }
+
+private:
+    fly::coders::Lz77Encoder m_encoder;
+    fly::coders::Lz77Decoder m_decoder;
+};
+
+class Lz77Huffman final : public Coder
+{
+public:
+    Lz77Huffman() :
+        m_encoder(std::make_shared<HuffmanStreamsConfig>())
+    {
+    }
+
+    void encode(std::filesystem::path const &input, std::filesystem::path const &output) final
+    {
+        FLY_UNUSED(m_encoder.encode_file(input, output));
+    }
+
+    void decode(std::filesystem::path const &input, std::filesystem::path const &output) final
+    {
+        FLY_UNUSED(m_decoder.decode_file(input, output));
+    }
+
+private:
+    class HuffmanStreamsConfig : public fly::coders::CoderConfig
+    {
+    public:
+        HuffmanStreamsConfig() noexcept
+        {
+            m_default_lz77_encoder_huffman_streams = true;
+        }
+    };
+
+    fly::coders::Lz77Encoder m_encoder;
+    fly::coders::Lz77Decoder m_decoder;
+};
+
 class Base64 final : public Coder
 {
 public:
@@ -67,6 +218,44 @@ class Base64 final : public Coder
     fly::coders::Base64Coder m_coder;
 };
 
+class Base64Buffers final : public Coder
+{
+public:
+    void encode(std::filesystem::path const &input, std::filesystem::path const &output) final
+    {
+        std::string const decoded = read_file(input);
+        std::string encoded(fly::coders::Base64Coder::encoded_length(decoded.size()), '\0');
+
+        encoded.resize(fly::coders::Base64Coder::encode_into(decoded, encoded.data()));
+        write_file(output, encoded);
+    }
+
+    void decode(std::filesystem::path const &input, std::filesystem::path const &output) final
+    {
+        std::string const encoded = read_file(input);
+        std::string decoded(fly::coders::Base64Coder::max_decoded_length(encoded.size()), '\0');
+
+        if (auto const size = fly::coders::Base64Coder::decode_into(encoded, decoded.data()); size)
+        {
+            decoded.resize(*size);
+            write_file(output, decoded);
+        }
+    }
+
+private:
+    static std::string read_file(std::filesystem::path const &path)
+    {
+        std::ifstream stream(path, std::ios::in | std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(stream), {});
+    }
+
+    static void write_file(std::filesystem::path const &path, std::string const &contents)
+    {
+        std::ofstream stream(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        stream.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    }
+};
+
 template <typename CoderType, typename Encode>
 void run_enwik8_impl(
     CoderTable &table,
@@ -140,5 +329,11 @@ CATCH_TEST_CASE("Coders", "[bench]")
     static auto const file = root / "build" / "data" / "coders" / "enwik8";
 
     run_enwik8_test<Huffman>("Huffman", file);
+    run_enwik8_test<ConcurrentHuffman>("Huffman (concurrent)", file);
+    run_enwik8_test<InterleavedHuffman>("Huffman (interleaved)", file);
+    run_enwik8_test<AdaptiveHuffman>("Huffman (adaptive)", file);
+    run_enwik8_test<Lz77>("LZ77", file);
+    run_enwik8_test<Lz77Huffman>("LZ77 (Huffman)", file);
     run_enwik8_test<Base64>("Base64", file);
+    run_enwik8_test<Base64Buffers>("Base64 (buffers)", file);
 }
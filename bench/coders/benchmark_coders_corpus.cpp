@@ -0,0 +1,598 @@
+#include "bench/util/memory_util.hpp"
+#include "bench/util/table.hpp"
+#include "test/util/task_manager.hpp"
+
+#include "fly/coders/base64/base64_coder.hpp"
+#include "fly/coders/coder.hpp"
+#include "fly/coders/coder_config.hpp"
+#include "fly/coders/container/container_decoder.hpp"
+#include "fly/coders/container/container_encoder.hpp"
+#include "fly/coders/huffman/huffman_decoder.hpp"
+#include "fly/coders/huffman/huffman_encoder.hpp"
+#include "fly/coders/lz77/lz77_decoder.hpp"
+#include "fly/coders/lz77/lz77_encoder.hpp"
+#include "fly/fly.hpp"
+#include "fly/task/task_runner.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using CoderTable = fly::benchmark::
+    Table<std::string, double, double, double, std::int64_t, std::int64_t, double, double>;
+using StageTable = fly::benchmark::Table<std::string, double, double, double, double, double>;
+using ThreadTable = fly::benchmark::Table<std::int64_t, double, double, double, double>;
+
+// Approximate size of each generated corpus.
+constexpr std::size_t s_corpus_size = 8 << 20;
+
+constexpr std::size_t s_iterations = 7;
+constexpr double s_megabyte = 1024.0 * 1024.0;
+
+/**
+ * A corpus of data to encode and decode.
+ */
+struct Corpus
+{
+    std::string m_name;
+    std::string m_contents;
+};
+
+Corpus create_corpus(std::string name, std::function<void(std::string &)> const &generate)
+{
+    Corpus corpus {std::move(name), std::string()};
+
+    corpus.m_contents.reserve(s_corpus_size + (s_corpus_size >> 4));
+    generate(corpus.m_contents);
+
+    return corpus;
+}
+
+// Uniformly random bytes, which cannot be compressed.
+Corpus create_random_corpus(std::mt19937_64 &engine)
+{
+    return create_corpus("Random", [&engine](std::string &contents) {
+        contents.resize(s_corpus_size);
+
+        for (std::size_t i = 0; i < contents.size(); i += sizeof(std::uint64_t))
+        {
+            std::uint64_t const value = engine();
+            std::memcpy(contents.data() + i, &value, sizeof(value));
+        }
+    });
+}
+
+// English-like prose: common words chosen with a Zipf distribution, formed into sentences.
+Corpus create_text_corpus(std::mt19937_64 &engine)
+{
+    return create_corpus("Text", [&engine](std::string &contents) {
+        static constexpr std::array<char const *, 64> s_words {
+            "the",    "of",      "and",    "to",     "a",       "in",     "is",     "that",
+            "for",    "it",      "as",     "was",    "with",    "be",     "by",     "on",
+            "not",    "he",      "this",   "are",    "or",      "his",    "from",   "at",
+            "which",  "but",     "have",   "an",     "had",     "they",   "you",    "were",
+            "their",  "one",     "all",    "we",     "can",     "her",    "has",    "there",
+            "been",   "if",      "more",   "when",   "will",    "would",  "who",    "so",
+            "system", "history", "number", "people", "between", "during", "before", "because",
+            "through", "example", "however", "another", "general", "several", "without", "thought",
+        };
+
+        std::vector<double> weights(s_words.size());
+
+        for (std::size_t i = 0; i < weights.size(); ++i)
+        {
+            weights[i] = 1.0 / static_cast<double>(i + 1);
+        }
+
+        std::discrete_distribution<std::size_t> words(weights.begin(), weights.end());
+        std::uniform_int_distribution<std::size_t> sentence_length(4, 20);
+        std::uniform_int_distribution<std::size_t> paragraph_length(3, 8);
+
+        while (contents.size() < s_corpus_size)
+        {
+            for (std::size_t sentence = paragraph_length(engine); sentence > 0; --sentence)
+            {
+                std::size_t const start = contents.size();
+
+                for (std::size_t word = sentence_length(engine); word > 0; --word)
+                {
+                    contents += s_words[words(engine)];
+                    contents += (word == 1) ? ". " : " ";
+                }
+
+                contents[start] = static_cast<char>(contents[start] - 'a' + 'A');
+            }
+
+            contents.back() = '\n';
+        }
+    });
+}
+
+// Newline-delimited JSON log records, as emitted by a structured logger.
+Corpus create_json_logs_corpus(std::mt19937_64 &engine)
+{
+    return create_corpus("JSON logs", [&engine](std::string &contents) {
+        static constexpr std::array<char const *, 4> s_levels {"DEBUG", "INFO", "WARN", "ERROR"};
+        static constexpr std::array<char const *, 5> s_services {
+            "auth",
+            "billing",
+            "gateway",
+            "search",
+            "storage",
+        };
+        static constexpr std::array<char const *, 6> s_messages {
+            "request completed",
+            "cache miss",
+            "retrying upstream request",
+            "connection reset by peer",
+            "user session refreshed",
+            "query plan cached",
+        };
+
+        std::discrete_distribution<std::size_t> levels {10, 80, 8, 2};
+        std::uniform_int_distribution<std::size_t> services(0, s_services.size() - 1);
+        std::uniform_int_distribution<std::size_t> messages(0, s_messages.size() - 1);
+        std::uniform_int_distribution<std::uint32_t> hosts(1, 16);
+        std::exponential_distribution<double> latency(1.0 / 40.0);
+        std::uniform_int_distribution<std::uint64_t> request_ids;
+
+        std::uint64_t timestamp = 1'792'300'000'000;
+        std::array<char, 17> request_id {};
+
+        while (contents.size() < s_corpus_size)
+        {
+            timestamp += engine() % 50;
+
+            std::snprintf(
+                request_id.data(),
+                request_id.size(),
+                "%016llx",
+                static_cast<unsigned long long>(request_ids(engine)));
+
+            std::size_t const level = levels(engine);
+
+            contents += "{\"timestamp\":" + std::to_string(timestamp);
+            contents += ",\"level\":\"" + std::string(s_levels[level]);
+            contents += "\",\"service\":\"" + std::string(s_services[services(engine)]);
+            contents += "\",\"host\":\"node-" + std::to_string(hosts(engine));
+            contents += "\",\"request_id\":\"" + std::string(request_id.data());
+            contents += "\",\"latency_ms\":" + std::to_string(static_cast<int>(latency(engine)));
+            contents += ",\"status\":" + std::string(level == 3 ? "500" : "200");
+            contents += ",\"message\":\"" + std::string(s_messages[messages(engine)]) + "\"}\n";
+        }
+    });
+}
+
+// Fixed-size binary telemetry records, with slowly changing fields and zero padding.
+Corpus create_binary_corpus(std::mt19937_64 &engine)
+{
+    return create_corpus("Binary", [&engine](std::string &contents) {
+        struct Record
+        {
+            std::uint64_t m_timestamp;
+            std::uint32_t m_sensor;
+            std::uint32_t m_sequence;
+            float m_value;
+            std::uint16_t m_flags;
+            std::array<std::uint8_t, 10> m_reserved;
+        };
+
+        std::uniform_int_distribution<std::uint32_t> sensors(0, 63);
+        std::normal_distribution<float> drift(0.0F, 0.25F);
+        std::bernoulli_distribution flagged(0.01);
+
+        Record record {};
+        record.m_timestamp = 1'792'300'000'000'000;
+        record.m_value = 20.0F;
+
+        while (contents.size() < s_corpus_size)
+        {
+            record.m_timestamp += 1000 + (engine() % 16);
+            record.m_sensor = sensors(engine);
+            record.m_sequence += 1;
+            record.m_value += drift(engine);
+            record.m_flags = flagged(engine) ? 0x8001 : 0;
+
+            contents.append(reinterpret_cast<char const *>(&record), sizeof(record));
+        }
+    });
+}
+
+// Every file in the given directory, so that coders may be evaluated against real-world data.
+std::vector<Corpus> read_corpus_directory(std::filesystem::path const &directory)
+{
+    std::vector<Corpus> corpora;
+    std::error_code error;
+
+    for (auto const &entry : std::filesystem::directory_iterator(directory, error))
+    {
+        if (entry.is_regular_file())
+        {
+            std::ifstream stream(entry.path(), std::ios::in | std::ios::binary);
+            std::string contents(std::istreambuf_iterator<char>(stream), {});
+
+            corpora.push_back({entry.path().filename().string(), std::move(contents)});
+        }
+    }
+
+    std::sort(corpora.begin(), corpora.end(), [](Corpus const &left, Corpus const &right) {
+        return left.m_name < right.m_name;
+    });
+
+    return corpora;
+}
+
+class InterleavedConfig : public fly::coders::CoderConfig
+{
+public:
+    InterleavedConfig() noexcept
+    {
+        m_default_huffman_encoder_interleaved_streams = true;
+    }
+};
+
+class AdaptiveConfig : public fly::coders::CoderConfig
+{
+public:
+    AdaptiveConfig() noexcept
+    {
+        m_default_huffman_encoder_adaptive_chunks = true;
+    }
+};
+
+class HuffmanStreamsConfig : public fly::coders::CoderConfig
+{
+public:
+    HuffmanStreamsConfig() noexcept
+    {
+        m_default_lz77_encoder_huffman_streams = true;
+    }
+};
+
+/**
+ * A coder to benchmark, created anew for each corpus.
+ */
+struct CoderVariant
+{
+    std::string m_name;
+    std::function<std::unique_ptr<fly::coders::Encoder>()> m_create_encoder;
+    std::function<std::unique_ptr<fly::coders::Decoder>()> m_create_decoder;
+};
+
+std::vector<CoderVariant> create_variants(std::shared_ptr<fly::task::TaskRunner> task_runner)
+{
+    auto config = std::make_shared<fly::coders::CoderConfig>();
+
+    auto huffman_decoder = []() {
+        return std::make_unique<fly::coders::HuffmanDecoder>();
+    };
+
+    return {
+        {"Huffman",
+         [config]() { return std::make_unique<fly::coders::HuffmanEncoder>(config); },
+         huffman_decoder},
+        {"Huffman (concurrent)",
+         [config, task_runner]() {
+             return std::make_unique<fly::coders::HuffmanEncoder>(config, task_runner);
+         },
+         huffman_decoder},
+        {"Huffman (interleaved)",
+         []() {
+             return std::make_unique<fly::coders::HuffmanEncoder>(
+                 std::make_shared<InterleavedConfig>());
+         },
+         huffman_decoder},
+        {"Huffman (adaptive)",
+         []() {
+             return std::make_unique<fly::coders::HuffmanEncoder>(
+                 std::make_shared<AdaptiveConfig>());
+         },
+         huffman_decoder},
+        {"LZ77",
+         [config]() { return std::make_unique<fly::coders::Lz77Encoder>(config); },
+         []() { return std::make_unique<fly::coders::Lz77Decoder>(); }},
+        {"LZ77 (Huffman)",
+         []() {
+             return std::make_unique<fly::coders::Lz77Encoder>(
+                 std::make_shared<HuffmanStreamsConfig>());
+         },
+         []() { return std::make_unique<fly::coders::Lz77Decoder>(); }},
+        {"Container (Huffman)",
+         [config]() {
+             return std::make_unique<fly::coders::ContainerEncoder>(
+                 config,
+                 std::make_unique<fly::coders::HuffmanEncoder>(config));
+         },
+         []() {
+             return std::make_unique<fly::coders::ContainerDecoder>(
+                 std::make_unique<fly::coders::HuffmanDecoder>());
+         }},
+        {"Base64",
+         []() { return std::make_unique<fly::coders::Base64Coder>(); },
+         []() { return std::make_unique<fly::coders::Base64Coder>(); }},
+    };
+}
+
+/**
+ * Heap usage of a single invocation of an operation.
+ */
+struct MemoryUsage
+{
+    std::int64_t m_allocations {0};
+    double m_peak_heap_size {0};
+};
+
+template <typename Callable>
+double median_duration(std::size_t iterations, Callable callable)
+{
+    std::vector<double> results;
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        callable();
+        auto const end = std::chrono::steady_clock::now();
+
+        auto const duration = std::chrono::duration<double>(end - start);
+        results.push_back(duration.count());
+    }
+
+    std::sort(results.rbegin(), results.rend());
+    return results[iterations / 2];
+}
+
+template <typename Callable>
+MemoryUsage measure_memory(Callable callable)
+{
+    auto const allocations = fly::benchmark::MemoryUtil::allocations();
+    auto const heap_size = fly::benchmark::MemoryUtil::heap_size();
+
+    fly::benchmark::MemoryUtil::reset_peak_heap_size();
+    callable();
+
+    return {
+        static_cast<std::int64_t>(fly::benchmark::MemoryUtil::allocations() - allocations),
+        static_cast<double>(fly::benchmark::MemoryUtil::peak_heap_size() - heap_size) /
+            s_megabyte};
+}
+
+double to_milliseconds(std::chrono::nanoseconds duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+void run_corpus(Corpus const &corpus, std::vector<CoderVariant> const &variants)
+{
+    double const size = static_cast<double>(corpus.m_contents.size()) / s_megabyte;
+    auto const input = std::as_bytes(std::span(corpus.m_contents));
+
+    CoderTable table(
+        "Coders: " + corpus.m_name + " (" + std::to_string(corpus.m_contents.size() >> 10) +
+            " KB)",
+        {"Coder",
+         "Ratio (%)",
+         "Encode (MB/s)",
+         "Decode (MB/s)",
+         "Encode allocs",
+         "Decode allocs",
+         "Encode peak (MB)",
+         "Decode peak (MB)"});
+
+    StageTable stage_table(
+        "Huffman encoder stages: " + corpus.m_name,
+        {"Coder", "Histogram (ms)", "Tree (ms)", "Emission (ms)", "Bit I/O (ms)", "Wall (ms)"});
+
+    for (auto const &variant : variants)
+    {
+        auto encoder = variant.m_create_encoder();
+        auto decoder = variant.m_create_decoder();
+
+        std::vector<std::byte> encoded, decoded;
+        bool successful = true;
+
+        auto encode = [&]() {
+            successful &= encoder->encode_buffer(input, encoded);
+        };
+        auto decode = [&]() {
+            successful &= decoder->decode_buffer(std::span(encoded), decoded);
+        };
+
+        // Memory usage is measured before the output buffers are first allocated, so that the peak
+        // heap size includes the output buffers. Throughput is then measured reusing the buffers.
+        auto const encode_memory = measure_memory(encode);
+        auto const encode_duration = median_duration(s_iterations, encode);
+
+        auto const decode_memory = measure_memory(decode);
+        auto const decode_duration = median_duration(s_iterations, decode);
+
+        CATCH_CHECK(successful);
+        CATCH_CHECK(std::ranges::equal(decoded, input));
+
+        table.append_row(
+            variant.m_name,
+            static_cast<double>(encoded.size()) * 100.0 / static_cast<double>(input.size()),
+            size / encode_duration,
+            size / decode_duration,
+            encode_memory.m_allocations,
+            decode_memory.m_allocations,
+            encode_memory.m_peak_heap_size,
+            decode_memory.m_peak_heap_size);
+
+        // Huffman encoders are timed again with stage timing, so that reading the clock does not
+        // perturb the throughput above. Stage durations accumulate, so each is averaged.
+        if (auto *huffman = dynamic_cast<fly::coders::HuffmanEncoder *>(encoder.get()); huffman)
+        {
+            huffman->set_stage_timing(true);
+
+            auto const start = std::chrono::steady_clock::now();
+
+            for (std::size_t i = 0; i < s_iterations; ++i)
+            {
+                encode();
+            }
+
+            auto const duration = std::chrono::steady_clock::now() - start;
+            auto const &stages = huffman->stage_durations();
+
+            auto average = [](std::chrono::nanoseconds stage) {
+                return to_milliseconds(stage) / static_cast<double>(s_iterations);
+            };
+
+            stage_table.append_row(
+                variant.m_name,
+                average(stages.m_histogram),
+                average(stages.m_tree),
+                average(stages.m_emission),
+                average(stages.m_bit_io),
+                average(std::chrono::duration_cast<std::chrono::nanoseconds>(duration)));
+        }
+    }
+
+    std::cout << table << '\n';
+    std::cout << stage_table << '\n';
+}
+
+/**
+ * Encode and decode a corpus on a number of threads at once, with a separate Huffman encoder and
+ * decoder per thread. Returns the median durations of encoding and decoding.
+ */
+std::pair<double, double> run_threads(Corpus const &corpus, std::size_t threads)
+{
+    auto const config = std::make_shared<fly::coders::CoderConfig>();
+    auto const input = std::as_bytes(std::span(corpus.m_contents));
+
+    std::vector<std::unique_ptr<fly::coders::HuffmanEncoder>> encoders;
+    std::vector<std::unique_ptr<fly::coders::HuffmanDecoder>> decoders;
+    std::vector<std::vector<std::byte>> encoded(threads), decoded(threads);
+
+    for (std::size_t i = 0; i < threads; ++i)
+    {
+        encoders.push_back(std::make_unique<fly::coders::HuffmanEncoder>(config));
+        decoders.push_back(std::make_unique<fly::coders::HuffmanDecoder>());
+    }
+
+    auto run = [threads](auto const &work) {
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+
+        for (std::size_t i = 0; i < threads; ++i)
+        {
+            workers.emplace_back(work, i);
+        }
+
+        for (auto &worker : workers)
+        {
+            worker.join();
+        }
+    };
+
+    auto const encode_duration = median_duration(s_iterations, [&]() {
+        run([&](std::size_t i) { FLY_UNUSED(encoders[i]->encode_buffer(input, encoded[i])); });
+    });
+
+    auto const decode_duration = median_duration(s_iterations, [&]() {
+        run([&](std::size_t i) {
+            FLY_UNUSED(decoders[i]->decode_buffer(std::span(encoded[i]), decoded[i]));
+        });
+    });
+
+    for (auto const &output : decoded)
+    {
+        CATCH_CHECK(std::ranges::equal(output, input));
+    }
+
+    return {encode_duration, decode_duration};
+}
+
+} // namespace
+
+CATCH_TEST_CASE("Coders Corpus", "[bench]")
+{
+    static auto const root =
+        std::filesystem::path(__FILE__).parent_path().parent_path().parent_path();
+    static auto const directory = root / "build" / "data" / "coders" / "corpus";
+
+    std::mt19937_64 engine(0x5eed);
+
+    auto const task_runner = fly::task::ParallelTaskRunner::create(fly::test::task_manager());
+    auto const variants = create_variants(task_runner);
+
+    // Corpora are generated one at a time, so that the process does not hold all of them at once.
+    std::vector<std::function<Corpus()>> const generators {
+        [&engine]() { return create_random_corpus(engine); },
+        [&engine]() { return create_text_corpus(engine); },
+        [&engine]() { return create_json_logs_corpus(engine); },
+        [&engine]() { return create_binary_corpus(engine); },
+    };
+
+    for (auto const &generator : generators)
+    {
+        run_corpus(generator(), variants);
+    }
+
+    for (auto const &corpus : read_corpus_directory(directory))
+    {
+        run_corpus(corpus, variants);
+    }
+
+    Corpus const corpus = create_json_logs_corpus(engine);
+    double const size = static_cast<double>(corpus.m_contents.size()) / s_megabyte;
+
+    ThreadTable thread_table(
+        "Huffman (one coder per thread): " + corpus.m_name,
+        {"Threads", "Encode (MB/s)", "Encode speedup", "Decode (MB/s)", "Decode speedup"});
+
+    std::size_t const max_threads = std::max(std::thread::hardware_concurrency(), 1U);
+    std::vector<std::size_t> thread_counts;
+
+    for (std::size_t threads = 1; threads < max_threads; threads *= 2)
+    {
+        thread_counts.push_back(threads);
+    }
+
+    thread_counts.push_back(max_threads);
+
+    double encode_baseline = 0.0, decode_baseline = 0.0;
+
+    for (std::size_t threads : thread_counts)
+    {
+        auto const [encode_duration, decode_duration] = run_threads(corpus, threads);
+
+        double const encode_speed = static_cast<double>(threads) * size / encode_duration;
+        double const decode_speed = static_cast<double>(threads) * size / decode_duration;
+
+        if (threads == 1)
+        {
+            encode_baseline = encode_speed;
+            decode_baseline = decode_speed;
+        }
+
+        thread_table.append_row(
+            static_cast<std::int64_t>(threads),
+            encode_speed,
+            encode_speed / encode_baseline,
+            decode_speed,
+            decode_speed / decode_baseline);
+    }
+
+    std::cout << thread_table << '\n';
+}
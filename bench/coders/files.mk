@@ -1,2 +1,3 @@
 SRC_$(d) := \
-    $(d)/benchmark_coders.cpp
+    $(d)/benchmark_coders.cpp \
+    $(d)/benchmark_coders_corpus.cpp
@@ -3,6 +3,7 @@ include $(SOURCE_ROOT)/extern/catchorg/flags.mk
 SRC_DIRS_$(d) += \
     $(d)/coders \
     $(d)/json \
+    $(d)/parser \
     $(d)/string \
     $(d)/util \
     $(d)/../test/util
@@ -0,0 +1,207 @@
+#include "bench/util/table.hpp"
+
+#include "fly/fly.hpp"
+#include "fly/parser/json_parser.hpp"
+#include "fly/types/json/json.hpp"
+#include "fly/types/json/json_binder.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using BinderTable = fly::benchmark::Table<std::string, double, double, double>;
+
+struct Location
+{
+    double latitude {0.0};
+    double longitude {0.0};
+};
+
+struct Record
+{
+    std::uint64_t id {0};
+    std::string name;
+    std::int32_t score {0};
+    bool active {false};
+    std::vector<std::string> tags;
+    Location location;
+};
+
+struct Document
+{
+    std::vector<Record> records;
+};
+
+} // namespace
+
+template <>
+struct fly::JsonFields<Location>
+{
+    static constexpr auto fields = std::make_tuple(
+        fly::json_field("latitude", &Location::latitude),
+        fly::json_field("longitude", &Location::longitude));
+};
+
+template <>
+struct fly::JsonFields<Record>
+{
+    static constexpr auto fields = std::make_tuple(
+        fly::json_field("id", &Record::id),
+        fly::json_field("name", &Record::name),
+        fly::json_field("score", &Record::score),
+        fly::json_field("active", &Record::active),
+        fly::json_field("tags", &Record::tags),
+        fly::json_field("location", &Record::location));
+};
+
+template <>
+struct fly::JsonFields<Document>
+{
+    static constexpr auto fields = std::make_tuple(fly::json_field("records", &Document::records));
+};
+
+namespace {
+
+Document create_document(std::size_t size)
+{
+    std::mt19937 engine(0);
+    std::uniform_int_distribution<std::int32_t> integers(-100'000, 100'000);
+    std::uniform_real_distribution<double> reals(-180.0, 180.0);
+
+    Document document;
+    document.records.reserve(size);
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        Record record;
+        record.id = i;
+        record.name = "record_" + std::to_string(integers(engine));
+        record.score = integers(engine);
+        record.active = (i % 2) == 0;
+        record.tags = {"tag_" + std::to_string(i % 7), "tag_" + std::to_string(i % 13)};
+        record.location = {reals(engine), reals(engine)};
+
+        document.records.push_back(std::move(record));
+    }
+
+    return document;
+}
+
+// Parse the document into a Json instance, then convert each value into the structure.
+Document decode_with_dom(fly::parser::JsonParser &parser, std::string const &contents)
+{
+    fly::Json const json = *parser.parse_string(contents);
+    Document document;
+
+    for (auto const &value : json["records"])
+    {
+        Record record;
+        record.id = static_cast<std::uint64_t>(value["id"]);
+        record.name = static_cast<std::string>(value["name"]);
+        record.score = static_cast<std::int32_t>(value["score"]);
+        record.active = static_cast<bool>(value["active"]);
+        record.tags = static_cast<std::vector<std::string>>(value["tags"]);
+        record.location.latitude = static_cast<double>(value["location"]["latitude"]);
+        record.location.longitude = static_cast<double>(value["location"]["longitude"]);
+
+        document.records.push_back(std::move(record));
+    }
+
+    return document;
+}
+
+// Convert the structure into a Json instance, then serialize the Json instance.
+std::string encode_with_dom(Document const &document)
+{
+    fly::Json records = fly::json_array_type();
+
+    for (auto const &record : document.records)
+    {
+        records.push_back({
+            {"id", record.id},
+            {"name", record.name},
+            {"score", record.score},
+            {"active", record.active},
+            {"tags", record.tags},
+            {"location",
+             {{"latitude", record.location.latitude},
+              {"longitude", record.location.longitude}}},
+        });
+    }
+
+    fly::Json const json = {{"records", std::move(records)}};
+    return json.serialize();
+}
+
+template <typename Callable>
+double median_duration(std::size_t iterations, Callable callable)
+{
+    std::vector<double> results;
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        callable();
+        auto const end = std::chrono::steady_clock::now();
+
+        auto const duration = std::chrono::duration<double>(end - start);
+        results.push_back(duration.count());
+    }
+
+    std::sort(results.rbegin(), results.rend());
+    return results[iterations / 2];
+}
+
+} // namespace
+
+CATCH_TEST_CASE("JSON Binder", "[bench]")
+{
+    static constexpr std::size_t s_iterations = 11;
+    static constexpr std::size_t s_records = 50'000;
+
+    Document const document = create_document(s_records);
+    std::string const contents = fly::JsonBinder::encode(document);
+
+    BinderTable table(
+        "JSON binding: " + std::to_string(s_records) + " records",
+        {"Method", "Decode (ms)", "Encode (ms)", "Speed (MB/s)"});
+
+    auto append_row = [&table, &contents](std::string name, double decode, double encode) {
+        auto const speed = contents.size() / (decode + encode) / 1024.0 / 1024.0;
+        table.append_row(std::move(name), decode * 1000, encode * 1000, speed);
+    };
+
+    {
+        fly::parser::JsonParser parser;
+
+        auto const decode_duration = median_duration(s_iterations, [&]() {
+            FLY_UNUSED(decode_with_dom(parser, contents));
+        });
+        auto const encode_duration = median_duration(s_iterations, [&]() {
+            FLY_UNUSED(encode_with_dom(document));
+        });
+
+        append_row("libfly (dom)", decode_duration, encode_duration);
+    }
+
+    {
+        auto const decode_duration = median_duration(s_iterations, [&]() {
+            FLY_UNUSED(fly::JsonBinder::decode<Document>(contents));
+        });
+        auto const encode_duration = median_duration(s_iterations, [&]() {
+            FLY_UNUSED(fly::JsonBinder::encode(document));
+        });
+
+        append_row("libfly (binder)", decode_duration, encode_duration);
+    }
+
+    std::cout << table << '\n';
+}
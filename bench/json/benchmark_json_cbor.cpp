@@ -0,0 +1,285 @@
+#include "bench/util/table.hpp"
+#include "test/util/path_util.hpp"
+
+#include "fly/fly.hpp"
+#include "fly/parser/json_parser.hpp"
+#include "fly/types/json/json.hpp"
+#include "fly/types/json/json_cbor.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+#include "nlohmann/json.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+using CborTable = fly::benchmark::Table<std::string, double, double, double, double>;
+
+class JsonRoundTripBase
+{
+public:
+    virtual ~JsonRoundTripBase() = default;
+
+    // Load the document into the library's in-memory representation.
+    virtual void load(std::string const &contents) = 0;
+
+    // Encode the in-memory document, returning the size of the encoded bytes.
+    virtual std::size_t encode() = 0;
+
+    // Decode the most recently encoded bytes.
+    virtual void decode() = 0;
+};
+
+// libfly - https://github.com/trflynn89/libfly (JSON text)
+class LibflyTextRoundTrip : public JsonRoundTripBase
+{
+public:
+    void load(std::string const &contents) override
+    {
+        m_json = *m_parser.parse_string(contents);
+    }
+
+    std::size_t encode() override
+    {
+        m_encoded = m_json.serialize();
+        return m_encoded.size();
+    }
+
+    void decode() override
+    {
+        FLY_UNUSED(m_parser.parse_string(m_encoded));
+    }
+
+private:
+    fly::parser::JsonParser m_parser;
+    fly::Json m_json;
+    std::string m_encoded;
+};
+
+// libfly - https://github.com/trflynn89/libfly (CBOR)
+class LibflyCborRoundTrip : public JsonRoundTripBase
+{
+public:
+    void load(std::string const &contents) override
+    {
+        m_json = *fly::parser::JsonParser().parse_string(contents);
+    }
+
+    std::size_t encode() override
+    {
+        m_encoded = fly::JsonCbor::encode(m_json);
+        return m_encoded.size();
+    }
+
+    void decode() override
+    {
+        FLY_UNUSED(fly::JsonCbor::decode(m_encoded));
+    }
+
+private:
+    fly::Json m_json;
+    std::string m_encoded;
+};
+
+// libfly - https://github.com/trflynn89/libfly (CBOR, streamed and visited without allocation)
+class LibflyCborStreamRoundTrip : public JsonRoundTripBase
+{
+public:
+    void load(std::string const &contents) override
+    {
+        m_json = *fly::parser::JsonParser().parse_string(contents);
+    }
+
+    std::size_t encode() override
+    {
+        m_stream.str(std::string());
+        fly::JsonCbor::encode(m_json, m_stream);
+
+        m_encoded = std::move(m_stream).str();
+        return m_encoded.size();
+    }
+
+    void decode() override
+    {
+        FLY_UNUSED(fly::JsonCbor::visit(m_encoded, m_visitor));
+    }
+
+private:
+    class CountingVisitor : public fly::JsonCbor::Visitor
+    {
+    public:
+        void on_null() override
+        {
+            ++m_values;
+        }
+
+        void on_boolean(fly::json_boolean_type) override
+        {
+            ++m_values;
+        }
+
+        void on_signed_integer(fly::json_signed_integer_type) override
+        {
+            ++m_values;
+        }
+
+        void on_unsigned_integer(fly::json_unsigned_integer_type) override
+        {
+            ++m_values;
+        }
+
+        void on_floating_point(fly::json_floating_point_type) override
+        {
+            ++m_values;
+        }
+
+        void on_string(std::string_view value) override
+        {
+            m_values += value.size();
+        }
+
+        void on_array_start(std::optional<std::size_t>) override
+        {
+            ++m_values;
+        }
+
+        void on_array_end() override
+        {
+        }
+
+        void on_object_start(std::optional<std::size_t>) override
+        {
+            ++m_values;
+        }
+
+        void on_object_key(std::string_view key) override
+        {
+            m_values += key.size();
+        }
+
+        void on_object_end() override
+        {
+        }
+
+    private:
+        std::size_t m_values {0};
+    };
+
+    fly::Json m_json;
+    std::ostringstream m_stream;
+    std::string m_encoded;
+    CountingVisitor m_visitor;
+};
+
+// JSON for Modern C++ - https://github.com/nlohmann/json (CBOR)
+class NLohmannCborRoundTrip : public JsonRoundTripBase
+{
+public:
+    void load(std::string const &contents) override
+    {
+        m_json = nlohmann::json::parse(contents);
+    }
+
+    std::size_t encode() override
+    {
+        m_encoded = nlohmann::json::to_cbor(m_json);
+        return m_encoded.size();
+    }
+
+    void decode() override
+    {
+        auto ignored = nlohmann::json::from_cbor(m_encoded);
+        FLY_UNUSED(ignored);
+    }
+
+private:
+    nlohmann::json m_json;
+    std::vector<std::uint8_t> m_encoded;
+};
+
+template <typename Callable>
+double median_duration(std::size_t iterations, Callable callable)
+{
+    std::vector<double> results;
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        callable();
+        auto const end = std::chrono::steady_clock::now();
+
+        auto const duration = std::chrono::duration<double>(end - start);
+        results.push_back(duration.count());
+    }
+
+    std::sort(results.rbegin(), results.rend());
+    return results[iterations / 2];
+}
+
+} // namespace
+
+CATCH_TEST_CASE("JSON CBOR", "[bench]")
+{
+    static constexpr std::size_t s_iterations = 11;
+
+    static auto const root =
+        std::filesystem::path(__FILE__).parent_path().parent_path().parent_path();
+
+    static std::vector<std::filesystem::path> s_test_files {
+        root / "build" / "data" / "json" / "all_unicode.json",
+        root / "build" / "data" / "json" / "canada.json",
+    };
+
+    std::map<std::string, std::unique_ptr<JsonRoundTripBase>> round_trips;
+#if !defined(FLY_PROFILE)
+    round_trips.emplace("libfly (text)", std::make_unique<LibflyTextRoundTrip>());
+    round_trips.emplace("nlohmann (cbor)", std::make_unique<NLohmannCborRoundTrip>());
+#endif
+    round_trips.emplace("libfly (cbor)", std::make_unique<LibflyCborRoundTrip>());
+    round_trips.emplace("libfly (cbor visit)", std::make_unique<LibflyCborStreamRoundTrip>());
+
+    for (auto const &file : s_test_files)
+    {
+        std::string const contents = fly::test::PathUtil::read_file(file);
+
+        CborTable table(
+            "JSON round trip: " + file.filename().string(),
+            {"Format", "Encode (ms)", "Decode (ms)", "Speed (MB/s)", "Size (KB)"});
+
+        for (auto &round_trip : round_trips)
+        {
+            round_trip.second->load(contents);
+            std::size_t size = 0;
+
+            auto const encode_duration = median_duration(s_iterations, [&]() {
+                size = round_trip.second->encode();
+            });
+            auto const decode_duration = median_duration(s_iterations, [&]() {
+                round_trip.second->decode();
+            });
+
+            auto const duration = encode_duration + decode_duration;
+            auto const speed = contents.size() / duration / 1024.0 / 1024.0;
+
+            table.append_row(
+                round_trip.first,
+                encode_duration * 1000,
+                decode_duration * 1000,
+                speed,
+                size / 1024.0);
+        }
+
+        std::cout << table << '\n';
+    }
+}
@@ -0,0 +1,318 @@
+#include "bench/util/memory_util.hpp"
+#include "bench/util/table.hpp"
+
+#include "fly/fly.hpp"
+#include "fly/parser/json_parser.hpp"
+#include "fly/types/json/json.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using CorpusTable =
+    fly::benchmark::Table<std::string, double, double, double, double, double, double>;
+
+// Approximate size of each generated document.
+constexpr std::size_t s_document_size = 4 << 20;
+
+/**
+ * A generated document. Newline-delimited documents are parsed and serialized one line at a time.
+ */
+struct Document
+{
+    std::string m_name;
+    std::vector<std::string> m_lines;
+    std::size_t m_size {0};
+};
+
+Document create_document(std::string name, std::function<void(std::string &)> const &generate)
+{
+    Document document {std::move(name), {std::string()}, 0};
+    std::string &contents = document.m_lines.front();
+
+    contents.reserve(s_document_size + (s_document_size >> 4));
+    generate(contents);
+
+    document.m_size = contents.size();
+    return document;
+}
+
+// An array of objects, each nested 128 levels deep with alternating objects and arrays.
+Document create_deeply_nested_document()
+{
+    return create_document("Deep nesting", [](std::string &contents) {
+        static constexpr std::size_t s_depth = 128;
+        contents += '[';
+
+        while (contents.size() < s_document_size)
+        {
+            for (std::size_t i = 0; i < s_depth; ++i)
+            {
+                contents += ((i % 2) == 0) ? "{\"level\":" : "[";
+            }
+
+            contents += "null";
+
+            for (std::size_t i = s_depth; i > 0; --i)
+            {
+                contents += (((i - 1) % 2) == 0) ? '}' : ']';
+            }
+
+            contents += ',';
+        }
+
+        contents.back() = ']';
+    });
+}
+
+// An array of many small objects with short keys and values of mixed types.
+Document create_small_objects_document(std::mt19937 &engine)
+{
+    return create_document("Small objects", [&engine](std::string &contents) {
+        std::uniform_int_distribution<std::uint32_t> distribution(0, 100'000);
+        contents += '[';
+
+        while (contents.size() < s_document_size)
+        {
+            auto const id = distribution(engine);
+
+            contents += "{\"id\":" + std::to_string(id);
+            contents += ",\"ok\":" + std::string((id % 2) == 0 ? "true" : "false");
+            contents += ",\"tag\":\"t" + std::to_string(id % 16) + "\"},";
+        }
+
+        contents.back() = ']';
+    });
+}
+
+// An array of long strings containing occasional escaped characters and non-ASCII codepoints.
+Document create_long_strings_document(std::mt19937 &engine)
+{
+    return create_document("Long strings", [&engine](std::string &contents) {
+        static constexpr std::size_t s_string_size = 4 << 10;
+
+        std::uniform_int_distribution<std::uint32_t> distribution(0, 63);
+        contents += '[';
+
+        while (contents.size() < s_document_size)
+        {
+            contents += '"';
+
+            for (std::size_t i = 0; i < s_string_size; ++i)
+            {
+                switch (auto const value = distribution(engine); value)
+                {
+                    case 0:
+                        contents += "\\n";
+                        break;
+                    case 1:
+                        contents += "\\\"";
+                        break;
+                    case 2:
+                        contents += "\\u00e9";
+                        break;
+                    case 3:
+                        contents += "\xe2\x82\xac";
+                        break;
+                    default:
+                        contents += static_cast<char>('a' + (value % 26));
+                        break;
+                }
+            }
+
+            contents += "\",";
+        }
+
+        contents.back() = ']';
+    });
+}
+
+// An array of arrays of signed integers, unsigned integers, and floating-point values.
+Document create_number_heavy_document(std::mt19937 &engine)
+{
+    return create_document("Numbers", [&engine](std::string &contents) {
+        std::uniform_int_distribution<std::int64_t> integers(-1'000'000'000, 1'000'000'000);
+        std::uniform_real_distribution<double> reals(-1e6, 1e6);
+
+        contents += '[';
+
+        while (contents.size() < s_document_size)
+        {
+            contents += '[';
+            contents += std::to_string(integers(engine)) + ',';
+            contents += std::to_string(static_cast<std::uint64_t>(integers(engine)) << 20) + ',';
+            contents += std::to_string(reals(engine)) + ',';
+            contents += std::to_string(reals(engine) / 1e3) + "e-12";
+            contents += "],";
+        }
+
+        contents.back() = ']';
+    });
+}
+
+// An array of small objects, pretty-printed with deep indentation and blank lines.
+Document create_whitespace_heavy_document(std::mt19937 &engine)
+{
+    return create_document("Whitespace", [&engine](std::string &contents) {
+        std::uniform_int_distribution<std::uint32_t> distribution(0, 100'000);
+        std::string const indent(16, ' ');
+
+        contents += "[\n";
+
+        while (contents.size() < s_document_size)
+        {
+            contents += indent + "{\n\n";
+            contents += indent + indent + "\"id\"   :   " + std::to_string(distribution(engine));
+            contents += " ,\r\n\t\t" + indent + indent + "\"name\"\t:\t\"value\"\n";
+            contents += indent + "}  ,\n\n";
+        }
+
+        contents.resize(contents.rfind(','));
+        contents += "\n]\n";
+    });
+}
+
+// Newline-delimited JSON: one small, independent object per line.
+Document create_ndjson_document(std::mt19937 &engine)
+{
+    std::uniform_int_distribution<std::uint32_t> distribution(0, 100'000);
+    Document document {"NDJSON", {}, 0};
+
+    while (document.m_size < s_document_size)
+    {
+        auto const id = distribution(engine);
+
+        std::string line = "{\"event\":\"click\",\"id\":" + std::to_string(id);
+        line += ",\"tags\":[\"a\",\"b\"],\"meta\":{\"x\":" + std::to_string(id % 1024) + "}}";
+
+        document.m_size += line.size() + 1;
+        document.m_lines.push_back(std::move(line));
+    }
+
+    return document;
+}
+
+template <typename Callable>
+double median_duration(std::size_t iterations, Callable callable)
+{
+    std::vector<double> results;
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        callable();
+        auto const end = std::chrono::steady_clock::now();
+
+        auto const duration = std::chrono::duration<double>(end - start);
+        results.push_back(duration.count());
+    }
+
+    std::sort(results.rbegin(), results.rend());
+    return results[iterations / 2];
+}
+
+template <typename Callable>
+std::uint64_t count_allocations(Callable callable)
+{
+    auto const start = fly::benchmark::MemoryUtil::allocations();
+    callable();
+
+    return fly::benchmark::MemoryUtil::allocations() - start;
+}
+
+} // namespace
+
+CATCH_TEST_CASE("JSON Corpus", "[bench]")
+{
+    static constexpr std::size_t s_iterations = 11;
+    static constexpr double s_megabyte = 1024.0 * 1024.0;
+
+    std::mt19937 engine(0x5eed);
+
+    // Documents are generated one at a time, so that the peak resident set size is not dominated by
+    // the documents themselves.
+    std::vector<std::function<Document()>> const generators {
+        []() { return create_deeply_nested_document(); },
+        [&engine]() { return create_small_objects_document(engine); },
+        [&engine]() { return create_long_strings_document(engine); },
+        [&engine]() { return create_number_heavy_document(engine); },
+        [&engine]() { return create_whitespace_heavy_document(engine); },
+        [&engine]() { return create_ndjson_document(engine); },
+    };
+
+    CorpusTable table(
+        "JSON corpus: " + std::to_string(s_document_size >> 20) + " MB per document",
+        {"Document",
+         "Parse (MB/s)",
+         "Parse (allocs/MB)",
+         "Serialize (MB/s)",
+         "Serialize (allocs/MB)",
+         "Serialized (MB)",
+         "Peak RSS (MB)"});
+
+    fly::parser::JsonParser parser;
+
+    for (auto const &generator : generators)
+    {
+        Document const document = generator();
+        bool parsed = true;
+
+        double const size = static_cast<double>(document.m_size) / s_megabyte;
+        std::vector<fly::Json> values(document.m_lines.size());
+
+        auto parse = [&parser, &document, &values, &parsed]() {
+            for (std::size_t i = 0; i < document.m_lines.size(); ++i)
+            {
+                if (auto value = parser.parse_string(document.m_lines[i]); value)
+                {
+                    values[i] = *std::move(value);
+                }
+                else
+                {
+                    parsed = false;
+                }
+            }
+        };
+
+        std::size_t serialized_size = 0;
+
+        auto serialize = [&values, &serialized_size]() {
+            serialized_size = 0;
+
+            for (auto const &value : values)
+            {
+                serialized_size += value.serialize().size() + 1;
+            }
+        };
+
+        auto const parse_duration = median_duration(s_iterations, parse);
+        auto const parse_allocations = count_allocations(parse);
+        CATCH_REQUIRE(parsed);
+
+        auto const serialize_duration = median_duration(s_iterations, serialize);
+        auto const serialize_allocations = count_allocations(serialize);
+
+        double const serialized = static_cast<double>(serialized_size) / s_megabyte;
+
+        table.append_row(
+            document.m_name,
+            size / parse_duration,
+            static_cast<double>(parse_allocations) / size,
+            serialized / serialize_duration,
+            static_cast<double>(serialize_allocations) / serialized,
+            serialized,
+            static_cast<double>(fly::benchmark::MemoryUtil::peak_resident_set_size()) / s_megabyte);
+    }
+
+    std::cout << table << '\n';
+}
@@ -0,0 +1,127 @@
+#include "bench/util/table.hpp"
+
+#include "fly/fly.hpp"
+#include "fly/types/json/json.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using LookupTable = fly::benchmark::Table<std::string, double, double>;
+
+// Look up and convert a value the way fly::config::Config::get_value did previously, treating a
+// missing or incompatible value as exceptional.
+std::int64_t throwing_lookup(fly::Json const &json, std::string const &name, std::int64_t def)
+{
+    try
+    {
+        return std::int64_t(json[name]);
+    }
+    catch (fly::JsonException const &)
+    {
+    }
+
+    return def;
+}
+
+// Look up and convert a value with the exception-free accessors.
+std::int64_t non_throwing_lookup(fly::Json const &json, std::string const &name, std::int64_t def)
+{
+    if (fly::Json const *value = json.try_at(name); value != nullptr)
+    {
+        if (auto converted = value->try_as<std::int64_t>(); converted)
+        {
+            return *converted;
+        }
+    }
+
+    return def;
+}
+
+template <typename Lookup>
+double median_duration(
+    std::size_t iterations,
+    fly::Json const &json,
+    std::vector<std::string> const &names,
+    Lookup lookup)
+{
+    std::vector<double> results;
+    std::int64_t sum = 0;
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        auto const start = std::chrono::steady_clock::now();
+
+        for (auto const &name : names)
+        {
+            sum += lookup(json, name, 0);
+        }
+
+        auto const end = std::chrono::steady_clock::now();
+
+        auto const duration = std::chrono::duration<double, std::nano>(end - start);
+        results.push_back(duration.count() / static_cast<double>(names.size()));
+    }
+
+    FLY_UNUSED(sum);
+
+    std::sort(results.rbegin(), results.rend());
+    return results[iterations / 2];
+}
+
+} // namespace
+
+CATCH_TEST_CASE("JSON Lookup", "[bench]")
+{
+    static constexpr std::size_t s_iterations = 11;
+    static constexpr std::size_t s_values = 64;
+    static constexpr std::size_t s_lookups = 100'000;
+
+    fly::Json json = fly::json_object_type();
+
+    for (std::size_t i = 0; i < s_values; ++i)
+    {
+        json["value_" + std::to_string(i)] = i;
+        json["string_" + std::to_string(i)] = "abc";
+    }
+
+    auto create_names = [](char const *prefix) {
+        std::vector<std::string> names;
+        names.reserve(s_lookups);
+
+        for (std::size_t i = 0; i < s_lookups; ++i)
+        {
+            names.push_back(prefix + std::to_string(i % s_values));
+        }
+
+        return names;
+    };
+
+    // Hits are present and convertible, misses are not present, and mismatches are present but
+    // not convertible to an integer.
+    auto const hits = create_names("value_");
+    auto const misses = create_names("missing_");
+    auto const mismatches = create_names("string_");
+
+    LookupTable table("JSON lookup", {"Lookup", "Throwing (ns)", "Non-throwing (ns)"});
+
+    auto append_row = [&](std::string name, std::vector<std::string> const &names) {
+        auto const throwing = median_duration(s_iterations, json, names, throwing_lookup);
+        auto const non_throwing = median_duration(s_iterations, json, names, non_throwing_lookup);
+
+        table.append_row(std::move(name), throwing, non_throwing);
+    };
+
+    append_row("Hit", hits);
+    append_row("Miss", misses);
+    append_row("Type mismatch", mismatches);
+
+    std::cout << table << '\n';
+}
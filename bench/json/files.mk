@@ -2,4 +2,8 @@ include $(SOURCE_ROOT)/extern/boostorg/flags.mk
 include $(SOURCE_ROOT)/extern/nlohmann/flags.mk
 
 SRC_$(d) := \
-    $(d)/benchmark_json.cpp
+    $(d)/benchmark_json.cpp \
+    $(d)/benchmark_json_binder.cpp \
+    $(d)/benchmark_json_cbor.cpp \
+    $(d)/benchmark_json_corpus.cpp \
+    $(d)/benchmark_json_lookup.cpp
@@ -0,0 +1,166 @@
+#include "bench/util/table.hpp"
+#include "test/util/path_util.hpp"
+
+#include "fly/fly.hpp"
+#include "fly/parser/ini_parser.hpp"
+#include "fly/types/json/json.hpp"
+#include "fly/types/string/string.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using IniTable = fly::benchmark::Table<std::string, double, double>;
+
+// Generate an INI document with the given number of sections and name/value pairs per section,
+// mixing quoted and unquoted values, comments, and irregular whitespace.
+std::string create_document(std::size_t sections, std::size_t pairs)
+{
+    std::string document;
+
+    for (std::size_t i = 0; i < sections; ++i)
+    {
+        document += "; Section number " + std::to_string(i) + "\n";
+        document += "[section_" + std::to_string(i) + "]\n";
+
+        for (std::size_t j = 0; j < pairs; ++j)
+        {
+            auto const name = "name_" + std::to_string(j);
+            auto const value = "value " + std::to_string(i * pairs + j);
+
+            if ((j % 3) == 0)
+            {
+                document += "  " + name + " = \"" + value + "\"  \n";
+            }
+            else
+            {
+                document += name + "=" + value + "\n";
+            }
+        }
+
+        document += "\n";
+    }
+
+    return document;
+}
+
+// Parse an INI document the way fly::parser::IniParser did previously: extract each line into a
+// std::string, then split and trim each name/value pair by copying. Validation is omitted.
+std::optional<fly::Json> parse_with_copies(std::string const &contents)
+{
+    std::istringstream stream(contents);
+    std::string line;
+
+    fly::Json values = fly::json_object_type();
+    fly::Json::iterator current;
+
+    auto trim_quotes = [](std::string &value) {
+        if ((value.size() >= 2) && value.starts_with('"') && value.ends_with('"'))
+        {
+            value = value.substr(1, value.size() - 2);
+        }
+    };
+
+    while (std::getline(stream, line))
+    {
+        fly::String::trim(line);
+
+        if (line.empty() || line.starts_with(';'))
+        {
+            continue;
+        }
+        else if (line.starts_with('[') && line.ends_with(']'))
+        {
+            std::string section = line.substr(1, line.size() - 2);
+            fly::String::trim(section);
+
+            current = values.insert_or_assign(std::move(section), fly::json_object_type()).first;
+        }
+        else
+        {
+            std::vector<std::string> pair = fly::String::split(line, '=', 2);
+
+            if (pair.size() != 2)
+            {
+                return std::nullopt;
+            }
+
+            fly::String::trim(pair[0]);
+            fly::String::trim(pair[1]);
+            trim_quotes(pair[1]);
+
+            current->insert_or_assign(std::move(pair[0]), std::move(pair[1]));
+        }
+    }
+
+    return values;
+}
+
+template <typename Callable>
+double median_duration(std::size_t iterations, Callable callable)
+{
+    std::vector<double> results;
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        callable();
+        auto const end = std::chrono::steady_clock::now();
+
+        auto const duration = std::chrono::duration<double>(end - start);
+        results.push_back(duration.count());
+    }
+
+    std::sort(results.rbegin(), results.rend());
+    return results[iterations / 2];
+}
+
+} // namespace
+
+CATCH_TEST_CASE("INI Parser", "[bench]")
+{
+    static constexpr std::size_t s_iterations = 11;
+    static constexpr std::size_t s_sections = 2'000;
+    static constexpr std::size_t s_pairs = 50;
+
+    std::string const contents = create_document(s_sections, s_pairs);
+
+    fly::test::PathUtil::ScopedTempDirectory path;
+    std::filesystem::path const file = path.file();
+    CATCH_REQUIRE(fly::test::PathUtil::write_file(file, contents));
+
+    IniTable table(
+        "INI parsing: " + std::to_string(contents.size() >> 20) + " MB",
+        {"Parser", "Duration (ms)", "Speed (MB/s)"});
+
+    auto append_row = [&table, &contents](std::string name, double duration) {
+        auto const speed = contents.size() / duration / 1024.0 / 1024.0;
+        table.append_row(std::move(name), duration * 1000, speed);
+    };
+
+    fly::parser::IniParser parser;
+
+    append_row("getline + split", median_duration(s_iterations, [&contents]() {
+                   FLY_UNUSED(parse_with_copies(contents));
+               }));
+
+    append_row("libfly (string)", median_duration(s_iterations, [&parser, &contents]() {
+                   FLY_UNUSED(parser.parse_string(contents));
+               }));
+
+    append_row("libfly (file)", median_duration(s_iterations, [&parser, &file]() {
+                   FLY_UNUSED(parser.parse_file(file));
+               }));
+
+    std::cout << table << '\n';
+}
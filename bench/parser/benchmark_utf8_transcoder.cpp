@@ -0,0 +1,95 @@
+#include "bench/util/table.hpp"
+
+#include "fly/fly.hpp"
+#include "fly/parser/detail/utf8_transcoder.hpp"
+#include "fly/types/string/string.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+using TranscoderTable = fly::benchmark::Table<std::string, double, double, double>;
+
+// Repeat a pattern until the given number of code units is reached.
+template <typename StringType>
+StringType create_contents(StringType const &pattern, std::size_t size)
+{
+    StringType contents;
+    contents.reserve(size + pattern.size());
+
+    while (contents.size() < size)
+    {
+        contents += pattern;
+    }
+
+    return contents;
+}
+
+template <typename Callable>
+double median_duration(std::size_t iterations, Callable callable)
+{
+    std::vector<double> results;
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        callable();
+        auto const end = std::chrono::steady_clock::now();
+
+        auto const duration = std::chrono::duration<double>(end - start);
+        results.push_back(duration.count());
+    }
+
+    std::sort(results.rbegin(), results.rend());
+    return results[iterations / 2];
+}
+
+} // namespace
+
+CATCH_TEST_CASE("UTF-8 Transcoder", "[bench]")
+{
+    static constexpr std::size_t s_iterations = 11;
+    static constexpr std::size_t s_size = 16 << 20;
+
+    TranscoderTable table(
+        "UTF-8 transcoding: " + std::to_string(s_size >> 20) + "M code units",
+        {"Contents", "convert (ms)", "1 thread (ms)", "Parallel (ms)"});
+
+    auto append_row = [&table](std::string name, auto const &contents) {
+        using char_type = typename std::remove_cvref_t<decltype(contents)>::value_type;
+        using view_type = std::basic_string_view<char_type>;
+
+        auto const convert = median_duration(s_iterations, [&contents]() {
+            FLY_UNUSED(fly::BasicString<char_type>::template convert<std::string>(contents));
+        });
+
+        auto const single = median_duration(s_iterations, [&contents]() {
+            FLY_UNUSED(fly::parser::detail::transcode_to_utf8(view_type(contents), 1));
+        });
+
+        auto const multiple = median_duration(s_iterations, [&contents]() {
+            FLY_UNUSED(fly::parser::detail::transcode_to_utf8(view_type(contents)));
+        });
+
+        table.append_row(std::move(name), convert * 1000, single * 1000, multiple * 1000);
+    };
+
+    append_row("UTF-16 ASCII", create_contents<std::u16string>(u"{\"key\": [1, 2, 3]}\n", s_size));
+    append_row("UTF-16 mixed", create_contents<std::u16string>(u"{\"ключ\": \"値\"}\n", s_size));
+    append_row("UTF-16 CJK", create_contents<std::u16string>(u"日本語のテキスト", s_size));
+
+    append_row("UTF-32 ASCII", create_contents<std::u32string>(U"{\"key\": [1, 2, 3]}\n", s_size));
+    append_row("UTF-32 mixed", create_contents<std::u32string>(U"{\"ключ\": \"値\"}\n", s_size));
+    append_row("UTF-32 CJK", create_contents<std::u32string>(U"日本語のテキスト", s_size));
+
+    std::cout << table << '\n';
+}
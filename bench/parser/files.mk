@@ -0,0 +1,3 @@
+SRC_$(d) := \
+    $(d)/benchmark_ini_parser.cpp \
+    $(d)/benchmark_utf8_transcoder.cpp
@@ -1,2 +1,3 @@
 SRC_$(d) := \
+    $(d)/memory_util.cpp \
     $(d)/stream_util.cpp
@@ -0,0 +1,180 @@
+#include "bench/util/memory_util.hpp"
+
+#include "fly/fly.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#if defined(FLY_WINDOWS)
+#    include <Windows.h>
+
+#    include <Psapi.h>
+#else
+#    include <sys/resource.h>
+#endif
+
+namespace {
+
+// Each allocation is prefixed with its size, so that the heap size may be updated when it is freed.
+// The prefix is sized to keep the allocation aligned as malloc would have aligned it.
+constexpr std::size_t s_header_size = alignof(std::max_align_t);
+
+std::atomic<std::uint64_t> s_allocations {0};
+std::atomic<std::uint64_t> s_heap_size {0};
+std::atomic<std::uint64_t> s_peak_heap_size {0};
+
+void update_peak_heap_size(std::uint64_t heap_size) noexcept
+{
+    std::uint64_t peak = s_peak_heap_size.load(std::memory_order_relaxed);
+
+    while ((heap_size > peak) &&
+           !s_peak_heap_size.compare_exchange_weak(peak, heap_size, std::memory_order_relaxed))
+    {
+    }
+}
+
+void *allocate(std::size_t size) noexcept
+{
+    s_allocations.fetch_add(1, std::memory_order_relaxed);
+
+    auto *block = static_cast<std::byte *>(std::malloc(s_header_size + size));
+
+    if (block == nullptr)
+    {
+        return nullptr;
+    }
+
+    std::memcpy(block, &size, sizeof(size));
+
+    update_peak_heap_size(s_heap_size.fetch_add(size, std::memory_order_relaxed) + size);
+    return block + s_header_size;
+}
+
+void deallocate(void *pointer) noexcept
+{
+    if (pointer == nullptr)
+    {
+        return;
+    }
+
+    auto *block = static_cast<std::byte *>(pointer) - s_header_size;
+
+    std::size_t size = 0;
+    std::memcpy(&size, block, sizeof(size));
+
+    s_heap_size.fetch_sub(size, std::memory_order_relaxed);
+    std::free(block);
+}
+
+} // namespace
+
+//==================================================================================================
+void *operator new(std::size_t size)
+{
+    if (void *pointer = allocate(size); pointer != nullptr)
+    {
+        return pointer;
+    }
+
+    throw std::bad_alloc();
+}
+
+//==================================================================================================
+void *operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+//==================================================================================================
+void *operator new(std::size_t size, std::nothrow_t const &) noexcept
+{
+    return allocate(size);
+}
+
+//==================================================================================================
+void *operator new[](std::size_t size, std::nothrow_t const &) noexcept
+{
+    return allocate(size);
+}
+
+//==================================================================================================
+void operator delete(void *pointer) noexcept
+{
+    deallocate(pointer);
+}
+
+//==================================================================================================
+void operator delete[](void *pointer) noexcept
+{
+    deallocate(pointer);
+}
+
+//==================================================================================================
+void operator delete(void *pointer, std::size_t) noexcept
+{
+    deallocate(pointer);
+}
+
+//==================================================================================================
+void operator delete[](void *pointer, std::size_t) noexcept
+{
+    deallocate(pointer);
+}
+
+namespace fly::benchmark {
+
+//==================================================================================================
+std::uint64_t MemoryUtil::allocations()
+{
+    return s_allocations.load(std::memory_order_relaxed);
+}
+
+//==================================================================================================
+std::uint64_t MemoryUtil::heap_size()
+{
+    return s_heap_size.load(std::memory_order_relaxed);
+}
+
+//==================================================================================================
+std::uint64_t MemoryUtil::peak_heap_size()
+{
+    return s_peak_heap_size.load(std::memory_order_relaxed);
+}
+
+//==================================================================================================
+void MemoryUtil::reset_peak_heap_size()
+{
+    s_peak_heap_size.store(heap_size(), std::memory_order_relaxed);
+}
+
+//==================================================================================================
+std::uint64_t MemoryUtil::peak_resident_set_size()
+{
+#if defined(FLY_WINDOWS)
+    PROCESS_MEMORY_COUNTERS pmc;
+
+    if (::GetProcessMemoryInfo(::GetCurrentProcess(), &pmc, sizeof(pmc)))
+    {
+        return static_cast<std::uint64_t>(pmc.PeakWorkingSetSize);
+    }
+#else
+    struct rusage usage;
+
+    if (::getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+#    if defined(FLY_MACOS)
+        return static_cast<std::uint64_t>(usage.ru_maxrss);
+#    else
+        // Linux reports the maximum resident set size in kilobytes.
+        return static_cast<std::uint64_t>(usage.ru_maxrss) * 1024;
+#    endif
+    }
+#endif
+
+    return 0;
+}
+
+} // namespace fly::benchmark
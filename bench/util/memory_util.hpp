@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+
+namespace fly::benchmark {
+
+/**
+ * Utility class to measure the memory usage of benchmarks. The global allocation functions are
+ * replaced within the benchmark binary in order to count heap allocations, and to track the number
+ * of bytes allocated on the heap. Over-aligned allocations are not replaced, and thus not tracked.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+class MemoryUtil
+{
+public:
+    /**
+     * @return The total number of heap allocations made by the process so far.
+     */
+    static std::uint64_t allocations();
+
+    /**
+     * @return The number of bytes currently allocated on the heap.
+     */
+    static std::uint64_t heap_size();
+
+    /**
+     * @return The largest number of bytes allocated on the heap at once since the peak heap size
+     *         was last reset.
+     */
+    static std::uint64_t peak_heap_size();
+
+    /**
+     * Reset the peak heap size to the number of bytes currently allocated on the heap, so that the
+     * peak heap size of an operation may be measured.
+     */
+    static void reset_peak_heap_size();
+
+    /**
+     * @return The peak resident set size of the process so far, in bytes.
+     */
+    static std::uint64_t peak_resident_set_size();
+};
+
+} // namespace fly::benchmark
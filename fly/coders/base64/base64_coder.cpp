@@ -1,7 +1,13 @@
 #include "fly/coders/base64/base64_coder.hpp"
 
+#include "fly/system/cpu_features.hpp"
+
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace fly::coders {
 
@@ -83,10 +89,10 @@ namespace {
     std::conditional_t<AllowPadding::value, std::size_t, bool>
     decode_chunk(std::ios::char_type const *encoded, std::ios::char_type *decoded)
     {
-        auto const code0 = s_base64_codes[static_cast<std::size_t>(encoded[0])];
-        auto const code1 = s_base64_codes[static_cast<std::size_t>(encoded[1])];
-        auto const code2 = s_base64_codes[static_cast<std::size_t>(encoded[2])];
-        auto const code3 = s_base64_codes[static_cast<std::size_t>(encoded[3])];
+        auto const code0 = s_base64_codes[static_cast<std::uint8_t>(encoded[0])];
+        auto const code1 = s_base64_codes[static_cast<std::uint8_t>(encoded[1])];
+        auto const code2 = s_base64_codes[static_cast<std::uint8_t>(encoded[2])];
+        auto const code3 = s_base64_codes[static_cast<std::uint8_t>(encoded[3])];
 
         // All 6 bits of the first code, first 2 bits of the second code.
         decoded[0] = static_cast<std::ios::char_type>((code0 << 2) | ((code1 >> 4) & 0x03));
@@ -120,96 +126,770 @@ namespace {
         }
     }
 
-} // namespace
-
-//==================================================================================================
-bool Base64Coder::encode_internal(std::istream &decoded, std::ostream &encoded)
-{
-    do
+    /**
+     * Encode a sequence of bytes in 3-byte chunks. Padding is added to the final chunk if the
+     * sequence is not evenly split into 3-byte chunks.
+     *
+     * @param decoded Buffer holding the contents to encode.
+     * @param size The number of bytes to encode.
+     * @param encoded Buffer to store the encoded contents.
+     *
+     * @return The number of bytes written to the encoded buffer.
+     */
+    std::size_t encode_scalar(
+        std::ios::char_type const *decoded,
+        std::size_t size,
+        std::ios::char_type *encoded)
     {
-        decoded.read(m_decoded.data(), static_cast<std::streamsize>(m_decoded.size()));
-        auto const bytes = static_cast<std::size_t>(decoded.gcount());
+        std::ios::char_type *encoding = encoded;
 
-        std::ios::char_type const *decoding = m_decoded.data();
-        std::ios::char_type *encoding = m_encoded.data();
+        for (std::size_t i = size / 3; i > 0; --i)
+        {
+            encode_chunk(decoded, encoding);
+            decoded += 3;
+            encoding += 4;
+        }
 
-        for (std::size_t i = bytes / s_decoded_chunk_size; i > 0; --i)
+        // If the input was not evenly split into 3-byte chunks, add padding to the remaining chunk.
+        if (auto const remainder = size % 3; remainder > 0)
         {
-            encode_chunk(decoding, encoding);
-            decoding += s_decoded_chunk_size;
-            encoding += s_encoded_chunk_size;
+            std::array<std::ios::char_type, 3> chunk {};
+            std::memcpy(chunk.data(), decoded, remainder);
+
+            encode_chunk(chunk.data(), encoding);
+            std::memcpy(encoding + remainder + 1, s_pad, 3 - remainder);
+
+            encoding += 4;
         }
 
-        encoded.write(m_encoded.data(), encoding - m_encoded.data());
+        return static_cast<std::size_t>(encoding - encoded);
+    }
+
+    /**
+     * Decode a sequence of Base64 symbols in 4-byte chunks, conditionally allowing padding symbols
+     * in the final chunk.
+     *
+     * @param encoded Buffer holding the contents to decode.
+     * @param size The number of bytes to decode. Must be a multiple of 4.
+     * @param decoded Buffer to store the decoded contents.
+     * @param allow_padding Whether to allow padding symbols in the final chunk.
+     *
+     * @return If successful, the number of bytes written to the decoded buffer. Otherwise, an
+     *         uninitialized value.
+     */
+    std::optional<std::size_t> decode_scalar(
+        std::ios::char_type const *encoded,
+        std::size_t size,
+        std::ios::char_type *decoded,
+        bool allow_padding)
+    {
+        std::ios::char_type *decoding = decoded;
+        std::size_t chunks = size / 4;
 
-        // If the input stream was not evenly split into 3-byte chunks, add padding to the remaining
-        // chunk.
-        if (auto const remainder = bytes % s_decoded_chunk_size; remainder > 0)
+        // The decoding loop is kept as simple as possible; the decode_chunk method is specialized
+        // to disallow padding symbols within this loop. So if padding is allowed, break out of this
+        // loop one iteration early to then allow padding symbols.
+        if (allow_padding && (chunks > 0))
         {
-            auto const end = static_cast<std::size_t>(decoding - m_decoded.data()) + remainder;
-            ::memset(m_decoded.data() + end, '\0', end);
+            --chunks;
+        }
 
-            encode_chunk(decoding, m_encoded.data());
+        for (; chunks > 0; --chunks)
+        {
+            if (!decode_chunk<std::false_type>(encoded, decoding))
+            {
+                return std::nullopt;
+            }
 
-            encoded.write(m_encoded.data(), static_cast<std::streamsize>(remainder + 1));
-            encoded.write(s_pad, static_cast<std::streamsize>(s_decoded_chunk_size - remainder));
+            encoded += 4;
+            decoding += 3;
         }
-    } while (decoded);
 
-    return decoded.eof() && encoded.good();
-}
+        if (allow_padding && (size > 0))
+        {
+            std::size_t const bytes_read = decode_chunk<std::true_type>(encoded, decoding);
 
-//==================================================================================================
-bool Base64Coder::decode_internal(std::istream &encoded, std::ostream &decoded)
-{
-    do
+            if (bytes_read == 0)
+            {
+                return std::nullopt;
+            }
+
+            decoding += bytes_read;
+        }
+
+        return static_cast<std::size_t>(decoding - decoded);
+    }
+
+#if defined(FLY_X86)
+
+    // The SIMD kernels below are based on the algorithms described by Wojciech Mula and Daniel
+    // Lemire in "Faster Base64 Encoding and Decoding Using AVX2 Instructions".
+
+    /**
+     * Split 12 bytes, held in the low 12 bytes of each 128-bit lane, into 16 6-bit indices.
+     */
+    FLY_TARGET("ssse3") __m128i encode_reshuffle(__m128i input)
     {
-        encoded.read(m_encoded.data(), static_cast<std::streamsize>(m_encoded.size()));
-        auto const bytes = static_cast<std::size_t>(encoded.gcount());
+        input = _mm_shuffle_epi8(
+            input,
+            _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+        __m128i const t0 = _mm_and_si128(input, _mm_set1_epi32(0x0fc0fc00));
+        __m128i const t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+        __m128i const t2 = _mm_and_si128(input, _mm_set1_epi32(0x003f03f0));
+        __m128i const t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+
+        return _mm_or_si128(t1, t3);
+    }
+
+    /**
+     * Translate 16 6-bit indices into their Base64 symbols.
+     */
+    FLY_TARGET("ssse3") __m128i encode_translate(__m128i indices)
+    {
+        // Reduce each index to an offset into a table of the differences between each index and
+        // its symbol: 0 for [26, 51], 1 through 12 for [52, 63], and 13 for [0, 25].
+        __m128i result = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        __m128i const less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+        result = _mm_or_si128(result, _mm_and_si128(less, _mm_set1_epi8(13)));
+
+        __m128i const shift = _mm_setr_epi8(
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
 
-        if ((bytes % s_encoded_chunk_size) != 0)
+        return _mm_add_epi8(_mm_shuffle_epi8(shift, result), indices);
+    }
+
+    /**
+     * Translate 16 Base64 symbols into their 6-bit indices, and determine if any symbol was not a
+     * valid, non-padding symbol.
+     */
+    FLY_TARGET("ssse3") __m128i decode_translate(__m128i input, __m128i &invalid)
+    {
+        __m128i const lut_lo = _mm_setr_epi8(
+            0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+            0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+        __m128i const lut_hi = _mm_setr_epi8(
+            0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+            0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+        __m128i const lut_roll =
+            _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+        __m128i const mask_2f = _mm_set1_epi8(0x2f);
+
+        __m128i const hi_nibbles = _mm_and_si128(_mm_srli_epi32(input, 4), mask_2f);
+        __m128i const lo_nibbles = _mm_and_si128(input, mask_2f);
+
+        __m128i const lo = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+        __m128i const hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+        invalid = _mm_and_si128(lo, hi);
+
+        __m128i const eq_2f = _mm_cmpeq_epi8(input, mask_2f);
+        __m128i const roll = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(eq_2f, hi_nibbles));
+
+        return _mm_add_epi8(input, roll);
+    }
+
+    /**
+     * Pack 16 6-bit indices into the low 12 bytes of the result.
+     */
+    FLY_TARGET("ssse3") __m128i decode_reshuffle(__m128i indices)
+    {
+        __m128i const merged = _mm_maddubs_epi16(indices, _mm_set1_epi32(0x01400140));
+        __m128i const packed = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+
+        return _mm_shuffle_epi8(
+            packed,
+            _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    }
+
+    /**
+     * Encode a sequence of bytes in 12-byte blocks with SSSE3 instructions. Each iteration loads 16
+     * bytes, so blocks are only encoded while at least 16 bytes remain.
+     *
+     * @return The number of bytes encoded, which will be a multiple of 3.
+     */
+    FLY_TARGET("ssse3") std::size_t
+    encode_ssse3(std::ios::char_type const *decoded, std::size_t size, std::ios::char_type *encoded)
+    {
+        std::size_t position = 0;
+
+        for (; (position + 16) <= size; position += 12, encoded += 16)
         {
-            decoded.setstate(std::ios::failbit);
-            break;
+            __m128i const input =
+                _mm_loadu_si128(reinterpret_cast<__m128i const *>(decoded + position));
+            __m128i const output = encode_translate(encode_reshuffle(input));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(encoded), output);
         }
-        else if (bytes == 0)
+
+        return position;
+    }
+
+    /**
+     * Decode a sequence of Base64 symbols in 16-byte blocks with SSSE3 instructions. Decoding stops
+     * at the first block containing an invalid or padding symbol.
+     *
+     * @return The number of symbols decoded, which will be a multiple of 4.
+     */
+    FLY_TARGET("ssse3") std::size_t
+    decode_ssse3(std::ios::char_type const *encoded, std::size_t size, std::ios::char_type *decoded)
+    {
+        std::size_t position = 0;
+
+        for (; (position + 16) <= size; position += 16, decoded += 12)
         {
-            break;
+            __m128i invalid;
+
+            __m128i const input =
+                _mm_loadu_si128(reinterpret_cast<__m128i const *>(encoded + position));
+            __m128i const indices = decode_translate(input, invalid);
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(invalid, _mm_setzero_si128())) != 0xffff)
+            {
+                break;
+            }
+
+            __m128i const output = decode_reshuffle(indices);
+
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(decoded), output);
+
+            auto const high =
+                static_cast<std::uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(output, 8)));
+            std::memcpy(decoded + 8, &high, sizeof(high));
         }
 
-        std::ios::char_type const *encoding = m_encoded.data();
-        std::ios::char_type *decoding = m_decoded.data();
+        return position;
+    }
 
-        // For performance, the decoding loop is potentially broken up depending on whether this is
-        // the last read from the encoded stream. The goal is to keep the decoding loop as simple
-        // as possible; the decode_chunk method is specialized to disallow padding symbols within
-        // this loop. So on the last read from the encoded stream, break out of this loop one
-        // iteration early to then allow padding symbols.
-        for (std::size_t i = bytes / s_encoded_chunk_size - encoded.eof(); i > 0; --i)
+    /**
+     * Encode a sequence of bytes in 24-byte blocks with AVX2 instructions. Each iteration loads 28
+     * bytes, so blocks are only encoded while at least 28 bytes remain.
+     *
+     * @return The number of bytes encoded, which will be a multiple of 3.
+     */
+    FLY_TARGET("avx2") std::size_t
+    encode_avx2(std::ios::char_type const *decoded, std::size_t size, std::ios::char_type *encoded)
+    {
+        __m256i const shuffle = _mm256_set_epi8(
+            10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+            10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+        __m256i const shift = _mm256_setr_epi8(
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+        std::size_t position = 0;
+
+        for (; (position + 28) <= size; position += 24, encoded += 32)
+        {
+            auto const *block = reinterpret_cast<__m128i const *>(decoded + position);
+            auto const *next = reinterpret_cast<__m128i const *>(decoded + position + 12);
+
+            __m256i input = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(block)),
+                _mm_loadu_si128(next),
+                1);
+
+            input = _mm256_shuffle_epi8(input, shuffle);
+
+            __m256i const t0 = _mm256_and_si256(input, _mm256_set1_epi32(0x0fc0fc00));
+            __m256i const t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+            __m256i const t2 = _mm256_and_si256(input, _mm256_set1_epi32(0x003f03f0));
+            __m256i const t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+            __m256i const indices = _mm256_or_si256(t1, t3);
+
+            __m256i result = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+            __m256i const less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+            result = _mm256_or_si256(result, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+            result = _mm256_add_epi8(_mm256_shuffle_epi8(shift, result), indices);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(encoded), result);
+        }
+
+        return position;
+    }
+
+    /**
+     * Decode a sequence of Base64 symbols in 32-byte blocks with AVX2 instructions. Decoding stops
+     * at the first block containing an invalid or padding symbol.
+     *
+     * @return The number of symbols decoded, which will be a multiple of 4.
+     */
+    FLY_TARGET("avx2") std::size_t
+    decode_avx2(std::ios::char_type const *encoded, std::size_t size, std::ios::char_type *decoded)
+    {
+        __m256i const lut_lo = _mm256_setr_epi8(
+            0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+            0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a,
+            0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+            0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+        __m256i const lut_hi = _mm256_setr_epi8(
+            0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+            0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+            0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+            0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+        __m256i const lut_roll = _mm256_setr_epi8(
+            0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+        __m256i const shuffle = _mm256_setr_epi8(
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+        __m256i const mask_2f = _mm256_set1_epi8(0x2f);
+
+        std::size_t position = 0;
+
+        for (; (position + 32) <= size; position += 32, decoded += 24)
         {
-            if (!decode_chunk<std::false_type>(encoding, decoding))
+            __m256i const input =
+                _mm256_loadu_si256(reinterpret_cast<__m256i const *>(encoded + position));
+
+            __m256i const hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(input, 4), mask_2f);
+            __m256i const lo_nibbles = _mm256_and_si256(input, mask_2f);
+
+            __m256i const lo = _mm256_shuffle_epi8(lut_lo, lo_nibbles);
+            __m256i const hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+
+            if (!_mm256_testz_si256(lo, hi))
             {
-                decoded.setstate(std::ios::failbit);
                 break;
             }
 
-            encoding += s_encoded_chunk_size;
-            decoding += s_decoded_chunk_size;
+            __m256i const eq_2f = _mm256_cmpeq_epi8(input, mask_2f);
+            __m256i const roll = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(eq_2f, hi_nibbles));
+            __m256i const indices = _mm256_add_epi8(input, roll);
+
+            __m256i const merged = _mm256_maddubs_epi16(indices, _mm256_set1_epi32(0x01400140));
+            __m256i packed = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+            packed = _mm256_shuffle_epi8(packed, shuffle);
+
+            // Each 128-bit lane now holds 12 decoded bytes. Move those bytes to the low 24 bytes of
+            // the register, and store exactly those 24 bytes.
+            packed = _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(decoded), _mm256_castsi256_si128(packed));
+            _mm_storel_epi64(
+                reinterpret_cast<__m128i *>(decoded + 16),
+                _mm256_extracti128_si256(packed, 1));
         }
 
-        if (encoded.eof())
+        return position;
+    }
+
+#endif
+
+    using encode_kernel =
+        std::size_t (*)(std::ios::char_type const *, std::size_t, std::ios::char_type *);
+    using decode_kernel =
+        std::size_t (*)(std::ios::char_type const *, std::size_t, std::ios::char_type *);
+
+    /**
+     * The SIMD kernels supported by the running CPU, if any.
+     */
+    struct Kernels
+    {
+        encode_kernel m_encode {nullptr};
+        decode_kernel m_decode {nullptr};
+    };
+
+    Kernels select_kernels()
+    {
+        Kernels kernels;
+
+#if defined(FLY_X86)
+        auto const &features = fly::system::cpu_features();
+
+        if (features.m_avx2)
         {
-            std::size_t const bytes_read = decode_chunk<std::true_type>(encoding, decoding);
-            decoding += bytes_read;
+            kernels.m_encode = encode_avx2;
+            kernels.m_decode = decode_avx2;
+        }
+        else if (features.m_ssse3)
+        {
+            kernels.m_encode = encode_ssse3;
+            kernels.m_decode = decode_ssse3;
+        }
+#endif
 
-            if (bytes_read == 0)
+        return kernels;
+    }
+
+    Kernels const &kernels()
+    {
+        static Kernels const s_kernels = select_kernels();
+        return s_kernels;
+    }
+
+    /**
+     * Encode a sequence of bytes, with the SIMD kernel supported by the running CPU for as much of
+     * the sequence as possible, and the scalar encoder for the remainder.
+     */
+    std::size_t
+    encode(std::ios::char_type const *decoded, std::size_t size, std::ios::char_type *encoded)
+    {
+        std::size_t decoded_bytes = 0;
+        std::size_t encoded_bytes = 0;
+
+        if (auto const kernel = kernels().m_encode; kernel != nullptr)
+        {
+            decoded_bytes = kernel(decoded, size, encoded);
+            encoded_bytes = (decoded_bytes / 3) * 4;
+        }
+
+        return encoded_bytes +
+            encode_scalar(decoded + decoded_bytes, size - decoded_bytes, encoded + encoded_bytes);
+    }
+
+    /**
+     * Decode a sequence of Base64 symbols, with the SIMD kernel supported by the running CPU for as
+     * much of the sequence as possible, and the scalar decoder for the remainder. The final chunk
+     * is always decoded by the scalar decoder, as it is the only chunk which may contain padding.
+     */
+    std::optional<std::size_t> decode(
+        std::ios::char_type const *encoded,
+        std::size_t size,
+        std::ios::char_type *decoded,
+        bool allow_padding)
+    {
+        if ((size % 4) != 0)
+        {
+            return std::nullopt;
+        }
+
+        std::size_t encoded_bytes = 0;
+        std::size_t decoded_bytes = 0;
+
+        if (auto const kernel = kernels().m_decode; (kernel != nullptr) && (size > 4))
+        {
+            encoded_bytes = kernel(encoded, size - 4, decoded);
+            decoded_bytes = (encoded_bytes / 4) * 3;
+        }
+
+        auto const result = decode_scalar(
+            encoded + encoded_bytes,
+            size - encoded_bytes,
+            decoded + decoded_bytes,
+            allow_padding);
+
+        return result ? std::optional<std::size_t>(decoded_bytes + *result) : std::nullopt;
+    }
+
+    /**
+     * Session to incrementally Base64 encode a sequence of bytes. Bytes which do not complete a
+     * 3-byte chunk are held until the next update, so padding is only added when finished.
+     */
+    class Base64EncoderSession final : public EncoderSession
+    {
+    public:
+        explicit Base64EncoderSession(std::ostream &encoded) :
+            m_stream(encoded),
+            m_encoded(Base64Coder::encoded_length(s_block_size))
+        {
+        }
+
+        bool update(std::span<std::byte const> decoded) override
+        {
+            if (m_finished)
             {
-                decoded.setstate(std::ios::failbit);
-                break;
+                return false;
+            }
+
+            auto const *data = reinterpret_cast<std::ios::char_type const *>(decoded.data());
+            std::size_t size = decoded.size();
+
+            if (m_partial_size > 0)
+            {
+                std::size_t const fill = std::min(m_partial.size() - m_partial_size, size);
+                std::memcpy(m_partial.data() + m_partial_size, data, fill);
+
+                m_partial_size += fill;
+                data += fill;
+                size -= fill;
+
+                if (m_partial_size < m_partial.size())
+                {
+                    return m_stream.good();
+                }
+
+                write(m_partial.data(), m_partial.size());
+                m_partial_size = 0;
+            }
+
+            std::size_t const whole = size - (size % m_partial.size());
+
+            for (std::size_t offset = 0; offset < whole; offset += s_block_size)
+            {
+                write(data + offset, std::min(s_block_size, whole - offset));
             }
+
+            m_partial_size = size - whole;
+            std::memcpy(m_partial.data(), data + whole, m_partial_size);
+
+            return m_stream.good();
+        }
+
+        bool finish() override
+        {
+            if (std::exchange(m_finished, true))
+            {
+                return false;
+            }
+
+            write(m_partial.data(), m_partial_size);
+            return m_stream.good();
+        }
+
+    private:
+        void write(std::ios::char_type const *decoded, std::size_t size)
+        {
+            std::size_t const encoded_bytes = encode(decoded, size, m_encoded.data());
+            m_stream.write(m_encoded.data(), static_cast<std::streamsize>(encoded_bytes));
+        }
+
+        static constexpr std::size_t s_block_size = 48 << 10;
+
+        std::ostream &m_stream;
+        std::vector<std::ios::char_type> m_encoded;
+
+        std::array<std::ios::char_type, 3> m_partial;
+        std::size_t m_partial_size {0};
+
+        bool m_finished {false};
+    };
+
+    /**
+     * Session to incrementally Base64 decode a sequence of symbols. The final 4-byte chunk of each
+     * update, complete or not, is held until the next update, as it may be the final chunk of the
+     * stream and hold padding symbols.
+     */
+    class Base64DecoderSession final : public DecoderSession
+    {
+    public:
+        explicit Base64DecoderSession(std::ostream &decoded) :
+            m_stream(decoded),
+            m_decoded(Base64Coder::max_decoded_length(s_block_size))
+        {
+        }
+
+        bool update(std::span<std::byte const> encoded) override
+        {
+            if (m_finished)
+            {
+                return false;
+            }
+
+            auto const *data = reinterpret_cast<std::ios::char_type const *>(encoded.data());
+            std::size_t size = encoded.size();
+
+            if ((m_pending_size + size) <= m_pending.size())
+            {
+                std::memcpy(m_pending.data() + m_pending_size, data, size);
+                m_pending_size += size;
+
+                return m_stream.good();
+            }
+
+            // More symbols follow the pending chunk, so it cannot be the final chunk.
+            if (m_pending_size > 0)
+            {
+                std::size_t const fill = m_pending.size() - m_pending_size;
+                std::memcpy(m_pending.data() + m_pending_size, data, fill);
+
+                data += fill;
+                size -= fill;
+
+                if (!write(m_pending.data(), m_pending.size(), false))
+                {
+                    return false;
+                }
+            }
+
+            std::size_t const held = ((size - 1) % m_pending.size()) + 1;
+            std::size_t const whole = size - held;
+
+            for (std::size_t offset = 0; offset < whole; offset += s_block_size)
+            {
+                if (!write(data + offset, std::min(s_block_size, whole - offset), false))
+                {
+                    return false;
+                }
+            }
+
+            m_pending_size = held;
+            std::memcpy(m_pending.data(), data + whole, m_pending_size);
+
+            return m_stream.good();
+        }
+
+        bool finish() override
+        {
+            if (std::exchange(m_finished, true))
+            {
+                return false;
+            }
+
+            return write(m_pending.data(), m_pending_size, true);
+        }
+
+    private:
+        bool write(std::ios::char_type const *encoded, std::size_t size, bool allow_padding)
+        {
+            auto const decoded_bytes = decode(encoded, size, m_decoded.data(), allow_padding);
+
+            if (!decoded_bytes)
+            {
+                m_stream.setstate(std::ios::failbit);
+                return false;
+            }
+
+            m_stream.write(m_decoded.data(), static_cast<std::streamsize>(*decoded_bytes));
+            return m_stream.good();
+        }
+
+        static constexpr std::size_t s_block_size = 64 << 10;
+
+        std::ostream &m_stream;
+        std::vector<std::ios::char_type> m_decoded;
+
+        std::array<std::ios::char_type, 4> m_pending;
+        std::size_t m_pending_size {0};
+
+        bool m_finished {false};
+    };
+
+} // namespace
+
+//==================================================================================================
+std::size_t Base64Coder::encode_into(std::string_view decoded, char *encoded)
+{
+    return encode(decoded.data(), decoded.size(), encoded);
+}
+
+//==================================================================================================
+std::optional<std::size_t> Base64Coder::decode_into(std::string_view encoded, char *decoded)
+{
+    return decode(encoded.data(), encoded.size(), decoded, true);
+}
+
+//==================================================================================================
+std::size_t Base64Coder::max_encoded_size(std::size_t decoded_size) const
+{
+    return encoded_length(decoded_size);
+}
+
+//==================================================================================================
+std::size_t Base64Coder::max_decoded_size(std::size_t encoded_size) const
+{
+    return max_decoded_length(encoded_size);
+}
+
+//==================================================================================================
+std::unique_ptr<EncoderSession> Base64Coder::create_encoder_session(std::ostream &encoded)
+{
+    return std::make_unique<Base64EncoderSession>(encoded);
+}
+
+//==================================================================================================
+std::unique_ptr<DecoderSession> Base64Coder::create_decoder_session(std::ostream &decoded)
+{
+    return std::make_unique<Base64DecoderSession>(decoded);
+}
+
+//==================================================================================================
+std::optional<std::size_t>
+Base64Coder::encode_span(std::span<std::byte const> decoded, std::span<std::byte> encoded)
+{
+    if (encoded.size() < encoded_length(decoded.size()))
+    {
+        return std::nullopt;
+    }
+
+    return encode(
+        reinterpret_cast<std::ios::char_type const *>(decoded.data()),
+        decoded.size(),
+        reinterpret_cast<std::ios::char_type *>(encoded.data()));
+}
+
+//==================================================================================================
+std::optional<std::size_t>
+Base64Coder::decode_span(std::span<std::byte const> encoded, std::span<std::byte> decoded)
+{
+    auto const *data = reinterpret_cast<std::ios::char_type const *>(encoded.data());
+    auto *output = reinterpret_cast<std::ios::char_type *>(decoded.data());
+    std::size_t const size = encoded.size();
+    std::size_t const max_size = max_decoded_length(size);
+
+    if ((decoded.size() >= max_size) || ((size % s_encoded_chunk_size) != 0))
+    {
+        return decode(data, size, output, true);
+    }
+    else if (decoded.size() < (max_size - s_decoded_chunk_size))
+    {
+        return std::nullopt;
+    }
+
+    // The final chunk decodes to fewer bytes if it holds padding symbols, so the buffer may still
+    // be large enough. Decode the final chunk separately to avoid writing past the end of the
+    // buffer.
+    std::size_t const final_chunk = size - s_encoded_chunk_size;
+    std::array<std::ios::char_type, s_decoded_chunk_size> chunk;
+
+    auto const body = decode(data, final_chunk, output, false);
+    auto const tail = decode(data + final_chunk, s_encoded_chunk_size, chunk.data(), true);
+
+    if (!body || !tail || (decoded.size() < (*body + *tail)))
+    {
+        return std::nullopt;
+    }
+
+    std::memcpy(output + *body, chunk.data(), *tail);
+    return *body + *tail;
+}
+
+//==================================================================================================
+bool Base64Coder::encode_internal(std::istream &decoded, std::ostream &encoded)
+{
+    do
+    {
+        decoded.read(m_decoded.data(), static_cast<std::streamsize>(m_decoded.size()));
+        auto const bytes = static_cast<std::size_t>(decoded.gcount());
+
+        // Each read fills the buffer unless the end of the stream was reached. The buffer size is a
+        // multiple of the 3-byte chunk size, so padding is only added to the final chunk.
+        std::size_t const encoded_bytes = encode(m_decoded.data(), bytes, m_encoded.data());
+        encoded.write(m_encoded.data(), static_cast<std::streamsize>(encoded_bytes));
+    } while (decoded);
+
+    return decoded.eof() && encoded.good();
+}
+
+//==================================================================================================
+bool Base64Coder::decode_internal(std::istream &encoded, std::ostream &decoded)
+{
+    do
+    {
+        encoded.read(m_encoded.data(), static_cast<std::streamsize>(m_encoded.size()));
+        auto const bytes = static_cast<std::size_t>(encoded.gcount());
+
+        if (bytes == 0)
+        {
+            break;
+        }
+
+        // Padding symbols are only allowed in the final chunk of the stream. Peek at the stream to
+        // detect the end of the stream even if the last read exactly filled the buffer.
+        bool const final_read =
+            encoded.eof() || (encoded.peek() == std::char_traits<std::ios::char_type>::eof());
+
+        auto const decoded_bytes = decode(m_encoded.data(), bytes, m_decoded.data(), final_read);
+
+        if (!decoded_bytes)
+        {
+            decoded.setstate(std::ios::failbit);
+            break;
         }
 
-        decoded.write(m_decoded.data(), decoding - m_decoded.data());
+        decoded.write(m_decoded.data(), static_cast<std::streamsize>(*decoded_bytes));
     } while (encoded);
 
     return encoded.eof() && decoded.good();
@@ -3,19 +3,114 @@
 #include "fly/coders/coder.hpp"
 
 #include <array>
+#include <cstddef>
 #include <istream>
+#include <memory>
+#include <optional>
 #include <ostream>
+#include <span>
+#include <string_view>
 
 namespace fly::coders {
 
 /**
  * A Base64 encoder and decoder.
  *
+ * Encoding and decoding are performed in blocks with SIMD instructions where available. The best
+ * instruction set supported by the running CPU (AVX2 or SSSE3) is chosen at runtime, with a scalar
+ * fallback for other CPUs and for the remainder of a sequence which does not fill a block.
+ *
+ * In addition to the stream-based Encoder and Decoder interfaces, sequences may be coded directly
+ * from a string view into a caller-provided buffer, which avoids streams entirely. The Encoder and
+ * Decoder buffer interfaces are implemented the same way. Such buffers are sized with the static
+ * encoded_length and max_decoded_length, which are usable without a coder instance, and which the
+ * Encoder and Decoder size bounds (max_encoded_size and max_decoded_size) forward to.
+ *
+ * Encoder sessions hold the 1 or 2 bytes of each update which do not complete a 3-byte chunk until
+ * the next update. Decoder sessions hold back the final chunk of each update, as padding symbols
+ * are only allowed in the final chunk of the stream, which is not known until the session is
+ * finished.
+ *
  * @author Timothy Flynn (trflynn89@pm.me)
  * @version May 3, 2020
  */
 class Base64Coder : public Encoder, public Decoder
 {
+public:
+    /**
+     * Compute the size of the Base64 encoding of a sequence of bytes, including padding.
+     *
+     * @param decoded_size The size of the sequence to encode.
+     *
+     * @return The size of the encoded sequence.
+     */
+    static constexpr std::size_t encoded_length(std::size_t decoded_size);
+
+    /**
+     * Compute the maximum size of the decoding of a Base64 encoded sequence. The actual size may be
+     * smaller if the sequence ends with padding symbols.
+     *
+     * @param encoded_size The size of the sequence to decode.
+     *
+     * @return The maximum size of the decoded sequence.
+     */
+    static constexpr std::size_t max_decoded_length(std::size_t encoded_size);
+
+    /**
+     * Base64 encode a sequence of bytes into a buffer. The buffer must be large enough to hold at
+     * least encoded_length(decoded.size()) bytes.
+     *
+     * @param decoded The sequence to encode.
+     * @param encoded Buffer to store the encoded sequence.
+     *
+     * @return The number of bytes written to the buffer.
+     */
+    static std::size_t encode_into(std::string_view decoded, char *encoded);
+
+    /**
+     * Base64 decode a sequence of symbols into a buffer. The buffer must be large enough to hold at
+     * least max_decoded_length(encoded.size()) bytes.
+     *
+     * @param encoded The sequence to decode.
+     * @param decoded Buffer to store the decoded sequence.
+     *
+     * @return If successful, the number of bytes written to the buffer. Otherwise, an uninitialized
+     *         value.
+     */
+    static std::optional<std::size_t> decode_into(std::string_view encoded, char *decoded);
+
+    /**
+     * @param decoded_size The size of the sequence to encode.
+     *
+     * @return The size of the encoded sequence, including padding.
+     */
+    std::size_t max_encoded_size(std::size_t decoded_size) const override;
+
+    /**
+     * @param encoded_size The size of the sequence to decode.
+     *
+     * @return The maximum size of the decoded sequence.
+     */
+    std::size_t max_decoded_size(std::size_t encoded_size) const override;
+
+    /**
+     * Create a session to incrementally Base64 encode a sequence of bytes.
+     *
+     * @param encoded Stream to store the encoded contents. Must outlive the session.
+     *
+     * @return The created session.
+     */
+    std::unique_ptr<EncoderSession> create_encoder_session(std::ostream &encoded) override;
+
+    /**
+     * Create a session to incrementally Base64 decode a sequence of symbols.
+     *
+     * @param decoded Stream to store the decoded contents. Must outlive the session.
+     *
+     * @return The created session.
+     */
+    std::unique_ptr<DecoderSession> create_decoder_session(std::ostream &decoded) override;
+
 protected:
     /**
      * Base64 encode a stream.
@@ -37,6 +132,30 @@ class Base64Coder : public Encoder, public Decoder
      */
     bool decode_internal(std::istream &encoded, std::ostream &decoded) override;
 
+    /**
+     * Base64 encode a sequence of bytes directly into a buffer, without streams.
+     *
+     * @param decoded Buffer holding the contents to encode.
+     * @param encoded Buffer to store the encoded contents.
+     *
+     * @return If successful, the number of bytes written to the encoded buffer. Otherwise, an
+     *         uninitialized value.
+     */
+    std::optional<std::size_t>
+    encode_span(std::span<std::byte const> decoded, std::span<std::byte> encoded) override;
+
+    /**
+     * Base64 decode a sequence of bytes directly into a buffer, without streams.
+     *
+     * @param encoded Buffer holding the contents to decode.
+     * @param decoded Buffer to store the decoded contents.
+     *
+     * @return If successful, the number of bytes written to the decoded buffer. Otherwise, an
+     *         uninitialized value.
+     */
+    std::optional<std::size_t>
+    decode_span(std::span<std::byte const> encoded, std::span<std::byte> decoded) override;
+
 private:
     static constexpr std::size_t const s_decoded_chunk_size = 3;
     static constexpr std::size_t const s_encoded_chunk_size = 4;
@@ -45,4 +164,17 @@ class Base64Coder : public Encoder, public Decoder
     std::array<std::ios::char_type, (64 * s_encoded_chunk_size) << 10> m_encoded;
 };
 
+//==================================================================================================
+constexpr std::size_t Base64Coder::encoded_length(std::size_t decoded_size)
+{
+    return ((decoded_size + s_decoded_chunk_size - 1) / s_decoded_chunk_size) *
+        s_encoded_chunk_size;
+}
+
+//==================================================================================================
+constexpr std::size_t Base64Coder::max_decoded_length(std::size_t encoded_size)
+{
+    return (encoded_size / s_encoded_chunk_size) * s_decoded_chunk_size;
+}
+
 } // namespace fly::coders
@@ -1,12 +1,22 @@
 #include "fly/coders/coder.hpp"
 
+#include "fly/coders/detail/stream_buffers.hpp"
+#include "fly/fly.hpp"
 #include "fly/logger/logger.hpp"
 #include "fly/types/bit_stream/bit_stream_reader.hpp"
 #include "fly/types/bit_stream/bit_stream_writer.hpp"
+#include "fly/types/bit_stream/detail/constants.hpp"
 
+#if defined(FLY_LINUX)
+#    include "fly/coders/detail/nix/mapped_file.hpp"
+#endif
+
+#include <algorithm>
 #include <chrono>
 #include <fstream>
-#include <sstream>
+#include <functional>
+#include <limits>
+#include <utility>
 
 namespace fly::coders {
 
@@ -15,6 +25,12 @@ namespace {
     constexpr std::ios::openmode s_input_mode = std::ios::in | std::ios::binary;
     constexpr std::ios::openmode s_output_mode = std::ios::out | std::ios::binary | std::ios::trunc;
 
+    // Mapped output files are presized to at most this multiple of the encoded size when decoding.
+    constexpr std::size_t s_decoded_capacity_factor = 4;
+
+    // Default upper bound of the size of an encoder's headers.
+    constexpr std::size_t s_default_encoded_overhead = 1 << 10;
+
     template <typename SizeType>
     void log_encoder_stats(
         std::chrono::steady_clock::time_point start,
@@ -47,29 +63,63 @@ namespace {
             std::chrono::duration<double>(end - start).count());
     }
 
-} // namespace
+    /**
+     * Session to code a sequence of bytes with a coder's stream interface. As the stream interface
+     * expects the entire sequence, the sequence is buffered until the session is finished.
+     */
+    template <typename SessionType>
+    class BufferedSession final : public SessionType
+    {
+    public:
+        using CodeStream = std::function<bool(std::istream &, std::ostream &)>;
 
-//==================================================================================================
-bool Encoder::encode_string(std::string const &decoded, std::string &encoded)
-{
-    auto const start = std::chrono::steady_clock::now();
-    bool successful = false;
+        BufferedSession(CodeStream code_stream, std::ostream &output) noexcept :
+            m_code_stream(std::move(code_stream)),
+            m_output(output)
+        {
+        }
 
-    std::istringstream input(decoded, s_input_mode);
-    std::ostringstream output(s_output_mode);
+        bool update(std::span<std::byte const> input) override
+        {
+            if (m_finished)
+            {
+                return false;
+            }
 
-    if (input && output)
-    {
-        successful = encode_internal(input, output);
-    }
+            m_input.insert(m_input.end(), input.begin(), input.end());
+            return true;
+        }
 
-    if (successful)
-    {
-        encoded = output.str();
-        log_encoder_stats(start, decoded.length(), encoded.length());
-    }
+        bool finish() override
+        {
+            if (std::exchange(m_finished, true))
+            {
+                return false;
+            }
 
-    return successful;
+            detail::InputStreamBuffer input_buffer(m_input);
+            std::istream input(&input_buffer);
+
+            bool const successful = m_code_stream(input, m_output);
+            std::vector<std::byte>().swap(m_input);
+
+            return successful && m_output.good();
+        }
+
+    private:
+        CodeStream m_code_stream;
+        std::ostream &m_output;
+
+        std::vector<std::byte> m_input;
+        bool m_finished {false};
+    };
+
+} // namespace
+
+//==================================================================================================
+bool Encoder::encode_string(std::string const &decoded, std::string &encoded)
+{
+    return encode_into_container(std::as_bytes(std::span(decoded)), encoded);
 }
 
 //==================================================================================================
@@ -78,18 +128,17 @@ bool Encoder::encode_file(
     std::filesystem::path const &encoded)
 {
     auto const start = std::chrono::steady_clock::now();
-    bool successful = false;
+    auto successful = encode_mapped_file(decoded, encoded);
+
+    if (!successful)
     {
         std::ifstream input(decoded, s_input_mode);
         std::ofstream output(encoded, s_output_mode);
 
-        if (input && output)
-        {
-            successful = encode_internal(input, output);
-        }
+        successful = input && output && encode_internal(input, output);
     }
 
-    if (successful)
+    if (*successful)
     {
         log_encoder_stats(
             start,
@@ -97,37 +146,125 @@ bool Encoder::encode_file(
             std::filesystem::file_size(encoded));
     }
 
-    return successful;
+    return *successful;
 }
 
 //==================================================================================================
-bool BinaryEncoder::encode_internal(std::istream &decoded, std::ostream &encoded)
+std::optional<std::size_t>
+Encoder::encode_buffer(std::span<std::byte const> decoded, std::span<std::byte> encoded)
 {
-    fly::BitStreamWriter stream(encoded);
-    return encode_binary(decoded, stream);
+    auto const start = std::chrono::steady_clock::now();
+    auto const size = encode_span(decoded, encoded);
+
+    if (size)
+    {
+        log_encoder_stats(start, decoded.size(), *size);
+    }
+
+    return size;
 }
 
 //==================================================================================================
-bool Decoder::decode_string(std::string const &encoded, std::string &decoded)
+bool Encoder::encode_buffer(std::span<std::byte const> decoded, std::vector<std::byte> &encoded)
 {
-    auto const start = std::chrono::steady_clock::now();
-    bool successful = false;
+    return encode_into_container(decoded, encoded);
+}
 
-    std::istringstream input(encoded, s_input_mode);
-    std::ostringstream output(s_output_mode);
+//==================================================================================================
+std::optional<std::size_t>
+Encoder::encode_span(std::span<std::byte const> decoded, std::span<std::byte> encoded)
+{
+    detail::InputStreamBuffer input_buffer(decoded);
+    detail::SpanStreamBuffer output_buffer(encoded);
 
-    if (input && output)
+    std::istream input(&input_buffer);
+    std::ostream output(&output_buffer);
+
+    if (encode_internal(input, output))
     {
-        successful = decode_internal(input, output);
+        return output_buffer.size();
     }
 
-    if (successful)
+    return std::nullopt;
+}
+
+//==================================================================================================
+std::optional<bool> Encoder::encode_mapped_file(
+    std::filesystem::path const &decoded,
+    std::filesystem::path const &encoded)
+{
+#if defined(FLY_LINUX)
+    auto input = detail::MappedInputFile::create(decoded);
+    if (!input)
     {
-        decoded = output.str();
-        log_decoder_stats(start, encoded.length(), decoded.length());
+        return std::nullopt;
     }
 
-    return successful;
+    auto output = detail::MappedOutputFile::create(encoded, max_encoded_size(input->data().size()));
+    if (!output)
+    {
+        return std::nullopt;
+    }
+
+    auto const size = encode_span(input->data(), output->data());
+    return output->close(size.value_or(0)) && size.has_value();
+#else
+    FLY_UNUSED(decoded);
+    FLY_UNUSED(encoded);
+
+    return std::nullopt;
+#endif
+}
+
+//==================================================================================================
+std::size_t Encoder::max_encoded_size(std::size_t decoded_size) const
+{
+    return decoded_size * 2 + s_default_encoded_overhead;
+}
+
+//==================================================================================================
+std::unique_ptr<EncoderSession> Encoder::create_encoder_session(std::ostream &encoded)
+{
+    auto encode_stream = [this](std::istream &input, std::ostream &output) {
+        return encode_internal(input, output);
+    };
+
+    return std::make_unique<BufferedSession<EncoderSession>>(std::move(encode_stream), encoded);
+}
+
+//==================================================================================================
+template <typename Container>
+bool Encoder::encode_into_container(std::span<std::byte const> decoded, Container &encoded)
+{
+    auto const start = std::chrono::steady_clock::now();
+
+    Container output(max_encoded_size(decoded.size()), {});
+    auto const size = encode_span(decoded, std::as_writable_bytes(std::span(output)));
+
+    if (size)
+    {
+        output.resize(*size);
+        encoded = std::move(output);
+
+        log_encoder_stats(start, decoded.size(), encoded.size());
+    }
+
+    return size.has_value();
+}
+
+//==================================================================================================
+bool BinaryEncoder::encode_internal(std::istream &decoded, std::ostream &encoded)
+{
+    // The writer has exclusive use of the stream until encoding is complete, so it may buffer its
+    // output in blocks.
+    fly::BitStreamWriter stream(encoded, fly::detail::s_default_block_size);
+    return encode_binary(decoded, stream);
+}
+
+//==================================================================================================
+bool Decoder::decode_string(std::string const &encoded, std::string &decoded)
+{
+    return decode_into_container(std::as_bytes(std::span(encoded)), decoded);
 }
 
 //==================================================================================================
@@ -136,18 +273,17 @@ bool Decoder::decode_file(
     std::filesystem::path const &decoded)
 {
     auto const start = std::chrono::steady_clock::now();
-    bool successful = false;
+    auto successful = decode_mapped_file(encoded, decoded);
+
+    if (!successful)
     {
         std::ifstream input(encoded, s_input_mode);
         std::ofstream output(decoded, s_output_mode);
 
-        if (input && output)
-        {
-            successful = decode_internal(input, output);
-        }
+        successful = input && output && decode_internal(input, output);
     }
 
-    if (successful)
+    if (*successful)
     {
         log_decoder_stats(
             start,
@@ -155,13 +291,145 @@ bool Decoder::decode_file(
             std::filesystem::file_size(decoded));
     }
 
+    return *successful;
+}
+
+//==================================================================================================
+std::optional<std::size_t>
+Decoder::decode_buffer(std::span<std::byte const> encoded, std::span<std::byte> decoded)
+{
+    auto const start = std::chrono::steady_clock::now();
+    auto const size = decode_span(encoded, decoded);
+
+    if (size)
+    {
+        log_decoder_stats(start, encoded.size(), *size);
+    }
+
+    return size;
+}
+
+//==================================================================================================
+bool Decoder::decode_buffer(std::span<std::byte const> encoded, std::vector<std::byte> &decoded)
+{
+    return decode_into_container(encoded, decoded);
+}
+
+//==================================================================================================
+std::optional<std::size_t>
+Decoder::decode_span(std::span<std::byte const> encoded, std::span<std::byte> decoded)
+{
+    detail::InputStreamBuffer input_buffer(encoded);
+    detail::SpanStreamBuffer output_buffer(decoded);
+
+    std::istream input(&input_buffer);
+    std::ostream output(&output_buffer);
+
+    if (decode_internal(input, output))
+    {
+        return output_buffer.size();
+    }
+
+    return std::nullopt;
+}
+
+//==================================================================================================
+std::optional<bool> Decoder::decode_mapped_file(
+    std::filesystem::path const &encoded,
+    std::filesystem::path const &decoded)
+{
+#if defined(FLY_LINUX)
+    auto input = detail::MappedInputFile::create(encoded);
+    if (!input)
+    {
+        return std::nullopt;
+    }
+
+    auto const encoded_size = input->data().size();
+    auto const max_size = max_decoded_size(encoded_size);
+
+    // Coders whose decoded size may be much larger than their encoded size (e.g. dictionary coders)
+    // have impractically large maximum decoded sizes, so the mapped output is instead grown as the
+    // contents are decoded.
+    auto const capacity = std::min(max_size, encoded_size * s_decoded_capacity_factor);
+
+    auto output = detail::MappedOutputFile::create(decoded, capacity);
+    if (!output)
+    {
+        return std::nullopt;
+    }
+
+    if (max_size <= capacity)
+    {
+        auto const size = decode_span(input->data(), output->data());
+        return output->close(size.value_or(0)) && size.has_value();
+    }
+
+    detail::InputStreamBuffer input_buffer(input->data());
+    std::istream input_stream(&input_buffer);
+    std::ostream output_stream(output.get());
+
+    bool const successful = decode_internal(input_stream, output_stream);
+    return output->close(output->size()) && successful;
+#else
+    FLY_UNUSED(encoded);
+    FLY_UNUSED(decoded);
+
+    return std::nullopt;
+#endif
+}
+
+//==================================================================================================
+std::size_t Decoder::max_decoded_size(std::size_t encoded_size) const
+{
+    FLY_UNUSED(encoded_size);
+    return std::numeric_limits<std::size_t>::max();
+}
+
+//==================================================================================================
+std::unique_ptr<DecoderSession> Decoder::create_decoder_session(std::ostream &decoded)
+{
+    auto decode_stream = [this](std::istream &input, std::ostream &output) {
+        return decode_internal(input, output);
+    };
+
+    return std::make_unique<BufferedSession<DecoderSession>>(std::move(decode_stream), decoded);
+}
+
+//==================================================================================================
+template <typename Container>
+bool Decoder::decode_into_container(std::span<std::byte const> encoded, Container &decoded)
+{
+    auto const start = std::chrono::steady_clock::now();
+    bool successful = false;
+
+    Container output;
+    {
+        detail::InputStreamBuffer input_buffer(encoded);
+        detail::GrowableStreamBuffer<Container> output_buffer(output);
+
+        std::istream input(&input_buffer);
+        std::ostream output_stream(&output_buffer);
+
+        successful = decode_internal(input, output_stream);
+        output.resize(output_buffer.size());
+    }
+
+    if (successful)
+    {
+        decoded = std::move(output);
+        log_decoder_stats(start, encoded.size(), decoded.size());
+    }
+
     return successful;
 }
 
 //==================================================================================================
 bool BinaryDecoder::decode_internal(std::istream &encoded, std::ostream &decoded)
 {
-    fly::BitStreamReader stream(encoded);
+    // The reader has exclusive use of the stream until decoding is complete, so it may read ahead
+    // of the decoder in blocks.
+    fly::BitStreamReader stream(encoded, fly::detail::s_default_block_size);
     return decode_binary(stream, decoded);
 }
 
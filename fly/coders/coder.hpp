@@ -1,9 +1,14 @@
 #pragma once
 
+#include <cstddef>
 #include <filesystem>
 #include <istream>
+#include <memory>
+#include <optional>
 #include <ostream>
+#include <span>
 #include <string>
+#include <vector>
 
 namespace fly {
 class BitStreamReader;
@@ -12,10 +17,83 @@ class BitStreamWriter;
 
 namespace fly::coders {
 
+/**
+ * Virtual interface to incrementally encode a sequence of bytes which is provided in pieces, such
+ * as data arriving from a network connection or appended to a growing file. Encoded contents are
+ * written to the session's output stream as they become available, and the session only holds as
+ * much of the input as its encoder requires to make progress.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+class EncoderSession
+{
+public:
+    /**
+     * Destructor.
+     */
+    virtual ~EncoderSession() = default;
+
+    /**
+     * Encode the next piece of the sequence.
+     *
+     * @param decoded Buffer holding the next piece of the contents to encode.
+     *
+     * @return True if the piece was successfully encoded.
+     */
+    virtual bool update(std::span<std::byte const> decoded) = 0;
+
+    /**
+     * Encode any contents held by the session and complete the encoded stream. The session may not
+     * be updated after it has been finished.
+     *
+     * @return True if the encoded stream was successfully completed.
+     */
+    virtual bool finish() = 0;
+};
+
+/**
+ * Virtual interface to incrementally decode a sequence of bytes which is provided in pieces.
+ * Decoded contents are written to the session's output stream as they become available, and the
+ * session only holds as much of the input as its decoder requires to make progress.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+class DecoderSession
+{
+public:
+    /**
+     * Destructor.
+     */
+    virtual ~DecoderSession() = default;
+
+    /**
+     * Decode the next piece of the sequence.
+     *
+     * @param encoded Buffer holding the next piece of the contents to decode.
+     *
+     * @return True if the piece was successfully decoded, or buffered to be decoded later.
+     */
+    virtual bool update(std::span<std::byte const> encoded) = 0;
+
+    /**
+     * Decode any contents held by the session and verify the encoded stream was complete. The
+     * session may not be updated after it has been finished.
+     *
+     * @return True if the encoded stream was successfully decoded.
+     */
+    virtual bool finish() = 0;
+};
+
 /**
  * Virtual interface to encode a string or file with a plaintext encoder. Coders for specific
  * algorithms should inherit from this class to perform encoding.
  *
+ * Contiguous sequences of bytes may also be encoded directly into a caller-provided or growable
+ * buffer. By default, such sequences are wrapped in stream buffers which neither copy the input nor
+ * the output, and are encoded as streams. Coders may instead encode such sequences natively.
+ *
  * @author Timothy Flynn (trflynn89@pm.me)
  * @version July 7, 2019
  */
@@ -38,7 +116,8 @@ class Encoder
     virtual bool encode_string(std::string const &decoded, std::string &encoded);
 
     /**
-     * Encode a file.
+     * Encode a file. On Linux, the input file is memory mapped, so it must not be truncated by
+     * another process (e.g. by log rotation) until encoding is complete.
      *
      * @param decoded Path holding the contents to encode.
      * @param encoded Path to store the encoded contents.
@@ -48,7 +127,68 @@ class Encoder
     virtual bool
     encode_file(std::filesystem::path const &decoded, std::filesystem::path const &encoded);
 
+    /**
+     * Encode a sequence of bytes into a caller-provided buffer. Encoding fails if the buffer is
+     * not large enough to hold the encoded contents; a buffer of max_encoded_size(decoded.size())
+     * bytes is always large enough.
+     *
+     * @param decoded Buffer holding the contents to encode.
+     * @param encoded Buffer to store the encoded contents.
+     *
+     * @return If successful, the number of bytes written to the encoded buffer. Otherwise, an
+     *         uninitialized value.
+     */
+    std::optional<std::size_t>
+    encode_buffer(std::span<std::byte const> decoded, std::span<std::byte> encoded);
+
+    /**
+     * Encode a sequence of bytes into a growable buffer. The buffer is resized to hold exactly the
+     * encoded contents.
+     *
+     * @param decoded Buffer holding the contents to encode.
+     * @param encoded Buffer to store the encoded contents.
+     *
+     * @return True if the input buffer was successfully encoded.
+     */
+    bool encode_buffer(std::span<std::byte const> decoded, std::vector<std::byte> &encoded);
+
+    /**
+     * Compute an upper bound of the size of the encoding of a sequence of bytes, for preallocating
+     * buffers to encode into. By default, the bound is twice the size of the sequence plus a fixed
+     * overhead for headers. Encoders whose output may exceed that bound must override this method.
+     *
+     * @param decoded_size The size of the sequence to encode.
+     *
+     * @return The maximum size of the encoded sequence.
+     */
+    virtual std::size_t max_encoded_size(std::size_t decoded_size) const;
+
+    /**
+     * Create a session to incrementally encode a sequence of bytes which is provided in pieces. By
+     * default, the session buffers the entire sequence, and encodes it with the stream interface
+     * once finished. Encoders should override this method to encode the sequence incrementally.
+     *
+     * @param encoded Stream to store the encoded contents. Must outlive the session.
+     *
+     * @return The created session. By default, the session references this encoder, which must
+     *         then outlive the session.
+     */
+    virtual std::unique_ptr<EncoderSession> create_encoder_session(std::ostream &encoded);
+
 protected:
+    /**
+     * Encode a sequence of bytes into a buffer. By default, the buffers are wrapped in streams and
+     * encoded with encode_internal.
+     *
+     * @param decoded Buffer holding the contents to encode.
+     * @param encoded Buffer to store the encoded contents.
+     *
+     * @return If successful, the number of bytes written to the encoded buffer. Otherwise, an
+     *         uninitialized value.
+     */
+    virtual std::optional<std::size_t>
+    encode_span(std::span<std::byte const> decoded, std::span<std::byte> encoded);
+
     /**
      * Encode a stream.
      *
@@ -58,6 +198,36 @@ class Encoder
      * @return True if the input stream was successfully encoded.
      */
     virtual bool encode_internal(std::istream &decoded, std::ostream &encoded) = 0;
+
+private:
+    /**
+     * Encode a file by mapping both files into memory, if supported by the operating system. The
+     * mapped input is encoded directly as a span into the mapped output, which is presized to the
+     * maximum encoded size and then truncated to the encoded size.
+     *
+     * @param decoded Path holding the contents to encode.
+     * @param encoded Path to store the encoded contents.
+     *
+     * @return If the files could be mapped, whether the input file was successfully encoded.
+     *         Otherwise, an uninitialized value, in which case the files should be encoded as
+     *         streams.
+     */
+    std::optional<bool>
+    encode_mapped_file(std::filesystem::path const &decoded, std::filesystem::path const &encoded);
+
+    /**
+     * Encode a sequence of bytes into a container. The container is preallocated to the maximum
+     * encoded size, and then resized to the encoded size.
+     *
+     * @tparam Container The container type, e.g. std::string or std::vector<std::byte>.
+     *
+     * @param decoded Buffer holding the contents to encode.
+     * @param encoded Container to store the encoded contents.
+     *
+     * @return True if the input buffer was successfully encoded.
+     */
+    template <typename Container>
+    bool encode_into_container(std::span<std::byte const> decoded, Container &encoded);
 };
 
 /**
@@ -87,6 +257,10 @@ class BinaryEncoder : public Encoder
  * Virtual interface to decode a string or file with a plaintext decoder. Coders for specific
  * algorithms should inherit from this class to perform decoding.
  *
+ * Contiguous sequences of bytes may also be decoded directly into a caller-provided or growable
+ * buffer. By default, such sequences are wrapped in stream buffers which neither copy the input nor
+ * the output, and are decoded as streams. Coders may instead decode such sequences natively.
+ *
  * @author Timothy Flynn (trflynn89@pm.me)
  * @version July 7, 2019
  */
@@ -109,7 +283,8 @@ class Decoder
     bool decode_string(std::string const &encoded, std::string &decoded);
 
     /**
-     * Decode a file.
+     * Decode a file. On Linux, the input file is memory mapped, so it must not be truncated by
+     * another process (e.g. by log rotation) until decoding is complete.
      *
      * @param encoded Path holding the contents to decode.
      * @param decoded Path to store the decoded contents.
@@ -118,7 +293,70 @@ class Decoder
      */
     bool decode_file(std::filesystem::path const &encoded, std::filesystem::path const &decoded);
 
+    /**
+     * Decode a sequence of bytes into a caller-provided buffer. Decoding fails if the buffer is
+     * not large enough to hold the decoded contents; a buffer of max_decoded_size(encoded.size())
+     * bytes is always large enough.
+     *
+     * @param encoded Buffer holding the contents to decode.
+     * @param decoded Buffer to store the decoded contents.
+     *
+     * @return If successful, the number of bytes written to the decoded buffer. Otherwise, an
+     *         uninitialized value.
+     */
+    std::optional<std::size_t>
+    decode_buffer(std::span<std::byte const> encoded, std::span<std::byte> decoded);
+
+    /**
+     * Decode a sequence of bytes into a growable buffer. The buffer is grown as the contents are
+     * decoded, rather than preallocated, as the maximum decoded size may be much larger than the
+     * actual decoded size. The buffer is resized to hold exactly the decoded contents.
+     *
+     * @param encoded Buffer holding the contents to decode.
+     * @param decoded Buffer to store the decoded contents.
+     *
+     * @return True if the input buffer was successfully decoded.
+     */
+    bool decode_buffer(std::span<std::byte const> encoded, std::vector<std::byte> &decoded);
+
+    /**
+     * Compute an upper bound of the size of the decoding of a sequence of bytes, for preallocating
+     * buffers to decode into. As the decoded size of an arbitrary decoder is unbounded, by default,
+     * the bound is the maximum value of std::size_t. Decoders should override this method with a
+     * tighter bound to allow callers to preallocate buffers.
+     *
+     * @param encoded_size The size of the sequence to decode.
+     *
+     * @return The maximum size of the decoded sequence.
+     */
+    virtual std::size_t max_decoded_size(std::size_t encoded_size) const;
+
+    /**
+     * Create a session to incrementally decode a sequence of bytes which is provided in pieces. By
+     * default, the session buffers the entire sequence, and decodes it with the stream interface
+     * once finished. Decoders should override this method to decode the sequence incrementally.
+     *
+     * @param decoded Stream to store the decoded contents. Must outlive the session.
+     *
+     * @return The created session. By default, the session references this decoder, which must
+     *         then outlive the session.
+     */
+    virtual std::unique_ptr<DecoderSession> create_decoder_session(std::ostream &decoded);
+
 protected:
+    /**
+     * Decode a sequence of bytes into a buffer. By default, the buffers are wrapped in streams and
+     * decoded with decode_internal.
+     *
+     * @param encoded Buffer holding the contents to decode.
+     * @param decoded Buffer to store the decoded contents.
+     *
+     * @return If successful, the number of bytes written to the decoded buffer. Otherwise, an
+     *         uninitialized value.
+     */
+    virtual std::optional<std::size_t>
+    decode_span(std::span<std::byte const> encoded, std::span<std::byte> decoded);
+
     /**
      * Decode a stream.
      *
@@ -128,6 +366,37 @@ class Decoder
      * @return bool True if the input stream was successfully decoded.
      */
     virtual bool decode_internal(std::istream &encoded, std::ostream &decoded) = 0;
+
+private:
+    /**
+     * Decode a file by mapping both files into memory, if supported by the operating system. The
+     * mapped output is presized to the maximum decoded size if that size is a small multiple of the
+     * encoded size, in which case the mapped input is decoded directly as a span. Otherwise, the
+     * mapped output is grown as the contents are decoded.
+     *
+     * @param encoded Path holding the contents to decode.
+     * @param decoded Path to store the decoded contents.
+     *
+     * @return If the files could be mapped, whether the input file was successfully decoded.
+     *         Otherwise, an uninitialized value, in which case the files should be decoded as
+     *         streams.
+     */
+    std::optional<bool>
+    decode_mapped_file(std::filesystem::path const &encoded, std::filesystem::path const &decoded);
+
+    /**
+     * Decode a sequence of bytes into a container. The container is grown as the contents are
+     * decoded.
+     *
+     * @tparam Container The container type, e.g. std::string or std::vector<std::byte>.
+     *
+     * @param encoded Buffer holding the contents to decode.
+     * @param decoded Container to store the decoded contents.
+     *
+     * @return True if the input buffer was successfully decoded.
+     */
+    template <typename Container>
+    bool decode_into_container(std::span<std::byte const> encoded, Container &decoded);
 };
 
 /**
@@ -19,4 +19,52 @@ length_type CoderConfig::huffman_encoder_max_code_length() const
         m_default_huffman_encoder_max_code_length);
 }
 
+//==================================================================================================
+bool CoderConfig::huffman_encoder_interleaved_streams() const
+{
+    return get_value<bool>(
+        "encoder_interleaved_streams",
+        m_default_huffman_encoder_interleaved_streams);
+}
+
+//==================================================================================================
+bool CoderConfig::huffman_encoder_adaptive_chunks() const
+{
+    return get_value<bool>("encoder_adaptive_chunks", m_default_huffman_encoder_adaptive_chunks);
+}
+
+//==================================================================================================
+std::uint32_t CoderConfig::lz77_encoder_block_size() const
+{
+    auto const block_size_kb = get_value<std::uint16_t>(
+        "lz77_encoder_block_size_kb",
+        m_default_lz77_encoder_block_size_kb);
+
+    return static_cast<std::uint32_t>(block_size_kb) << 10;
+}
+
+//==================================================================================================
+std::uint32_t CoderConfig::lz77_encoder_max_chain_length() const
+{
+    return get_value<std::uint32_t>(
+        "lz77_encoder_max_chain_length",
+        m_default_lz77_encoder_max_chain_length);
+}
+
+//==================================================================================================
+bool CoderConfig::lz77_encoder_huffman_streams() const
+{
+    return get_value<bool>("lz77_encoder_huffman_streams", m_default_lz77_encoder_huffman_streams);
+}
+
+//==================================================================================================
+std::uint32_t CoderConfig::container_encoder_frame_size() const
+{
+    auto const frame_size_kb = get_value<std::uint16_t>(
+        "container_encoder_frame_size_kb",
+        m_default_container_encoder_frame_size_kb);
+
+    return static_cast<std::uint32_t>(frame_size_kb) << 10;
+}
+
 } // namespace fly::coders
@@ -29,9 +29,49 @@ class CoderConfig : public fly::config::Config
      */
     length_type huffman_encoder_max_code_length() const;
 
+    /**
+     * @return Whether the Huffman encoder should encode each chunk as interleaved bit streams.
+     */
+    bool huffman_encoder_interleaved_streams() const;
+
+    /**
+     * @return Whether the Huffman encoder should adapt the size and maximum code length of each
+     *         chunk to the symbol statistics of the input.
+     */
+    bool huffman_encoder_adaptive_chunks() const;
+
+    /**
+     * @return LZ77 encoder block size (in bytes).
+     */
+    std::uint32_t lz77_encoder_block_size() const;
+
+    /**
+     * @return Maximum number of previous occurrences the LZ77 encoder searches for each match.
+     */
+    std::uint32_t lz77_encoder_max_chain_length() const;
+
+    /**
+     * @return Whether the LZ77 encoder should Huffman encode the literals and sequences of each
+     *         block.
+     */
+    bool lz77_encoder_huffman_streams() const;
+
+    /**
+     * @return Container encoder frame size (in bytes).
+     */
+    std::uint32_t container_encoder_frame_size() const;
+
 protected:
     std::uint16_t m_default_huffman_encoder_chunk_size_kb {256};
     length_type m_default_huffman_encoder_max_code_length {11};
+    bool m_default_huffman_encoder_interleaved_streams {false};
+    bool m_default_huffman_encoder_adaptive_chunks {false};
+
+    std::uint16_t m_default_lz77_encoder_block_size_kb {256};
+    std::uint32_t m_default_lz77_encoder_max_chain_length {16};
+    bool m_default_lz77_encoder_huffman_streams {false};
+
+    std::uint16_t m_default_container_encoder_frame_size_kb {1024};
 };
 
 } // namespace fly::coders
@@ -0,0 +1,511 @@
+#include "fly/coders/container/container_decoder.hpp"
+
+#include "fly/coders/detail/crc32c.hpp"
+#include "fly/coders/detail/stream_buffers.hpp"
+#include "fly/logger/logger.hpp"
+#include "fly/task/task_runner.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <thread>
+#include <utility>
+
+namespace fly::coders {
+
+namespace {
+
+    // Number of bytes read from an input stream at a time.
+    constexpr std::size_t s_read_size = 64 << 10;
+
+    /**
+     * Verify a frame's encoded bytes against its checksum.
+     */
+    bool verify_checksum(ContainerFrame const &frame, std::span<std::byte const> encoded)
+    {
+        if (auto const checksum = detail::crc32c(encoded); checksum != frame.m_checksum)
+        {
+            LOGW(
+                "Container frame at {} bytes has checksum {:#x}, expected {:#x}",
+                frame.m_encoded_offset,
+                checksum,
+                frame.m_checksum);
+            return false;
+        }
+
+        return true;
+    }
+
+} // namespace
+
+/**
+ * Session to incrementally decode a container. Each frame is decoded as soon as all of its encoded
+ * bytes are available, and the trailer is compared against the index of the decoded frames once it
+ * is available. Bytes which do not yet form a complete frame or trailer are held by the session.
+ */
+class ContainerDecoder::Session final : public DecoderSession
+{
+public:
+    Session(ContainerDecoder &decoder, std::ostream &decoded) :
+        m_decoder(decoder),
+        m_stream(decoded)
+    {
+    }
+
+    bool update(std::span<std::byte const> encoded) override
+    {
+        if (m_finished)
+        {
+            return false;
+        }
+
+        // If no bytes are being held, decode directly from the provided bytes, and only hold the
+        // bytes which could not yet be decoded.
+        if (m_buffer.empty())
+        {
+            auto const consumed = decode_available(encoded);
+
+            if (!consumed)
+            {
+                return fail();
+            }
+
+            auto const remaining = encoded.subspan(*consumed);
+            m_buffer.assign(remaining.begin(), remaining.end());
+        }
+        else
+        {
+            m_buffer.insert(m_buffer.end(), encoded.begin(), encoded.end());
+            auto const consumed = decode_available(m_buffer);
+
+            if (!consumed)
+            {
+                return fail();
+            }
+
+            m_buffer.erase(
+                m_buffer.begin(),
+                m_buffer.begin() + static_cast<std::ptrdiff_t>(*consumed));
+        }
+
+        return m_stream.good();
+    }
+
+    bool finish() override
+    {
+        if (std::exchange(m_finished, true))
+        {
+            return false;
+        }
+        else if (m_state != State::Complete)
+        {
+            LOGW(
+                "Container ended after {} frames without a complete trailer",
+                m_index.frames().size());
+            return false;
+        }
+
+        return m_stream.good();
+    }
+
+private:
+    enum class State : std::uint8_t
+    {
+        Header,
+        Frames,
+        Trailer,
+        Complete,
+    };
+
+    /**
+     * Decode as much of a sequence of bytes as possible.
+     *
+     * @return If successful, the number of bytes which were decoded. Otherwise, an uninitialized
+     *         value.
+     */
+    std::optional<std::size_t> decode_available(std::span<std::byte const> encoded)
+    {
+        std::size_t position = 0;
+
+        while (true)
+        {
+            auto const available = encoded.subspan(position);
+
+            switch (m_state)
+            {
+                case State::Header:
+                    if (available.size() < s_container_header_size)
+                    {
+                        return position;
+                    }
+                    else if (!ContainerIndex::decode_header(available))
+                    {
+                        return std::nullopt;
+                    }
+
+                    position += s_container_header_size;
+                    m_state = State::Frames;
+                    break;
+
+                case State::Frames:
+                {
+                    if (available.size() < ContainerFrame::s_header_size)
+                    {
+                        return position;
+                    }
+
+                    auto const header = ContainerFrame::decode(available);
+
+                    // The marker frame which begins the trailer holds the number of frames.
+                    if (header.m_decoded_size == 0)
+                    {
+                        if (header.m_encoded_size != m_index.frames().size())
+                        {
+                            LOGW(
+                                "Container index holds {} frames, but {} frames were decoded",
+                                header.m_encoded_size,
+                                m_index.frames().size());
+                            return std::nullopt;
+                        }
+
+                        m_state = State::Trailer;
+                        break;
+                    }
+
+                    std::size_t const frame_size =
+                        ContainerFrame::s_header_size + header.m_encoded_size;
+
+                    if (available.size() < frame_size)
+                    {
+                        return position;
+                    }
+
+                    ContainerFrame const &frame = m_index.append(
+                        header.m_decoded_size,
+                        header.m_encoded_size,
+                        header.m_checksum);
+
+                    auto const decoded = m_decoder.decode_frame(
+                        frame,
+                        available.subspan(ContainerFrame::s_header_size, frame.m_encoded_size));
+
+                    if (!decoded)
+                    {
+                        return std::nullopt;
+                    }
+
+                    m_stream.write(
+                        reinterpret_cast<std::ios::char_type const *>(decoded->data()),
+                        static_cast<std::streamsize>(decoded->size()));
+
+                    position += frame_size;
+                    break;
+                }
+
+                case State::Trailer:
+                {
+                    if (available.size() < ContainerIndex::trailer_size(m_index.frames().size()))
+                    {
+                        return position;
+                    }
+
+                    auto const trailer = m_index.encode_trailer();
+
+                    if (!std::equal(trailer.begin(), trailer.end(), available.begin()))
+                    {
+                        LOGW("Container trailer does not match the decoded frames");
+                        return std::nullopt;
+                    }
+
+                    position += trailer.size();
+                    m_state = State::Complete;
+                    break;
+                }
+
+                case State::Complete:
+                    if (!available.empty())
+                    {
+                        LOGW("Decoded {} bytes beyond the end of the container", available.size());
+                        return std::nullopt;
+                    }
+
+                    return position;
+            }
+        }
+    }
+
+    bool fail()
+    {
+        m_finished = true;
+        return false;
+    }
+
+    ContainerDecoder &m_decoder;
+    std::ostream &m_stream;
+
+    std::vector<std::byte> m_buffer;
+    ContainerIndex m_index;
+
+    State m_state {State::Header};
+    bool m_finished {false};
+};
+
+//==================================================================================================
+ContainerDecoder::ContainerDecoder(std::unique_ptr<Decoder> decoder) noexcept :
+    m_decoder(std::move(decoder))
+{
+}
+
+//==================================================================================================
+ContainerDecoder::ContainerDecoder(
+    std::unique_ptr<Decoder> decoder,
+    std::shared_ptr<fly::task::TaskRunner> task_runner) noexcept :
+    m_decoder(std::move(decoder)),
+    m_task_runner(std::move(task_runner))
+{
+}
+
+//==================================================================================================
+std::optional<std::size_t> ContainerDecoder::decode_range(
+    std::span<std::byte const> encoded,
+    ContainerIndex const &index,
+    std::uint64_t offset,
+    std::span<std::byte> decoded)
+{
+    if (offset >= index.decoded_size())
+    {
+        return 0;
+    }
+
+    auto const frames = index.frames();
+    auto const size = static_cast<std::size_t>(
+        std::min<std::uint64_t>(decoded.size(), index.decoded_size() - offset));
+
+    std::size_t written = 0;
+
+    for (std::size_t i = index.find(offset); written < size; ++i)
+    {
+        ContainerFrame const &frame = frames[i];
+
+        if ((frame.m_encoded_offset + frame.m_encoded_size) > encoded.size())
+        {
+            LOGW(
+                "Container frame at {} bytes extends beyond the container",
+                frame.m_encoded_offset);
+            return std::nullopt;
+        }
+
+        auto const frame_encoded = encoded.subspan(
+            static_cast<std::size_t>(frame.m_encoded_offset),
+            frame.m_encoded_size);
+
+        auto const start = static_cast<std::size_t>(offset + written - frame.m_decoded_offset);
+        auto const length = std::min<std::size_t>(frame.m_decoded_size - start, size - written);
+        auto const output = decoded.subspan(written, length);
+
+        // Frames which are entirely within the range are decoded directly into the decoded buffer.
+        if (length == frame.m_decoded_size)
+        {
+            if (!decode_frame(frame, frame_encoded, output))
+            {
+                return std::nullopt;
+            }
+        }
+        else if (auto const frame_decoded = decode_frame(frame, frame_encoded); frame_decoded)
+        {
+            std::memcpy(output.data(), frame_decoded->data() + start, length);
+        }
+        else
+        {
+            return std::nullopt;
+        }
+
+        written += length;
+    }
+
+    return written;
+}
+
+//==================================================================================================
+bool ContainerDecoder::verify(std::span<std::byte const> encoded, ContainerIndex const &index) const
+{
+    auto const frames = index.frames();
+
+    if (!m_task_runner || (frames.size() <= 1))
+    {
+        return verify_frames(encoded, frames);
+    }
+
+    std::size_t const threads = std::max(std::thread::hardware_concurrency(), 1U);
+    std::size_t const group_size = (frames.size() + threads - 1) / threads;
+
+    std::vector<std::future<bool>> groups;
+    groups.reserve(threads);
+
+    for (std::size_t start = 0; start < frames.size(); start += group_size)
+    {
+        auto const group = frames.subspan(start, std::min(group_size, frames.size() - start));
+
+        auto task = [encoded, group]() {
+            return verify_frames(encoded, group);
+        };
+
+        groups.push_back(m_task_runner->post_task_with_future(FROM_HERE, std::move(task)));
+    }
+
+    // Every group must be waited upon before any is consumed, as consuming a group may throw and
+    // the tasks reference the container and its index.
+    for (auto const &group : groups)
+    {
+        group.wait();
+    }
+
+    bool verified = true;
+
+    for (auto &group : groups)
+    {
+        verified = group.get() && verified;
+    }
+
+    return verified;
+}
+
+//==================================================================================================
+std::size_t ContainerDecoder::max_decoded_size(std::size_t encoded_size) const
+{
+    return m_decoder->max_decoded_size(encoded_size);
+}
+
+//==================================================================================================
+std::unique_ptr<DecoderSession> ContainerDecoder::create_decoder_session(std::ostream &decoded)
+{
+    return std::make_unique<Session>(*this, decoded);
+}
+
+//==================================================================================================
+std::optional<std::size_t>
+ContainerDecoder::decode_span(std::span<std::byte const> encoded, std::span<std::byte> decoded)
+{
+    detail::SpanStreamBuffer output_buffer(decoded);
+    std::ostream output(&output_buffer);
+
+    Session session(*this, output);
+
+    if (session.update(encoded) && session.finish())
+    {
+        return output_buffer.size();
+    }
+
+    return std::nullopt;
+}
+
+//==================================================================================================
+bool ContainerDecoder::decode_internal(std::istream &encoded, std::ostream &decoded)
+{
+    Session session(*this, decoded);
+    std::vector<std::byte> block(s_read_size);
+
+    while (encoded)
+    {
+        encoded.read(
+            reinterpret_cast<std::ios::char_type *>(block.data()),
+            static_cast<std::streamsize>(block.size()));
+
+        auto const size = static_cast<std::size_t>(encoded.gcount());
+
+        if (!session.update(std::span(block).first(size)))
+        {
+            return false;
+        }
+    }
+
+    return session.finish();
+}
+
+//==================================================================================================
+bool ContainerDecoder::decode_frame(
+    ContainerFrame const &frame,
+    std::span<std::byte const> encoded,
+    std::span<std::byte> decoded)
+{
+    if (!verify_checksum(frame, encoded))
+    {
+        return false;
+    }
+
+    auto const size = m_decoder->decode_buffer(encoded, decoded);
+
+    if (!size || (*size != frame.m_decoded_size))
+    {
+        LOGW("Could not decode container frame at {} bytes", frame.m_encoded_offset);
+        return false;
+    }
+
+    return true;
+}
+
+//==================================================================================================
+std::optional<std::span<std::byte const>>
+ContainerDecoder::decode_frame(ContainerFrame const &frame, std::span<std::byte const> encoded)
+{
+    if (frame.m_decoded_size > m_decoder->max_decoded_size(frame.m_encoded_size))
+    {
+        LOGW(
+            "Container frame at {} bytes has invalid decoded size {}",
+            frame.m_encoded_offset,
+            frame.m_decoded_size);
+        return std::nullopt;
+    }
+
+    m_frame_buffer.resize(frame.m_decoded_size);
+    auto const decoded = std::span(m_frame_buffer).first(frame.m_decoded_size);
+
+    if (!decode_frame(frame, encoded, decoded))
+    {
+        return std::nullopt;
+    }
+
+    return decoded;
+}
+
+//==================================================================================================
+bool ContainerDecoder::verify_frames(
+    std::span<std::byte const> encoded,
+    std::span<ContainerFrame const> frames)
+{
+    for (ContainerFrame const &frame : frames)
+    {
+        if ((frame.m_encoded_offset + frame.m_encoded_size) > encoded.size())
+        {
+            LOGW(
+                "Container frame at {} bytes extends beyond the container",
+                frame.m_encoded_offset);
+            return false;
+        }
+
+        auto const header_offset =
+            static_cast<std::size_t>(frame.m_encoded_offset) - ContainerFrame::s_header_size;
+        auto const header = ContainerFrame::decode(encoded.subspan(header_offset));
+
+        if ((header.m_decoded_size != frame.m_decoded_size) ||
+            (header.m_encoded_size != frame.m_encoded_size) ||
+            (header.m_checksum != frame.m_checksum))
+        {
+            LOGW("Container frame header at {} bytes does not match the index", header_offset);
+            return false;
+        }
+
+        auto const frame_encoded = encoded.subspan(
+            static_cast<std::size_t>(frame.m_encoded_offset),
+            frame.m_encoded_size);
+
+        if (!verify_checksum(frame, frame_encoded))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace fly::coders
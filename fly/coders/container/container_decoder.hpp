@@ -0,0 +1,182 @@
+#pragma once
+
+#include "fly/coders/coder.hpp"
+#include "fly/coders/container/container_index.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <vector>
+
+namespace fly::task {
+class TaskRunner;
+} // namespace fly::task
+
+namespace fly::coders {
+
+/**
+ * Implementation of the Decoder interface for a checksummed, seekable container of frames encoded
+ * by another encoder, as described by ContainerEncoder.
+ *
+ * Streams are decoded in a single pass: the checksum of each frame is verified before the frame is
+ * decoded by the wrapped decoder, and the trailer must index exactly the frames which were decoded.
+ *
+ * Containers which are entirely in memory (e.g. mapped files) may also be accessed randomly, given
+ * the container's ContainerIndex. Any range of the decoded sequence may be decoded by decoding only
+ * the frames which hold that range, and the frames may be verified against their checksums without
+ * decoding them. If created with a task runner, frames are verified concurrently as tasks posted to
+ * that task runner; verification then blocks the calling thread until all frames are verified.
+ * Thus, verification must not be invoked from a task running on the provided task runner, as the
+ * verification tasks could then deadlock waiting for the blocked thread.
+ *
+ * Decoder sessions buffer at most one frame of the encoded input at a time, and share the wrapped
+ * decoder with this decoder. Thus, this decoder must outlive any session it creates.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+class ContainerDecoder : public Decoder
+{
+public:
+    /**
+     * Constructor.
+     *
+     * @param decoder The decoder to decode each frame with.
+     */
+    explicit ContainerDecoder(std::unique_ptr<Decoder> decoder) noexcept;
+
+    /**
+     * Constructor. Frames will be verified concurrently.
+     *
+     * @param decoder The decoder to decode each frame with.
+     * @param task_runner Task runner for posting frame verification tasks onto.
+     */
+    ContainerDecoder(
+        std::unique_ptr<Decoder> decoder,
+        std::shared_ptr<fly::task::TaskRunner> task_runner) noexcept;
+
+    /**
+     * Decode a range of the decoded sequence from a container, decoding only the frames which hold
+     * that range. The range begins at a position within the decoded sequence, and holds as many
+     * bytes as the decoded buffer holds, or until the end of the decoded sequence.
+     *
+     * @param encoded Buffer holding the entire container.
+     * @param index The index decoded from the container.
+     * @param offset The position of the first byte to decode within the decoded sequence.
+     * @param decoded Buffer to store the decoded range.
+     *
+     * @return If successful, the number of bytes written to the decoded buffer. Otherwise, an
+     *         uninitialized value.
+     */
+    std::optional<std::size_t> decode_range(
+        std::span<std::byte const> encoded,
+        ContainerIndex const &index,
+        std::uint64_t offset,
+        std::span<std::byte> decoded);
+
+    /**
+     * Verify that every frame of a container is intact, without decoding the frames. Each frame's
+     * header must match its index entry, and each frame's encoded bytes must match its checksum.
+     *
+     * @param encoded Buffer holding the entire container.
+     * @param index The index decoded from the container.
+     *
+     * @return True if every frame was successfully verified.
+     */
+    bool verify(std::span<std::byte const> encoded, ContainerIndex const &index) const;
+
+    /**
+     * Compute an upper bound of the size of the decoding of a sequence of bytes. Frame headers and
+     * the trailer do not decode to any bytes, so the wrapped decoder's upper bound holds.
+     *
+     * @param encoded_size The size of the sequence to decode.
+     *
+     * @return The maximum size of the decoded sequence.
+     */
+    std::size_t max_decoded_size(std::size_t encoded_size) const override;
+
+    /**
+     * Create a session to incrementally decode a container.
+     *
+     * @param decoded Stream to store the decoded contents. Must outlive the session.
+     *
+     * @return The created session.
+     */
+    std::unique_ptr<DecoderSession> create_decoder_session(std::ostream &decoded) override;
+
+protected:
+    /**
+     * Decode a container held in a buffer. Frames are decoded directly from the buffer, without
+     * first being copied into a frame buffer.
+     *
+     * @param encoded Buffer holding the contents to decode.
+     * @param decoded Buffer to store the decoded contents.
+     *
+     * @return If successful, the number of bytes written to the decoded buffer. Otherwise, an
+     *         uninitialized value.
+     */
+    std::optional<std::size_t>
+    decode_span(std::span<std::byte const> encoded, std::span<std::byte> decoded) override;
+
+    /**
+     * Decode a container held in a stream.
+     *
+     * @param encoded Stream holding the contents to decode.
+     * @param decoded Stream to store the decoded contents.
+     *
+     * @return True if the input stream was successfully decoded.
+     */
+    bool decode_internal(std::istream &encoded, std::ostream &decoded) override;
+
+private:
+    class Session;
+
+    /**
+     * Verify a frame's encoded bytes against its checksum, and decode the frame into a buffer
+     * which holds exactly the frame's decoded size.
+     *
+     * @param frame The frame to decode.
+     * @param encoded Buffer holding the frame's encoded bytes.
+     * @param decoded Buffer to store the decoded frame.
+     *
+     * @return True if the frame was successfully verified and decoded.
+     */
+    bool decode_frame(
+        ContainerFrame const &frame,
+        std::span<std::byte const> encoded,
+        std::span<std::byte> decoded);
+
+    /**
+     * Verify a frame's encoded bytes against its checksum, and decode the frame into the frame
+     * buffer.
+     *
+     * @param frame The frame to decode.
+     * @param encoded Buffer holding the frame's encoded bytes.
+     *
+     * @return If successful, the decoded frame. Otherwise, an uninitialized value.
+     */
+    std::optional<std::span<std::byte const>>
+    decode_frame(ContainerFrame const &frame, std::span<std::byte const> encoded);
+
+    /**
+     * Verify a contiguous group of frames of a container.
+     *
+     * @param encoded Buffer holding the entire container.
+     * @param frames The frames to verify.
+     *
+     * @return True if every frame was successfully verified.
+     */
+    static bool
+    verify_frames(std::span<std::byte const> encoded, std::span<ContainerFrame const> frames);
+
+    std::unique_ptr<Decoder> m_decoder;
+    std::shared_ptr<fly::task::TaskRunner> m_task_runner;
+
+    std::vector<std::byte> m_frame_buffer;
+};
+
+} // namespace fly::coders
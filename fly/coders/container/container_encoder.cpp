@@ -0,0 +1,235 @@
+#include "fly/coders/container/container_encoder.hpp"
+
+#include "fly/coders/coder_config.hpp"
+#include "fly/coders/container/container_index.hpp"
+#include "fly/coders/detail/crc32c.hpp"
+#include "fly/coders/detail/stream_buffers.hpp"
+#include "fly/logger/logger.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace fly::coders {
+
+/**
+ * Session to incrementally encode a sequence of bytes into a container. The container header is
+ * written when the session is created, and each frame is encoded and written as soon as it is
+ * filled. The final frame and the trailer are written when the session is finished.
+ */
+class ContainerEncoder::Session final : public EncoderSession
+{
+public:
+    Session(ContainerEncoder &encoder, std::ostream &encoded) :
+        m_encoder(*encoder.m_encoder),
+        m_frame_size(encoder.m_frame_size),
+        m_stream(encoded)
+    {
+        std::size_t const max_frame_size =
+            (m_frame_size == 0) ? 0 : m_encoder.max_encoded_size(m_frame_size);
+
+        if ((max_frame_size == 0) || (max_frame_size > std::numeric_limits<std::uint32_t>::max()))
+        {
+            LOGW("Container frame size {} is invalid for the wrapped encoder", m_frame_size);
+            m_finished = true;
+        }
+        else
+        {
+            m_decoded_frame.resize(m_frame_size);
+            m_encoded_frame.resize(max_frame_size);
+
+            write(ContainerIndex::encode_header());
+        }
+    }
+
+    bool update(std::span<std::byte const> decoded) override
+    {
+        if (m_finished)
+        {
+            return false;
+        }
+
+        while (!decoded.empty())
+        {
+            if ((m_buffered == 0) && (decoded.size() >= m_frame_size))
+            {
+                if (!encode_frame(decoded.first(m_frame_size)))
+                {
+                    return false;
+                }
+
+                decoded = decoded.subspan(m_frame_size);
+            }
+            else
+            {
+                std::size_t const fill =
+                    std::min<std::size_t>(m_frame_size - m_buffered, decoded.size());
+                std::memcpy(m_decoded_frame.data() + m_buffered, decoded.data(), fill);
+
+                m_buffered += fill;
+                decoded = decoded.subspan(fill);
+
+                if (m_buffered == m_frame_size)
+                {
+                    m_buffered = 0;
+
+                    if (!encode_frame(m_decoded_frame))
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        return m_stream.good();
+    }
+
+    bool finish() override
+    {
+        if (std::exchange(m_finished, true))
+        {
+            return false;
+        }
+
+        if ((m_buffered > 0) && !encode_frame(std::span(m_decoded_frame).first(m_buffered)))
+        {
+            return false;
+        }
+
+        write(m_index.encode_trailer());
+        return m_stream.good();
+    }
+
+private:
+    bool encode_frame(std::span<std::byte const> frame)
+    {
+        if (m_index.frames().size() == std::numeric_limits<std::uint32_t>::max())
+        {
+            LOGW("Exceeded maximum number of container frames: {}", m_index.frames().size());
+            return fail();
+        }
+
+        auto const size = m_encoder.encode_buffer(frame, std::span(m_encoded_frame));
+
+        if (!size)
+        {
+            LOGW("Could not encode container frame {}", m_index.frames().size());
+            return fail();
+        }
+
+        auto const encoded = std::span(m_encoded_frame).first(*size);
+
+        ContainerFrame const &appended = m_index.append(
+            static_cast<std::uint32_t>(frame.size()),
+            static_cast<std::uint32_t>(encoded.size()),
+            detail::crc32c(encoded));
+
+        std::array<std::byte, ContainerFrame::s_header_size> header;
+        appended.encode(header);
+
+        write(header);
+        write(encoded);
+
+        return m_stream.good();
+    }
+
+    void write(std::span<std::byte const> bytes)
+    {
+        m_stream.write(
+            reinterpret_cast<std::ios::char_type const *>(bytes.data()),
+            static_cast<std::streamsize>(bytes.size()));
+    }
+
+    bool fail()
+    {
+        m_finished = true;
+        return false;
+    }
+
+    Encoder &m_encoder;
+    std::uint32_t const m_frame_size;
+    std::ostream &m_stream;
+
+    std::vector<std::byte> m_decoded_frame;
+    std::vector<std::byte> m_encoded_frame;
+    std::size_t m_buffered {0};
+
+    ContainerIndex m_index;
+    bool m_finished {false};
+};
+
+//==================================================================================================
+ContainerEncoder::ContainerEncoder(
+    std::shared_ptr<CoderConfig> const &config,
+    std::unique_ptr<Encoder> encoder) noexcept :
+    m_encoder(std::move(encoder)),
+    m_frame_size(config->container_encoder_frame_size())
+{
+}
+
+//==================================================================================================
+std::size_t ContainerEncoder::max_encoded_size(std::size_t decoded_size) const
+{
+    if (m_frame_size == 0)
+    {
+        return 0;
+    }
+
+    std::size_t const frames = (decoded_size + m_frame_size - 1) / m_frame_size;
+    std::size_t const max_frame_size =
+        ContainerFrame::s_header_size + m_encoder->max_encoded_size(m_frame_size);
+
+    return s_container_header_size + frames * max_frame_size +
+        static_cast<std::size_t>(ContainerIndex::trailer_size(frames));
+}
+
+//==================================================================================================
+std::unique_ptr<EncoderSession> ContainerEncoder::create_encoder_session(std::ostream &encoded)
+{
+    return std::make_unique<Session>(*this, encoded);
+}
+
+//==================================================================================================
+std::optional<std::size_t>
+ContainerEncoder::encode_span(std::span<std::byte const> decoded, std::span<std::byte> encoded)
+{
+    detail::SpanStreamBuffer output_buffer(encoded);
+    std::ostream output(&output_buffer);
+
+    Session session(*this, output);
+
+    if (session.update(decoded) && session.finish())
+    {
+        return output_buffer.size();
+    }
+
+    return std::nullopt;
+}
+
+//==================================================================================================
+bool ContainerEncoder::encode_internal(std::istream &decoded, std::ostream &encoded)
+{
+    Session session(*this, encoded);
+    std::vector<std::byte> frame(m_frame_size);
+
+    while (decoded)
+    {
+        decoded.read(
+            reinterpret_cast<std::ios::char_type *>(frame.data()),
+            static_cast<std::streamsize>(frame.size()));
+
+        auto const size = static_cast<std::size_t>(decoded.gcount());
+
+        if (!session.update(std::span(frame).first(size)))
+        {
+            return false;
+        }
+    }
+
+    return session.finish();
+}
+
+} // namespace fly::coders
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "fly/coders/coder.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <span>
+
+namespace fly::coders {
+
+class CoderConfig;
+
+/**
+ * Implementation of the Encoder interface for a checksummed, seekable container of frames encoded
+ * by another encoder.
+ *
+ * The input stream is split into frames of the configured frame size, each of which is encoded
+ * independently by the wrapped encoder. Thus, any frame may be decoded without decoding any other
+ * frame. The container is laid out as a header, each frame, and a trailer which indexes the frames:
+ *
+ *     | 4 bytes | 1 byte  |  Frame 1 | ... | Frame N | Trailer |
+ *     ----------------------------------------------------------
+ *     |  FLYC   | Version |          |     |         |         |
+ *
+ * Each frame is stored with a header holding the size of the frame before and after encoding, and
+ * the CRC-32C checksum of the encoded frame:
+ *
+ *     |   4 bytes    |   4 bytes    |  4 bytes |   M bytes    |
+ *     ---------------------------------------------------------
+ *     | Decoded size | Encoded size | Checksum | Encoded data |
+ *
+ * The trailer is described by ContainerIndex. Because each frame is preceded by its sizes, the
+ * container may be decoded in a single pass; because the trailer ends the container, the frames
+ * holding any range of the decoded sequence may be located from the end of the container. Neither
+ * the frames nor the trailer are repositioned after being written, so the container may be written
+ * to streams which cannot be repositioned.
+ *
+ * Encoder sessions buffer at most one frame of the input at a time, and share the wrapped encoder
+ * with this encoder. Thus, this encoder must outlive any session it creates.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+class ContainerEncoder : public Encoder
+{
+public:
+    /**
+     * Constructor.
+     *
+     * @param config Reference to coder configuration.
+     * @param encoder The encoder to encode each frame with.
+     */
+    ContainerEncoder(
+        std::shared_ptr<CoderConfig> const &config,
+        std::unique_ptr<Encoder> encoder) noexcept;
+
+    /**
+     * Compute an upper bound of the size of the encoding of a sequence of bytes. The bound assumes
+     * each frame is encoded to the wrapped encoder's upper bound of a full frame.
+     *
+     * @param decoded_size The size of the sequence to encode.
+     *
+     * @return The maximum size of the encoded sequence.
+     */
+    std::size_t max_encoded_size(std::size_t decoded_size) const override;
+
+    /**
+     * Create a session to incrementally encode a sequence of bytes into a container.
+     *
+     * @param encoded Stream to store the encoded contents. Must outlive the session.
+     *
+     * @return The created session.
+     */
+    std::unique_ptr<EncoderSession> create_encoder_session(std::ostream &encoded) override;
+
+protected:
+    /**
+     * Encode a sequence of bytes into a container. Full frames are encoded directly from the
+     * sequence, without first being copied into a frame buffer.
+     *
+     * @param decoded Buffer holding the contents to encode.
+     * @param encoded Buffer to store the encoded contents.
+     *
+     * @return If successful, the number of bytes written to the encoded buffer. Otherwise, an
+     *         uninitialized value.
+     */
+    std::optional<std::size_t>
+    encode_span(std::span<std::byte const> decoded, std::span<std::byte> encoded) override;
+
+    /**
+     * Encode a stream into a container.
+     *
+     * @param decoded Stream holding the contents to encode.
+     * @param encoded Stream to store the encoded contents.
+     *
+     * @return True if the input stream was successfully encoded.
+     */
+    bool encode_internal(std::istream &decoded, std::ostream &encoded) override;
+
+private:
+    class Session;
+
+    std::unique_ptr<Encoder> m_encoder;
+    std::uint32_t const m_frame_size;
+};
+
+} // namespace fly::coders
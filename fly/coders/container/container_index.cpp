@@ -0,0 +1,247 @@
+#include "fly/coders/container/container_index.hpp"
+
+#include "fly/coders/detail/crc32c.hpp"
+#include "fly/logger/logger.hpp"
+#include "fly/types/numeric/endian.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <iterator>
+
+namespace fly::coders {
+
+namespace {
+
+    std::uint32_t decode_word(std::byte const *encoded)
+    {
+        std::uint32_t word;
+        std::memcpy(&word, encoded, sizeof(word));
+
+        return endian_swap_if_non_native<std::endian::big>(word);
+    }
+
+    void encode_word(std::uint32_t word, std::byte *encoded)
+    {
+        word = endian_swap_if_non_native<std::endian::big>(word);
+        std::memcpy(encoded, &word, sizeof(word));
+    }
+
+} // namespace
+
+//==================================================================================================
+ContainerFrame ContainerFrame::decode(std::span<std::byte const> encoded)
+{
+    ContainerFrame frame;
+    frame.m_decoded_size = decode_word(encoded.data());
+    frame.m_encoded_size = decode_word(encoded.data() + sizeof(std::uint32_t));
+    frame.m_checksum = decode_word(encoded.data() + sizeof(std::uint32_t) * 2);
+
+    return frame;
+}
+
+//==================================================================================================
+void ContainerFrame::encode(std::span<std::byte> encoded) const
+{
+    encode_word(m_decoded_size, encoded.data());
+    encode_word(m_encoded_size, encoded.data() + sizeof(std::uint32_t));
+    encode_word(m_checksum, encoded.data() + sizeof(std::uint32_t) * 2);
+}
+
+//==================================================================================================
+std::optional<ContainerIndex> ContainerIndex::create(std::span<std::byte const> encoded)
+{
+    if (encoded.size() < (s_container_header_size + trailer_size(0)))
+    {
+        LOGW("Container of {} bytes is too small to hold a header and trailer", encoded.size());
+        return std::nullopt;
+    }
+    else if (!decode_header(encoded))
+    {
+        return std::nullopt;
+    }
+
+    // Decode the footer.
+    auto const *footer = encoded.data() + encoded.size() - s_container_footer_size;
+
+    std::uint32_t const frame_count = decode_word(footer);
+    std::uint32_t const magic = decode_word(footer + sizeof(std::uint32_t));
+
+    if (magic != s_container_magic)
+    {
+        LOGW("Decoded invalid container footer magic {:#x}", magic);
+        return std::nullopt;
+    }
+    else if ((s_container_header_size + trailer_size(frame_count)) > encoded.size())
+    {
+        LOGW("Decoded invalid container frame count {}", frame_count);
+        return std::nullopt;
+    }
+
+    // Decode the marker frame which precedes the index entries.
+    std::size_t const index_size = frame_count * ContainerFrame::s_header_size;
+    std::size_t const marker_offset = encoded.size() - trailer_size(frame_count);
+
+    auto const index = encoded.subspan(marker_offset + ContainerFrame::s_header_size, index_size);
+    auto const marker = ContainerFrame::decode(encoded.subspan(marker_offset));
+
+    if ((marker.m_decoded_size != 0) || (marker.m_encoded_size != frame_count))
+    {
+        LOGW("Decoded invalid container index marker");
+        return std::nullopt;
+    }
+    else if (auto const checksum = detail::crc32c(index); checksum != marker.m_checksum)
+    {
+        LOGW("Container index checksum {:#x} does not match {:#x}", checksum, marker.m_checksum);
+        return std::nullopt;
+    }
+
+    // Decode the index entries.
+    ContainerIndex result;
+    result.m_frames.reserve(frame_count);
+
+    for (std::size_t offset = 0; offset < index_size; offset += ContainerFrame::s_header_size)
+    {
+        auto const frame = ContainerFrame::decode(index.subspan(offset));
+
+        if (frame.m_decoded_size == 0)
+        {
+            LOGW("Decoded invalid container frame size {}", frame.m_decoded_size);
+            return std::nullopt;
+        }
+
+        result.append(frame.m_decoded_size, frame.m_encoded_size, frame.m_checksum);
+
+        if (result.m_encoded_size > marker_offset)
+        {
+            LOGW("Container frame {} extends beyond the container index", result.m_frames.size());
+            return std::nullopt;
+        }
+    }
+
+    if (result.m_encoded_size != marker_offset)
+    {
+        LOGW(
+            "Container frames end at {} bytes, but the index begins at {} bytes",
+            result.m_encoded_size,
+            marker_offset);
+        return std::nullopt;
+    }
+
+    return result;
+}
+
+//==================================================================================================
+std::array<std::byte, s_container_header_size> ContainerIndex::encode_header()
+{
+    std::array<std::byte, s_container_header_size> header;
+
+    encode_word(s_container_magic, header.data());
+    header[sizeof(std::uint32_t)] = static_cast<std::byte>(s_container_version);
+
+    return header;
+}
+
+//==================================================================================================
+bool ContainerIndex::decode_header(std::span<std::byte const> encoded)
+{
+    std::uint32_t const magic = decode_word(encoded.data());
+    auto const version = static_cast<std::uint8_t>(encoded[sizeof(std::uint32_t)]);
+
+    if (magic != s_container_magic)
+    {
+        LOGW("Decoded invalid container header magic {:#x}", magic);
+        return false;
+    }
+    else if (version != s_container_version)
+    {
+        LOGW("Decoded invalid container version {}", version);
+        return false;
+    }
+
+    return true;
+}
+
+//==================================================================================================
+std::uint64_t ContainerIndex::trailer_size(std::uint64_t frame_count)
+{
+    return (frame_count + 1) * ContainerFrame::s_header_size + s_container_footer_size;
+}
+
+//==================================================================================================
+ContainerFrame const &ContainerIndex::append(
+    std::uint32_t decoded_size,
+    std::uint32_t encoded_size,
+    std::uint32_t checksum)
+{
+    ContainerFrame &frame = m_frames.emplace_back();
+    frame.m_decoded_size = decoded_size;
+    frame.m_encoded_size = encoded_size;
+    frame.m_checksum = checksum;
+    frame.m_decoded_offset = m_decoded_size;
+    frame.m_encoded_offset = m_encoded_size + ContainerFrame::s_header_size;
+
+    m_decoded_size += decoded_size;
+    m_encoded_size = frame.m_encoded_offset + encoded_size;
+
+    return frame;
+}
+
+//==================================================================================================
+std::vector<std::byte> ContainerIndex::encode_trailer() const
+{
+    std::vector<std::byte> trailer(static_cast<std::size_t>(trailer_size(m_frames.size())));
+    auto const index = std::span(trailer).subspan(ContainerFrame::s_header_size);
+
+    for (std::size_t i = 0; i < m_frames.size(); ++i)
+    {
+        m_frames[i].encode(index.subspan(i * ContainerFrame::s_header_size));
+    }
+
+    auto const index_size = m_frames.size() * ContainerFrame::s_header_size;
+
+    ContainerFrame marker;
+    marker.m_encoded_size = static_cast<std::uint32_t>(m_frames.size());
+    marker.m_checksum = detail::crc32c(index.first(index_size));
+    marker.encode(trailer);
+
+    auto *footer = trailer.data() + trailer.size() - s_container_footer_size;
+    encode_word(static_cast<std::uint32_t>(m_frames.size()), footer);
+    encode_word(s_container_magic, footer + sizeof(std::uint32_t));
+
+    return trailer;
+}
+
+//==================================================================================================
+std::size_t ContainerIndex::find(std::uint64_t decoded_offset) const
+{
+    if (decoded_offset >= m_decoded_size)
+    {
+        return m_frames.size();
+    }
+
+    // Find the first frame which begins after the offset; the offset is within the frame before it.
+    auto const it = std::upper_bound(
+        m_frames.begin(),
+        m_frames.end(),
+        decoded_offset,
+        [](std::uint64_t offset, ContainerFrame const &frame) {
+            return offset < frame.m_decoded_offset;
+        });
+
+    return static_cast<std::size_t>(std::distance(m_frames.begin(), it)) - 1;
+}
+
+//==================================================================================================
+std::span<ContainerFrame const> ContainerIndex::frames() const
+{
+    return m_frames;
+}
+
+//==================================================================================================
+std::uint64_t ContainerIndex::decoded_size() const
+{
+    return m_decoded_size;
+}
+
+} // namespace fly::coders
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace fly::coders {
+
+// Magic number which begins and ends every container ("FLYC").
+inline constexpr std::uint32_t s_container_magic = 0x464c'5943;
+
+// Version of the container format.
+inline constexpr std::uint8_t s_container_version = 1;
+
+// Size of the container header: the magic number and the container version (in bytes).
+inline constexpr std::size_t s_container_header_size = sizeof(std::uint32_t) + sizeof(std::uint8_t);
+
+// Size of the container footer: the number of frames and the magic number (in bytes).
+inline constexpr std::size_t s_container_footer_size = sizeof(std::uint32_t) * 2;
+
+/**
+ * Struct to store the sizes, checksum, and location of a single frame of a container. The sizes and
+ * checksum are stored as the frame's header, and as the frame's entry in the container's index.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+struct ContainerFrame
+{
+    // Size of the encoded sizes and checksum (in bytes).
+    static constexpr std::size_t s_header_size = sizeof(std::uint32_t) * 3;
+
+    /**
+     * Decode the sizes and checksum of a frame from a sequence of bytes. The sequence must hold at
+     * least ContainerFrame::s_header_size bytes.
+     *
+     * @param encoded Buffer holding the encoded sizes and checksum.
+     *
+     * @return The decoded frame. Its location is left zero-filled.
+     */
+    static ContainerFrame decode(std::span<std::byte const> encoded);
+
+    /**
+     * Encode the sizes and checksum of the frame into a sequence of bytes. The sequence must hold
+     * at least ContainerFrame::s_header_size bytes.
+     *
+     * @param encoded Buffer to store the encoded sizes and checksum.
+     */
+    void encode(std::span<std::byte> encoded) const;
+
+    // The number of bytes the frame decodes to. Zero for the marker which precedes the index.
+    std::uint32_t m_decoded_size {0};
+
+    // The number of encoded bytes following the frame's header.
+    std::uint32_t m_encoded_size {0};
+
+    // The CRC-32C checksum of the encoded bytes following the frame's header.
+    std::uint32_t m_checksum {0};
+
+    // The position of the frame's first decoded byte within the entire decoded sequence.
+    std::uint64_t m_decoded_offset {0};
+
+    // The position of the frame's first encoded byte (after its header) within the container.
+    std::uint64_t m_encoded_offset {0};
+};
+
+/**
+ * Index of the frames of a container, for locating the frames which hold any range of the decoded
+ * sequence without decoding the preceding frames.
+ *
+ * An index is either decoded from the end of an entire container, or is formed by appending each
+ * frame as it is encoded or decoded. An index formed by appending frames may be encoded as the
+ * container's trailer, which consists of a marker frame, the index entries, and the footer:
+ *
+ *     |  4 bytes  |    4 bytes    |     4 bytes    | 12 bytes * N  |    4 bytes    |  4 bytes   |
+ *     ------------------------------------------------------------------------------------------
+ *     | Zero size | Frame count N | Index checksum | Index entries | Frame count N | Magic FLYC |
+ *
+ * Each index entry is identical to the header of its frame. The index checksum is the CRC-32C
+ * checksum of the index entries. All values are stored in big endian byte order.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+class ContainerIndex
+{
+public:
+    /**
+     * Decode the index from the trailer of an entire container. The header and trailer are
+     * validated, and the sizes of the indexed frames must account for every byte of the container.
+     * The frames themselves are not read.
+     *
+     * @param encoded Buffer holding the entire container.
+     *
+     * @return If successful, the decoded index. Otherwise, an uninitialized value.
+     */
+    static std::optional<ContainerIndex> create(std::span<std::byte const> encoded);
+
+    /**
+     * @return The encoded container header: the magic number and the container version.
+     */
+    static std::array<std::byte, s_container_header_size> encode_header();
+
+    /**
+     * Validate an encoded container header.
+     *
+     * @param encoded Buffer holding at least the container header.
+     *
+     * @return True if the header holds the magic number and a supported container version.
+     */
+    static bool decode_header(std::span<std::byte const> encoded);
+
+    /**
+     * Compute the size of the trailer of a container.
+     *
+     * @param frame_count The number of frames in the container.
+     *
+     * @return The size of the trailer (in bytes).
+     */
+    static std::uint64_t trailer_size(std::uint64_t frame_count);
+
+    /**
+     * Append a frame to the index, following the last appended frame in both the decoded sequence
+     * and the container.
+     *
+     * @param decoded_size The number of bytes the frame decodes to.
+     * @param encoded_size The number of encoded bytes following the frame's header.
+     * @param checksum The CRC-32C checksum of the frame's encoded bytes.
+     *
+     * @return The appended frame.
+     */
+    ContainerFrame const &
+    append(std::uint32_t decoded_size, std::uint32_t encoded_size, std::uint32_t checksum);
+
+    /**
+     * @return The encoded container trailer, which indexes every appended frame.
+     */
+    std::vector<std::byte> encode_trailer() const;
+
+    /**
+     * Find the frame which holds a byte of the decoded sequence.
+     *
+     * @param decoded_offset The position of the byte within the decoded sequence.
+     *
+     * @return The index of the frame holding the byte, or the number of frames if the position is
+     *         beyond the end of the decoded sequence.
+     */
+    std::size_t find(std::uint64_t decoded_offset) const;
+
+    /**
+     * @return The indexed frames, in the order they appear in the container.
+     */
+    std::span<ContainerFrame const> frames() const;
+
+    /**
+     * @return The total number of bytes the indexed frames decode to.
+     */
+    std::uint64_t decoded_size() const;
+
+private:
+    std::vector<ContainerFrame> m_frames;
+
+    std::uint64_t m_decoded_size {0};
+    std::uint64_t m_encoded_size {s_container_header_size};
+};
+
+} // namespace fly::coders
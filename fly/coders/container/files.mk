@@ -0,0 +1,4 @@
+SRC_$(d) := \
+    $(d)/container_decoder.cpp \
+    $(d)/container_encoder.cpp \
+    $(d)/container_index.cpp
@@ -0,0 +1,204 @@
+#include "fly/coders/detail/crc32c.hpp"
+
+#include "fly/system/cpu_features.hpp"
+
+#include <array>
+#include <cstring>
+
+namespace fly::detail {
+
+namespace {
+
+    // The CRC-32C polynomial, in reversed bit order.
+    constexpr std::uint32_t s_polynomial = 0x82f6'3b78;
+
+    // Number of bytes in each of the 3 parts of the sequence which are checksummed at once.
+    constexpr std::size_t s_lane_size = 4 << 10;
+
+    using crc32c_kernel = std::uint32_t (*)(std::byte const *, std::size_t, std::uint32_t);
+
+    using SlicingTables = std::array<std::array<std::uint32_t, 256>, 8>;
+
+    /**
+     * Create the lookup tables for slicing-by-8. The first table holds the checksum of each byte,
+     * and each subsequent table holds the checksum of each byte followed by one more zero byte than
+     * the previous table.
+     */
+    constexpr SlicingTables create_slicing_tables()
+    {
+        SlicingTables tables {};
+
+        for (std::uint32_t i = 0; i < 256; ++i)
+        {
+            std::uint32_t crc = i;
+
+            for (int bit = 0; bit < 8; ++bit)
+            {
+                crc = (crc & 1) ? ((crc >> 1) ^ s_polynomial) : (crc >> 1);
+            }
+
+            tables[0][i] = crc;
+        }
+
+        for (std::size_t table = 1; table < tables.size(); ++table)
+        {
+            for (std::size_t i = 0; i < 256; ++i)
+            {
+                std::uint32_t const previous = tables[table - 1][i];
+                tables[table][i] = (previous >> 8) ^ tables[0][previous & 0xff];
+            }
+        }
+
+        return tables;
+    }
+
+    constexpr SlicingTables s_slicing_tables = create_slicing_tables();
+
+    /**
+     * Multiply two polynomials modulo the CRC-32C polynomial, all in reversed bit order.
+     */
+    constexpr std::uint32_t multiply(std::uint32_t a, std::uint32_t b)
+    {
+        std::uint32_t product = 0;
+
+        for (std::uint32_t mask = 1U << 31; mask != 0; mask >>= 1)
+        {
+            if (a & mask)
+            {
+                product ^= b;
+            }
+
+            b = (b & 1) ? ((b >> 1) ^ s_polynomial) : (b >> 1);
+        }
+
+        return product;
+    }
+
+    /**
+     * Compute x^(8n) modulo the CRC-32C polynomial, in reversed bit order. Multiplying a checksum
+     * by this value computes the checksum of the same sequence followed by n zero bytes.
+     */
+    constexpr std::uint32_t zero_bytes_operator(std::size_t bytes)
+    {
+        std::uint32_t result = 1U << 31;
+        std::uint32_t power = 1U << 30;
+
+        for (std::size_t bits = bytes * 8; bits > 0; bits >>= 1)
+        {
+            if (bits & 1)
+            {
+                result = multiply(result, power);
+            }
+
+            power = multiply(power, power);
+        }
+
+        return result;
+    }
+
+    constexpr std::uint32_t s_lane_operator = zero_bytes_operator(s_lane_size);
+
+    /**
+     * Checksum a sequence of bytes with slicing-by-8 lookup tables, 8 bytes at a time.
+     */
+    std::uint32_t crc32c_scalar(std::byte const *data, std::size_t size, std::uint32_t crc)
+    {
+        auto const &tables = s_slicing_tables;
+
+        auto const byte = [&data](std::size_t index) {
+            return static_cast<std::uint32_t>(data[index]);
+        };
+
+        for (; size >= 8; data += 8, size -= 8)
+        {
+            crc ^= byte(0) | (byte(1) << 8) | (byte(2) << 16) | (byte(3) << 24);
+
+            crc = tables[7][crc & 0xff] ^ tables[6][(crc >> 8) & 0xff] ^
+                tables[5][(crc >> 16) & 0xff] ^ tables[4][crc >> 24] ^ tables[3][byte(4)] ^
+                tables[2][byte(5)] ^ tables[1][byte(6)] ^ tables[0][byte(7)];
+        }
+
+        for (; size > 0; ++data, --size)
+        {
+            crc = tables[0][(crc ^ byte(0)) & 0xff] ^ (crc >> 8);
+        }
+
+        return crc;
+    }
+
+#if defined(FLY_X86_64)
+
+    /**
+     * Checksum a sequence of bytes with the SSE4.2 CRC-32C instruction. The instruction has a
+     * latency of 3 cycles, but a throughput of 1 per cycle, so large sequences are checksummed as
+     * 3 independent parts at once. The checksums of the parts are then combined by shifting the
+     * checksums of the earlier parts over the length of the later parts.
+     */
+    FLY_TARGET("sse4.2") std::uint32_t
+    crc32c_sse42(std::byte const *data, std::size_t size, std::uint32_t crc)
+    {
+        auto const load = [](std::byte const *bytes) {
+            std::uint64_t word;
+            std::memcpy(&word, bytes, sizeof(word));
+            return word;
+        };
+
+        for (; size >= (s_lane_size * 3); data += s_lane_size * 3, size -= s_lane_size * 3)
+        {
+            std::uint64_t crc0 = crc;
+            std::uint64_t crc1 = 0;
+            std::uint64_t crc2 = 0;
+
+            for (std::size_t i = 0; i < s_lane_size; i += sizeof(std::uint64_t))
+            {
+                crc0 = _mm_crc32_u64(crc0, load(data + i));
+                crc1 = _mm_crc32_u64(crc1, load(data + s_lane_size + i));
+                crc2 = _mm_crc32_u64(crc2, load(data + s_lane_size * 2 + i));
+            }
+
+            crc = multiply(s_lane_operator, static_cast<std::uint32_t>(crc0)) ^
+                static_cast<std::uint32_t>(crc1);
+            crc = multiply(s_lane_operator, crc) ^ static_cast<std::uint32_t>(crc2);
+        }
+
+        std::uint64_t crc64 = crc;
+
+        for (; size >= sizeof(std::uint64_t); data += sizeof(std::uint64_t), size -= sizeof(crc64))
+        {
+            crc64 = _mm_crc32_u64(crc64, load(data));
+        }
+
+        crc = static_cast<std::uint32_t>(crc64);
+
+        for (; size > 0; ++data, --size)
+        {
+            crc = _mm_crc32_u8(crc, static_cast<std::uint8_t>(*data));
+        }
+
+        return crc;
+    }
+
+#endif
+
+    crc32c_kernel select_kernel()
+    {
+#if defined(FLY_X86_64)
+        if (fly::system::cpu_features().m_sse42)
+        {
+            return crc32c_sse42;
+        }
+#endif
+
+        return crc32c_scalar;
+    }
+
+} // namespace
+
+//==================================================================================================
+std::uint32_t crc32c(std::span<std::byte const> data, std::uint32_t crc)
+{
+    static crc32c_kernel const s_kernel = select_kernel();
+    return ~s_kernel(data.data(), data.size(), ~crc);
+}
+
+} // namespace fly::detail
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace fly::detail {
+
+/**
+ * Compute the CRC-32C (Castagnoli) checksum of a sequence of bytes.
+ *
+ * On x86-64 CPUs which support SSE4.2, the checksum is computed with the CPU's CRC-32C instruction
+ * 8 bytes at a time, over 3 independent parts of the sequence at once. Otherwise, it is computed
+ * with a slicing-by-8 lookup table. The implementation is chosen once at runtime.
+ *
+ * The checksum of a sequence which is provided in pieces may be computed by passing the checksum of
+ * the previous pieces as the initial checksum of the next piece.
+ *
+ * @param data The sequence of bytes to checksum.
+ * @param crc The checksum of any preceding bytes of the sequence.
+ *
+ * @return The checksum of the sequence.
+ */
+std::uint32_t crc32c(std::span<std::byte const> data, std::uint32_t crc = 0);
+
+} // namespace fly::detail
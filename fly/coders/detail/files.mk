@@ -0,0 +1,8 @@
+ifeq ($(SYSTEM), LINUX)
+    SRC_DIRS_$(d) := \
+        $(d)/nix
+endif
+
+SRC_$(d) := \
+    $(d)/crc32c.cpp \
+    $(d)/stream_buffers.cpp
@@ -0,0 +1,2 @@
+SRC_$(d) := \
+    $(d)/mapped_file.cpp
@@ -0,0 +1,244 @@
+#include "fly/coders/detail/nix/mapped_file.hpp"
+
+#include "fly/logger/logger.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+
+namespace fly::detail {
+
+namespace {
+
+    constexpr int s_output_flags = O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC;
+    constexpr mode_t s_output_mode = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH;
+
+    // Minimum size the output mapping is grown to, to avoid remapping for many small writes.
+    constexpr std::size_t s_minimum_capacity = 64 << 10;
+
+    /**
+     * Allocate disk space for a region of a file, growing the file if needed. Writing to a mapping
+     * of a sparse region of the file raises SIGBUS if the disk is full, whereas allocating the
+     * region up front fails gracefully.
+     */
+    bool allocate_output(int file, std::size_t offset, std::size_t length)
+    {
+        if (int const error =
+                ::posix_fallocate(file, static_cast<off_t>(offset), static_cast<off_t>(length));
+            error != 0)
+        {
+            errno = error;
+            LOGS("Could not allocate {} bytes of output file", offset + length);
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * Map a region of a file which is open for reading and writing.
+     */
+    void *map_output(int file, std::size_t capacity)
+    {
+        if (!allocate_output(file, 0, capacity))
+        {
+            return nullptr;
+        }
+
+        void *data = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+
+        if (data == MAP_FAILED)
+        {
+            LOGS("Could not map {} bytes of output file", capacity);
+            return nullptr;
+        }
+
+        return data;
+    }
+
+} // namespace
+
+//==================================================================================================
+std::unique_ptr<MappedInputFile> MappedInputFile::create(std::filesystem::path const &path)
+{
+    int const file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (file == -1)
+    {
+        return nullptr;
+    }
+
+    struct stat status;
+    void *data = nullptr;
+
+    // Only regular files may be mapped; other files (e.g. pipes) are read as streams.
+    bool successful = (::fstat(file, &status) == 0) && S_ISREG(status.st_mode);
+    auto const size = successful ? static_cast<std::size_t>(status.st_size) : 0;
+
+    if (successful && (size > 0))
+    {
+        data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+
+        if (data == MAP_FAILED)
+        {
+            LOGS("Could not map {} bytes of input file", size);
+            successful = false;
+        }
+        else
+        {
+            ::madvise(data, size, MADV_SEQUENTIAL);
+        }
+    }
+
+    // The mapping remains valid after the file is closed.
+    ::close(file);
+
+    return successful ? std::unique_ptr<MappedInputFile>(new MappedInputFile(data, size)) : nullptr;
+}
+
+//==================================================================================================
+MappedInputFile::MappedInputFile(void *data, std::size_t size) noexcept :
+    m_data(data),
+    m_size(size)
+{
+}
+
+//==================================================================================================
+MappedInputFile::~MappedInputFile()
+{
+    if (m_size > 0)
+    {
+        ::munmap(m_data, m_size);
+    }
+}
+
+//==================================================================================================
+std::span<std::byte const> MappedInputFile::data() const
+{
+    return {static_cast<std::byte const *>(m_data), m_size};
+}
+
+//==================================================================================================
+std::unique_ptr<MappedOutputFile>
+MappedOutputFile::create(std::filesystem::path const &path, std::size_t capacity)
+{
+    int const file = ::open(path.c_str(), s_output_flags, s_output_mode);
+
+    if (file == -1)
+    {
+        return nullptr;
+    }
+
+    struct stat status;
+
+    // Only regular files may be mapped; other files (e.g. /dev/null) are written as streams.
+    if ((::fstat(file, &status) != 0) || !S_ISREG(status.st_mode))
+    {
+        ::close(file);
+        return nullptr;
+    }
+
+    void *data = nullptr;
+
+    if ((capacity > 0) && ((data = map_output(file, capacity)) == nullptr))
+    {
+        ::close(file);
+        return nullptr;
+    }
+
+    return std::unique_ptr<MappedOutputFile>(new MappedOutputFile(file, data, capacity));
+}
+
+//==================================================================================================
+MappedOutputFile::MappedOutputFile(int file, void *data, std::size_t capacity) noexcept :
+    m_file(file),
+    m_data(data),
+    m_capacity(capacity)
+{
+}
+
+//==================================================================================================
+MappedOutputFile::~MappedOutputFile()
+{
+    close(size());
+}
+
+//==================================================================================================
+std::span<std::byte> MappedOutputFile::data()
+{
+    return {static_cast<std::byte *>(m_data), m_capacity};
+}
+
+//==================================================================================================
+bool MappedOutputFile::close(std::size_t size)
+{
+    if (m_file == -1)
+    {
+        return false;
+    }
+
+    bool successful = true;
+
+    if (m_capacity > 0)
+    {
+        ::munmap(m_data, m_capacity);
+
+        m_data = nullptr;
+        m_capacity = 0;
+    }
+
+    if (::ftruncate(m_file, static_cast<off_t>(size)) == -1)
+    {
+        LOGS("Could not truncate output file to {} bytes", size);
+        successful = false;
+    }
+
+    ::close(m_file);
+    m_file = -1;
+
+    return successful;
+}
+
+//==================================================================================================
+auto MappedOutputFile::reserve(std::size_t size) -> char_type *
+{
+    if (size <= m_capacity)
+    {
+        return static_cast<char_type *>(m_data);
+    }
+    else if (m_file == -1)
+    {
+        return nullptr;
+    }
+
+    auto const capacity = std::max({size, m_capacity * 2, s_minimum_capacity});
+    void *data = nullptr;
+
+    if (m_capacity == 0)
+    {
+        data = map_output(m_file, capacity);
+    }
+    else if (allocate_output(m_file, m_capacity, capacity - m_capacity))
+    {
+        if (data = ::mremap(m_data, m_capacity, capacity, MREMAP_MAYMOVE); data == MAP_FAILED)
+        {
+            LOGS("Could not remap output file to {} bytes", capacity);
+            data = nullptr;
+        }
+    }
+
+    if (data == nullptr)
+    {
+        return nullptr;
+    }
+
+    m_data = data;
+    m_capacity = capacity;
+    return static_cast<char_type *>(m_data);
+}
+
+} // namespace fly::detail
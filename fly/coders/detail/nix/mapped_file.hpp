@@ -0,0 +1,112 @@
+#pragma once
+
+#include "fly/coders/detail/stream_buffers.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <span>
+
+namespace fly::detail {
+
+/**
+ * Read-only memory mapping of an entire file, allowing coders to read the file's contents directly
+ * rather than copying them through a file stream.
+ *
+ * The file must not be truncated by another process while it is mapped (e.g. by log rotation).
+ * Reading a page of the mapping which lies beyond the truncated end of the file raises SIGBUS.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+class MappedInputFile
+{
+public:
+    /**
+     * Map a file into memory.
+     *
+     * @param path Path to the file to map.
+     *
+     * @return If successful, the mapped file. Otherwise, null.
+     */
+    static std::unique_ptr<MappedInputFile> create(std::filesystem::path const &path);
+
+    /**
+     * Destructor. Unmap the file.
+     */
+    ~MappedInputFile();
+
+    MappedInputFile(MappedInputFile const &) = delete;
+    MappedInputFile &operator=(MappedInputFile const &) = delete;
+
+    /**
+     * @return The contents of the mapped file.
+     */
+    std::span<std::byte const> data() const;
+
+private:
+    MappedInputFile(void *data, std::size_t size) noexcept;
+
+    void *m_data;
+    std::size_t m_size;
+};
+
+/**
+ * Stream buffer for writing to a memory mapping of a file. The file is created (or truncated) and
+ * presized to an initial capacity, which may be written to directly. When written to as a stream
+ * buffer, the file and its mapping are grown geometrically as needed. Once writing is complete, the
+ * file is truncated to the number of bytes that were actually written.
+ *
+ * Disk space for the mapping is allocated before the file is mapped or grown, rather than leaving
+ * the file sparse. If the disk is full, creating or growing the file fails instead of writing to
+ * the mapping raising SIGBUS.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+class MappedOutputFile final : public OutputStreamBuffer
+{
+public:
+    /**
+     * Create or truncate a file, and map the file into memory with an initial capacity.
+     *
+     * @param path Path to the file to map.
+     * @param capacity The initial size of the file and its mapping (in bytes).
+     *
+     * @return If successful, the mapped file. Otherwise, null.
+     */
+    static std::unique_ptr<MappedOutputFile>
+    create(std::filesystem::path const &path, std::size_t capacity);
+
+    /**
+     * Destructor. Close the file if it has not already been closed, truncating it to the number of
+     * bytes written as a stream buffer.
+     */
+    ~MappedOutputFile() override;
+
+    /**
+     * @return The entire mapped capacity of the file, for callers that write to the file directly.
+     */
+    std::span<std::byte> data();
+
+    /**
+     * Unmap the file and truncate it to its final size. The file may not be written to afterwards.
+     *
+     * @param size The number of bytes that were written to the file.
+     *
+     * @return True if the file was successfully truncated and closed.
+     */
+    bool close(std::size_t size);
+
+protected:
+    char_type *reserve(std::size_t size) override;
+
+private:
+    MappedOutputFile(int file, void *data, std::size_t capacity) noexcept;
+
+    int m_file;
+    void *m_data;
+    std::size_t m_capacity;
+};
+
+} // namespace fly::detail
@@ -0,0 +1,122 @@
+#include "fly/coders/detail/stream_buffers.hpp"
+
+#include <cstring>
+
+namespace fly::detail {
+
+//==================================================================================================
+InputStreamBuffer::InputStreamBuffer(std::span<std::byte const> buffer) noexcept
+{
+    // The get area is never written to, so it is safe to cast away the constness of the buffer.
+    auto *data = const_cast<char_type *>(reinterpret_cast<char_type const *>(buffer.data()));
+    setg(data, data, data + buffer.size());
+}
+
+//==================================================================================================
+void QueueStreamBuffer::append(std::span<std::byte const> buffer)
+{
+    auto consumed = static_cast<std::size_t>(gptr() - eback());
+
+    // Only discard the bytes which have been read once they make up at least half of the stream
+    // buffer, so that the cost of moving the unread bytes is amortized over the appended bytes.
+    if ((consumed > 0) && (consumed >= (m_buffer.size() / 2)))
+    {
+        m_buffer.erase(m_buffer.begin(), m_buffer.begin() + static_cast<std::ptrdiff_t>(consumed));
+        consumed = 0;
+    }
+
+    auto const *data = reinterpret_cast<char_type const *>(buffer.data());
+    m_buffer.insert(m_buffer.end(), data, data + buffer.size());
+
+    setg(m_buffer.data(), m_buffer.data() + consumed, m_buffer.data() + m_buffer.size());
+}
+
+//==================================================================================================
+std::size_t QueueStreamBuffer::available() const
+{
+    return static_cast<std::size_t>(egptr() - gptr());
+}
+
+//==================================================================================================
+std::size_t OutputStreamBuffer::size() const
+{
+    return m_size;
+}
+
+//==================================================================================================
+std::streamsize OutputStreamBuffer::xsputn(char_type const *data, std::streamsize size)
+{
+    auto const bytes = static_cast<std::size_t>(size);
+    char_type *buffer = reserve(m_position + bytes);
+
+    if (buffer == nullptr)
+    {
+        return 0;
+    }
+
+    std::memcpy(buffer + m_position, data, bytes);
+    m_position += bytes;
+    m_size = std::max(m_size, m_position);
+
+    return size;
+}
+
+//==================================================================================================
+auto OutputStreamBuffer::overflow(int_type ch) -> int_type
+{
+    if (traits_type::eq_int_type(ch, traits_type::eof()))
+    {
+        return traits_type::not_eof(ch);
+    }
+
+    char_type const data = traits_type::to_char_type(ch);
+    return (xsputn(&data, 1) == 1) ? ch : traits_type::eof();
+}
+
+//==================================================================================================
+auto OutputStreamBuffer::seekoff(
+    off_type offset,
+    std::ios::seekdir direction,
+    std::ios::openmode mode) -> pos_type
+{
+    off_type base = 0;
+
+    if (direction == std::ios::cur)
+    {
+        base = static_cast<off_type>(m_position);
+    }
+    else if (direction == std::ios::end)
+    {
+        base = static_cast<off_type>(m_size);
+    }
+
+    return seekpos(pos_type(base + offset), mode);
+}
+
+//==================================================================================================
+auto OutputStreamBuffer::seekpos(pos_type position, std::ios::openmode mode) -> pos_type
+{
+    auto const offset = static_cast<off_type>(position);
+
+    if (((mode & std::ios::out) == 0) || (offset < 0) ||
+        (static_cast<std::size_t>(offset) > m_size))
+    {
+        return pos_type(off_type(-1));
+    }
+
+    m_position = static_cast<std::size_t>(offset);
+    return position;
+}
+
+//==================================================================================================
+SpanStreamBuffer::SpanStreamBuffer(std::span<std::byte> buffer) noexcept : m_buffer(buffer)
+{
+}
+
+//==================================================================================================
+auto SpanStreamBuffer::reserve(std::size_t size) -> char_type *
+{
+    return (size > m_buffer.size()) ? nullptr : reinterpret_cast<char_type *>(m_buffer.data());
+}
+
+} // namespace fly::detail
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <ios>
+#include <span>
+#include <streambuf>
+#include <vector>
+
+namespace fly::detail {
+
+/**
+ * Stream buffer for reading from a contiguous sequence of bytes without copying the sequence.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+class InputStreamBuffer : public std::streambuf
+{
+public:
+    /**
+     * Constructor.
+     *
+     * @param buffer The sequence of bytes to read from. Must outlive this stream buffer.
+     */
+    explicit InputStreamBuffer(std::span<std::byte const> buffer) noexcept;
+};
+
+/**
+ * Stream buffer for reading from a sequence of bytes which is appended to over time, such as input
+ * which arrives in pieces. Appended bytes are copied into the stream buffer. Bytes which have been
+ * read are discarded as more bytes are appended, so the stream buffer only grows to hold the bytes
+ * which have not yet been read.
+ *
+ * Reading all of the appended bytes is indistinguishable from reaching the end of the sequence, so
+ * readers which react to the end of the sequence should only read while enough bytes are available.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+class QueueStreamBuffer final : public std::streambuf
+{
+public:
+    /**
+     * Append bytes to the end of the sequence.
+     *
+     * @param buffer The bytes to append.
+     */
+    void append(std::span<std::byte const> buffer);
+
+    /**
+     * @return The number of bytes which have been appended but not yet read.
+     */
+    std::size_t available() const;
+
+private:
+    std::vector<char_type> m_buffer;
+};
+
+/**
+ * Base class for stream buffers which write to a contiguous sequence of bytes. Writes are made
+ * directly to the sequence, and the stream buffer may be repositioned to overwrite previously
+ * written bytes (as BitStreamWriter does to write its header).
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+class OutputStreamBuffer : public std::streambuf
+{
+public:
+    /**
+     * @return The number of bytes written, i.e. the furthest position written to.
+     */
+    std::size_t size() const;
+
+protected:
+    /**
+     * Ensure the sequence can hold at least some number of bytes.
+     *
+     * @param size The number of bytes the sequence must hold.
+     *
+     * @return A pointer to the start of the sequence, or null if the sequence cannot hold the
+     *         requested number of bytes.
+     */
+    virtual char_type *reserve(std::size_t size) = 0;
+
+    std::streamsize xsputn(char_type const *data, std::streamsize size) override;
+    int_type overflow(int_type ch) override;
+
+    pos_type
+    seekoff(off_type offset, std::ios::seekdir direction, std::ios::openmode mode) override;
+    pos_type seekpos(pos_type position, std::ios::openmode mode) override;
+
+private:
+    std::size_t m_position {0};
+    std::size_t m_size {0};
+};
+
+/**
+ * Stream buffer for writing to a fixed-size, caller-provided sequence of bytes. Writing past the
+ * end of the sequence fails.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+class SpanStreamBuffer final : public OutputStreamBuffer
+{
+public:
+    /**
+     * Constructor.
+     *
+     * @param buffer The sequence of bytes to write to. Must outlive this stream buffer.
+     */
+    explicit SpanStreamBuffer(std::span<std::byte> buffer) noexcept;
+
+protected:
+    char_type *reserve(std::size_t size) override;
+
+private:
+    std::span<std::byte> m_buffer;
+};
+
+/**
+ * Stream buffer for writing to a growable container of bytes. The container is grown geometrically
+ * as needed, so it may hold more bytes than were written; callers should resize the container to
+ * the written size once writing is complete.
+ *
+ * @tparam Container The container type, e.g. std::string or std::vector<std::byte>.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+template <typename Container>
+class GrowableStreamBuffer final : public OutputStreamBuffer
+{
+public:
+    /**
+     * Constructor. The container is cleared.
+     *
+     * @param buffer The container to write to. Must outlive this stream buffer.
+     */
+    explicit GrowableStreamBuffer(Container &buffer) noexcept;
+
+protected:
+    char_type *reserve(std::size_t size) override;
+
+private:
+    Container &m_buffer;
+};
+
+//==================================================================================================
+template <typename Container>
+GrowableStreamBuffer<Container>::GrowableStreamBuffer(Container &buffer) noexcept :
+    m_buffer(buffer)
+{
+    m_buffer.clear();
+}
+
+//==================================================================================================
+template <typename Container>
+auto GrowableStreamBuffer<Container>::reserve(std::size_t size) -> char_type *
+{
+    if (size > m_buffer.size())
+    {
+        m_buffer.resize(std::max(size, m_buffer.size() * 2));
+    }
+
+    return reinterpret_cast<char_type *>(m_buffer.data());
+}
+
+} // namespace fly::detail
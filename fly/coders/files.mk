@@ -1,6 +1,9 @@
 SRC_DIRS_$(d) := \
     $(d)/base64 \
-    $(d)/huffman
+    $(d)/container \
+    $(d)/detail \
+    $(d)/huffman \
+    $(d)/lz77
 
 SRC_$(d) := \
     $(d)/coder.cpp \
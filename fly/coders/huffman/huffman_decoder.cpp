@@ -1,17 +1,209 @@
 #include "fly/coders/huffman/huffman_decoder.hpp"
 
+#include "fly/coders/detail/stream_buffers.hpp"
 #include "fly/logger/logger.hpp"
 #include "fly/types/bit_stream/bit_stream_reader.hpp"
+#include "fly/types/bit_stream/detail/constants.hpp"
+#include "fly/types/numeric/endian.hpp"
 #include "fly/types/numeric/literals.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <optional>
+#include <utility>
 #include <vector>
 
 using namespace fly::literals::numeric_literals;
 
 namespace fly::coders {
 
+namespace {
+
+    constexpr auto s_word_bits = static_cast<byte_type>(std::numeric_limits<std::uint32_t>::digits);
+
+    // Size of the BitStream header and the Huffman coder header (in bytes).
+    constexpr std::size_t s_header_size = detail::s_byte_type_size * 3 + sizeof(word_type);
+
+    // Number of bytes a decoder session holds beyond what is needed to decode the next part of the
+    // stream. A BitStream reader reads at most one buffer's worth of bytes beyond the bits it has
+    // consumed, so this ensures the reader never reaches the end of the buffered bytes.
+    constexpr std::size_t s_session_lookahead = sizeof(std::uint64_t) * 2;
+
+    /**
+     * An in-memory bit stream for decoding one of the interleaved bit streams of a chunk. Bits are
+     * held most-significant first in a 64-bit buffer, which is refilled with a single unaligned
+     * load. The memory being read must be followed by at least 8 readable bytes.
+     */
+    class InterleavedStream
+    {
+    public:
+        // Number of symbols which may be decoded after each refill, given that codes are at most
+        // 15 bits and a refill leaves at least 56 bits in the buffer.
+        static constexpr std::uint32_t s_symbols_per_refill = 3;
+
+        InterleavedStream() noexcept = default;
+
+        InterleavedStream(byte_type const *data, byte_type const *limit) noexcept :
+            m_data(data),
+            m_limit(limit)
+        {
+        }
+
+        void refill()
+        {
+            std::uint64_t word;
+            std::memcpy(&word, m_data, sizeof(word));
+
+            // Bits beyond the whole bytes which fit in the buffer are loaded as well, but they are
+            // loaded again into the same position by the next refill.
+            m_buffer |= endian_swap_if_non_native<std::endian::big>(word) >> m_bits;
+
+            auto const bytes = static_cast<byte_type>(
+                (detail::s_most_significant_bit_position - 1 - m_bits) / detail::s_bits_per_byte);
+            m_bits += static_cast<byte_type>(bytes * detail::s_bits_per_byte);
+
+            // A valid stream never reads past its limit. Clamping the read position bounds reads of
+            // a corrupt stream, which is detected by the number of consumed bits.
+            m_data = std::min(m_data + bytes, m_limit);
+        }
+
+        symbol_type decode(HuffmanCode const *prefix_table, length_type max_code_length)
+        {
+            auto const shift = detail::s_most_significant_bit_position - max_code_length;
+            HuffmanCode const &code = prefix_table[m_buffer >> shift];
+
+            m_buffer <<= code.m_length;
+            m_bits -= code.m_length;
+            m_consumed += code.m_length;
+
+            return code.m_symbol;
+        }
+
+        std::uint64_t consumed() const
+        {
+            return m_consumed;
+        }
+
+    private:
+        byte_type const *m_data {nullptr};
+        byte_type const *m_limit {nullptr};
+
+        std::uint64_t m_buffer {0};
+        byte_type m_bits {0};
+        std::uint64_t m_consumed {0};
+    };
+
+} // namespace
+
+/**
+ * Session to incrementally Huffman decode a sequence of bytes. The header is decoded once enough of
+ * the stream has been buffered, and chunks are then decoded as soon as the largest possible
+ * encoding of a chunk has been buffered. The remainder of the stream is decoded when the session is
+ * finished.
+ */
+class HuffmanDecoder::Session final : public DecoderSession
+{
+public:
+    explicit Session(std::ostream &decoded) : m_stream(decoded), m_input(&m_buffer)
+    {
+    }
+
+    bool update(std::span<std::byte const> encoded) override
+    {
+        if (m_finished)
+        {
+            return false;
+        }
+
+        m_buffer.append(encoded);
+        return decode_available(false);
+    }
+
+    bool finish() override
+    {
+        if (std::exchange(m_finished, true))
+        {
+            return false;
+        }
+
+        return decode_available(true);
+    }
+
+private:
+    bool decode_available(bool finishing)
+    {
+        if (!m_reader)
+        {
+            if (!finishing && (m_buffer.available() < (s_header_size + s_session_lookahead)))
+            {
+                return true;
+            }
+
+            m_reader.emplace(m_input);
+
+            if (!m_decoder.decode_header(*m_reader, m_chunk_size))
+            {
+                LOGW("Error decoding header from stream");
+                return fail();
+            }
+
+            m_required_size = max_encoded_chunk_size() + s_session_lookahead;
+        }
+
+        while (finishing ? !m_reader->fully_consumed() : (m_buffer.available() >= m_required_size))
+        {
+            if (!m_decoder.decode_chunk(*m_reader, m_chunk_size, m_stream))
+            {
+                return fail();
+            }
+        }
+
+        return m_stream.good();
+    }
+
+    bool fail()
+    {
+        m_finished = true;
+        return false;
+    }
+
+    /**
+     * Compute the size of the largest possible encoding of a chunk: every symbol is present with
+     * the maximum code length, and the chunk is encoded as interleaved bit streams.
+     */
+    std::size_t max_encoded_chunk_size() const
+    {
+        std::size_t const max_code_length = m_decoder.m_max_code_length;
+
+        std::size_t const codes_size = detail::s_byte_type_size +
+            (max_code_length + 1) * sizeof(word_type) + m_decoder.m_huffman_codes.size();
+        std::size_t const interleaved_size =
+            (s_interleaved_stream_count + 1) * sizeof(std::uint32_t) + s_interleaved_stream_count;
+        std::size_t const symbols_size =
+            (m_chunk_size * max_code_length + detail::s_bits_per_byte - 1) /
+            detail::s_bits_per_byte;
+
+        return codes_size + interleaved_size + symbols_size;
+    }
+
+    HuffmanDecoder m_decoder;
+    std::ostream &m_stream;
+
+    fly::detail::QueueStreamBuffer m_buffer;
+    std::istream m_input;
+    std::optional<fly::BitStreamReader> m_reader;
+
+    std::uint32_t m_chunk_size {0};
+    std::size_t m_required_size {0};
+
+    bool m_finished {false};
+};
+
 //==================================================================================================
 HuffmanDecoder::HuffmanDecoder() noexcept :
+    m_interleaved(false),
     m_huffman_codes_size(0),
     m_max_code_length(0)
 {
@@ -30,6 +222,18 @@ code_type HuffmanDecoder::compute_kraft_mcmillan_constant() const
     return kraft;
 }
 
+//==================================================================================================
+std::size_t HuffmanDecoder::max_decoded_size(std::size_t encoded_size) const
+{
+    return encoded_size * detail::s_bits_per_byte;
+}
+
+//==================================================================================================
+std::unique_ptr<DecoderSession> HuffmanDecoder::create_decoder_session(std::ostream &decoded)
+{
+    return std::make_unique<Session>(decoded);
+}
+
 //==================================================================================================
 bool HuffmanDecoder::decode_binary(fly::BitStreamReader &encoded, std::ostream &decoded)
 {
@@ -41,24 +245,10 @@ bool HuffmanDecoder::decode_binary(fly::BitStreamReader &encoded, std::ostream &
         return false;
     }
 
-    m_chunk_buffer = std::make_unique<symbol_type[]>(chunk_size);
-    m_prefix_table = std::make_unique<HuffmanCode[]>(1_zu << m_max_code_length);
-
     while (!encoded.fully_consumed())
     {
-        length_type max_code_length = 0;
-
-        if (!decode_codes(encoded, max_code_length))
-        {
-            LOGW("Error decoding codes from stream (maximum code length = {})", m_max_code_length);
-            return false;
-        }
-        else if (!decode_symbols(encoded, max_code_length, chunk_size, decoded))
+        if (!decode_chunk(encoded, chunk_size, decoded))
         {
-            LOGW(
-                "Error decoding {} symbols from stream (fully consumed = {})",
-                chunk_size,
-                encoded.fully_consumed());
             return false;
         }
     }
@@ -78,17 +268,34 @@ bool HuffmanDecoder::decode_header(fly::BitStreamReader &encoded, std::uint32_t
         return false;
     }
 
+    bool decoded_header = false;
+
     switch (huffman_version)
     {
         case 1:
-            return decode_header_version1(encoded, chunk_size);
+            decoded_header = decode_header_version1(encoded, chunk_size);
+            break;
+
+        case 2:
+            decoded_header = decode_header_version2(encoded, chunk_size);
+            break;
 
         default:
             LOGW("Decoded invalid Huffman version {}", huffman_version);
             break;
     }
 
-    return false;
+    if (decoded_header)
+    {
+        // Multi-symbol decoding writes every symbol of a table entry at once, so the chunk buffer
+        // is padded to allow writing past the end of the chunk.
+        m_chunk_buffer =
+            std::make_unique<symbol_type[]>(chunk_size + HuffmanDecodeEntry::s_max_symbols);
+        m_prefix_table = std::make_unique<HuffmanCode[]>(1_zu << m_max_code_length);
+        m_decoding_table = std::make_unique<HuffmanDecodeEntry[]>(1_zu << m_max_code_length);
+    }
+
+    return decoded_header;
 }
 
 //==================================================================================================
@@ -128,6 +335,48 @@ bool HuffmanDecoder::decode_header_version1(
 
     chunk_size = static_cast<std::uint32_t>(encoded_chunk_size_kb) << 10;
     m_max_code_length = static_cast<length_type>(encoded_max_code_length);
+    m_interleaved = false;
+
+    return true;
+}
+
+//==================================================================================================
+bool HuffmanDecoder::decode_header_version2(
+    fly::BitStreamReader &encoded,
+    std::uint32_t &chunk_size)
+{
+    if (!decode_header_version1(encoded, chunk_size))
+    {
+        return false;
+    }
+
+    m_interleaved = true;
+    return true;
+}
+
+//==================================================================================================
+bool HuffmanDecoder::decode_chunk(
+    fly::BitStreamReader &encoded,
+    std::uint32_t chunk_size,
+    std::ostream &decoded)
+{
+    length_type max_code_length = 0;
+
+    if (!decode_codes(encoded, max_code_length))
+    {
+        LOGW("Error decoding codes from stream (maximum code length = {})", m_max_code_length);
+        return false;
+    }
+    else if (!(m_interleaved ?
+                   decode_interleaved_symbols(encoded, max_code_length, chunk_size, decoded) :
+                   decode_symbols(encoded, max_code_length, chunk_size, decoded)))
+    {
+        LOGW(
+            "Error decoding {} symbols from stream (fully consumed = {})",
+            chunk_size,
+            encoded.fully_consumed());
+        return false;
+    }
 
     return true;
 }
@@ -205,6 +454,8 @@ bool HuffmanDecoder::decode_codes(fly::BitStreamReader &encoded, length_type &ma
     }
 
     convert_to_prefix_table(max_code_length);
+    convert_to_decoding_table(max_code_length);
+
     return true;
 }
 
@@ -225,6 +476,43 @@ void HuffmanDecoder::convert_to_prefix_table(length_type max_code_length)
     }
 }
 
+//==================================================================================================
+void HuffmanDecoder::convert_to_decoding_table(length_type max_code_length)
+{
+    std::uint32_t const mask = (1_u32 << max_code_length) - 1;
+
+    for (std::uint32_t index = 0; index <= mask; ++index)
+    {
+        HuffmanDecodeEntry &entry = m_decoding_table[index];
+        entry.m_count = 0;
+        entry.m_length = 0;
+
+        // Shift out the bits of each decoded code, zero-filling the index, to look up the next
+        // code. Only codes which were fully contained in the index before zero-filling are kept.
+        while (entry.m_count < HuffmanDecodeEntry::s_max_symbols)
+        {
+            HuffmanCode const &code = m_prefix_table[(index << entry.m_length) & mask];
+
+            if ((code.m_length == 0) || ((entry.m_length + code.m_length) > max_code_length))
+            {
+                break;
+            }
+
+            entry.m_symbols[entry.m_count++] = code.m_symbol;
+            entry.m_length += code.m_length;
+        }
+
+        entry.m_first_length = m_prefix_table[index].m_length;
+
+        // An index which does not begin with any code may only be reached by a corrupt stream. Mark
+        // the entry as longer than any peek, so that it is handled outside of the fast path.
+        if (entry.m_count == 0)
+        {
+            entry.m_length = static_cast<length_type>(max_code_length + 1);
+        }
+    }
+}
+
 //==================================================================================================
 bool HuffmanDecoder::decode_symbols(
     fly::BitStreamReader &encoded,
@@ -234,13 +522,29 @@ bool HuffmanDecoder::decode_symbols(
 {
     std::uint32_t bytes = 0;
     code_type prefix;
+    byte_type peeked;
 
-    while ((bytes < chunk_size) && (encoded.peek_bits(prefix, max_code_length) != 0))
+    while ((bytes < chunk_size) && ((peeked = encoded.peek_bits(prefix, max_code_length)) != 0))
     {
-        HuffmanCode const &code = m_prefix_table[prefix];
+        HuffmanDecodeEntry const &entry = m_decoding_table[prefix];
 
-        m_chunk_buffer[bytes++] = code.m_symbol;
-        encoded.discard_bits(code.m_length);
+        if ((entry.m_length <= peeked) && ((bytes + entry.m_count) <= chunk_size))
+        {
+            std::memcpy(&m_chunk_buffer[bytes], entry.m_symbols.data(), sizeof(entry.m_symbols));
+
+            bytes += entry.m_count;
+            encoded.discard_bits(entry.m_length);
+        }
+        else if (entry.m_first_length == 0)
+        {
+            LOGW("Decoded prefix {:#x} which does not begin with any code", prefix);
+            return false;
+        }
+        else
+        {
+            m_chunk_buffer[bytes++] = entry.m_symbols[0];
+            encoded.discard_bits(entry.m_first_length);
+        }
     }
 
     if (bytes > 0)
@@ -253,4 +557,148 @@ bool HuffmanDecoder::decode_symbols(
     return (bytes == chunk_size) || encoded.fully_consumed();
 }
 
+//==================================================================================================
+bool HuffmanDecoder::decode_interleaved_symbols(
+    fly::BitStreamReader &encoded,
+    length_type max_code_length,
+    std::uint32_t chunk_size,
+    std::ostream &decoded)
+{
+    std::uint32_t symbols;
+
+    if (encoded.read_bits(symbols, s_word_bits) != s_word_bits)
+    {
+        LOGW("Could not decode interleaved symbol count");
+        return false;
+    }
+    else if ((symbols == 0) || (symbols > chunk_size))
+    {
+        LOGW("Decoded invalid interleaved symbol count {}", symbols);
+        return false;
+    }
+
+    // Together, the bit streams can be no larger than if each symbol had the chunk's longest code,
+    // plus the zero-fill of each bit stream. The total is validated before any storage is resized,
+    // so that a corrupt header cannot force an allocation much larger than the chunk.
+    auto const max_total_size =
+        ((static_cast<std::uint64_t>(symbols) * max_code_length) / detail::s_bits_per_byte) +
+        s_interleaved_stream_count;
+
+    std::array<std::uint32_t, s_interleaved_stream_count> sizes;
+    std::uint64_t total_size = 0;
+
+    for (auto &size : sizes)
+    {
+        if (encoded.read_bits(size, s_word_bits) != s_word_bits)
+        {
+            LOGW("Could not decode interleaved bit stream size");
+            return false;
+        }
+
+        total_size += size;
+    }
+
+    if (total_size > max_total_size)
+    {
+        LOGW("Decoded invalid interleaved bit streams size {}", total_size);
+        return false;
+    }
+
+    // The bit streams are padded to allow each stream's unaligned loads to read past its end.
+    static constexpr std::size_t s_padding = sizeof(std::uint64_t) * 2;
+
+    m_interleaved_buffer.resize(static_cast<std::size_t>(total_size) + s_padding);
+    std::fill_n(m_interleaved_buffer.end() - s_padding, s_padding, byte_type(0));
+
+    std::size_t position = 0;
+
+    for (; (position + sizeof(std::uint32_t)) <= total_size; position += sizeof(std::uint32_t))
+    {
+        std::uint32_t word;
+
+        if (encoded.read_bits(word, s_word_bits) != s_word_bits)
+        {
+            LOGW("Could not decode interleaved bit streams");
+            return false;
+        }
+
+        word = endian_swap_if_non_native<std::endian::big>(word);
+        std::memcpy(m_interleaved_buffer.data() + position, &word, sizeof(word));
+    }
+
+    for (; position < total_size; ++position)
+    {
+        if (!encoded.read_byte(m_interleaved_buffer[position]))
+        {
+            LOGW("Could not decode interleaved bit streams");
+            return false;
+        }
+    }
+
+    std::uint32_t const segment_size = symbols / s_interleaved_stream_count;
+    std::uint32_t const remainder = symbols % s_interleaved_stream_count;
+
+    byte_type const *limit = m_interleaved_buffer.data() + total_size + sizeof(std::uint64_t);
+    byte_type const *data = m_interleaved_buffer.data();
+
+    std::array<symbol_type *, s_interleaved_stream_count> segments;
+    std::array<InterleavedStream, s_interleaved_stream_count> streams;
+
+    for (std::uint32_t i = 0, start = 0; i < s_interleaved_stream_count; ++i)
+    {
+        segments[i] = m_chunk_buffer.get() + start;
+        start += segment_size + ((i < remainder) ? 1 : 0);
+
+        streams[i] = InterleavedStream(data, limit);
+        data += sizes[i];
+    }
+
+    HuffmanCode const *prefix_table = m_prefix_table.get();
+    std::uint32_t i = 0;
+
+    // Decode one symbol from each bit stream at a time. Each bit stream has its own buffer, so the
+    // decoding of each bit stream is independent of the others.
+    for (; (i + InterleavedStream::s_symbols_per_refill) <= segment_size;
+         i += InterleavedStream::s_symbols_per_refill)
+    {
+        for (auto &stream : streams)
+        {
+            stream.refill();
+        }
+
+        for (std::uint32_t j = 0; j < InterleavedStream::s_symbols_per_refill; ++j)
+        {
+            for (std::uint32_t k = 0; k < s_interleaved_stream_count; ++k)
+            {
+                segments[k][i + j] = streams[k].decode(prefix_table, max_code_length);
+            }
+        }
+    }
+
+    for (std::uint32_t k = 0; k < s_interleaved_stream_count; ++k)
+    {
+        std::uint32_t const end = segment_size + ((k < remainder) ? 1 : 0);
+
+        for (std::uint32_t j = i; j < end; ++j)
+        {
+            streams[k].refill();
+            segments[k][j] = streams[k].decode(prefix_table, max_code_length);
+        }
+
+        std::uint64_t const bits = static_cast<std::uint64_t>(sizes[k]) * detail::s_bits_per_byte;
+
+        if (streams[k].consumed() > bits)
+        {
+            LOGW("Interleaved bit stream {} decoded more bits than it contains", k);
+            return false;
+        }
+    }
+
+    decoded.write(
+        reinterpret_cast<std::ios::char_type const *>(m_chunk_buffer.get()),
+        static_cast<std::streamsize>(symbols));
+
+    return true;
+}
+
 } // namespace fly::coders
@@ -2,10 +2,13 @@
 
 #include "fly/coders/coder.hpp"
 #include "fly/coders/huffman/types.hpp"
+#include "fly/types/bit_stream/types.hpp"
 
 #include <array>
+#include <cstddef>
 #include <memory>
 #include <ostream>
+#include <vector>
 
 namespace fly {
 class BitStreamReader;
@@ -16,6 +19,12 @@ namespace fly::coders {
 /**
  * Implementation of the Decoder interface for Huffman coding.
  *
+ * Decoder sessions buffer the encoded input until the largest possible encoding of a chunk is
+ * available, and then decode that chunk. The encoded size of a chunk is not known until the chunk
+ * is decoded, and the end of the buffered input is indistinguishable from the end of the stream,
+ * which BitStream readers treat specially. Thus, a session holds roughly twice the configured chunk
+ * size of encoded input at a time.
+ *
  * @author Timothy Flynn (trflynn89@pm.me)
  * @version July 7, 2019
  */
@@ -35,6 +44,27 @@ class HuffmanDecoder : public BinaryDecoder
      */
     code_type compute_kraft_mcmillan_constant() const;
 
+    /**
+     * Compute an upper bound of the size of the decoding of a sequence of bytes. Every Huffman code
+     * is at least 1 bit long, so each encoded byte decodes to at most 8 symbols. The actual decoded
+     * size is generally much smaller, so buffers decoded into are best grown rather than
+     * preallocated to this size.
+     *
+     * @param encoded_size The size of the sequence to decode.
+     *
+     * @return The maximum size of the decoded sequence.
+     */
+    std::size_t max_decoded_size(std::size_t encoded_size) const override;
+
+    /**
+     * Create a session to incrementally Huffman decode a sequence of bytes.
+     *
+     * @param decoded Stream to store the decoded contents. Must outlive the session.
+     *
+     * @return The created session.
+     */
+    std::unique_ptr<DecoderSession> create_decoder_session(std::ostream &decoded) override;
+
 protected:
     /**
      * Huffman decode a stream.
@@ -53,10 +83,19 @@ class HuffmanDecoder : public BinaryDecoder
      * other code. Thus, a table can be formed as an array, whose indices are integers where the
      * most-significant bits are Huffman codes.
      *
-     * Decoding a symbol from the input stream (step 3) consists of peeking N bits from the input
+     * Decoding symbols from the input stream (step 3) consists of peeking N bits from the input
      * stream, where N is maximum length of the decoded Huffman codes. These bits are the index into
-     * the prefix table; a single lookup is performed to find the corresponding Huffman code. The
-     * actual length of the code is then discarded from the input stream.
+     * a multi-symbol decoding table, which is derived from the prefix table. Each entry holds every
+     * symbol whose code is fully contained within the N peeked bits, so a single lookup decodes as
+     * many as HuffmanDecodeEntry::s_max_symbols symbols. The total length of those codes is then
+     * discarded from the input stream. Near the end of a chunk or of the stream, only the first
+     * symbol of an entry is decoded, as later symbols may have been formed from bits that are not
+     * part of the chunk.
+     *
+     * Streams encoded with version 2 of the Huffman coder hold each chunk as 4 interleaved bit
+     * streams, as described by HuffmanEncoder. The bit streams of a chunk are read into memory, and
+     * are decoded one symbol from each bit stream at a time. Each bit stream is decoded with its
+     * own 64-bit buffer, so the CPU may overlap the decoding of each bit stream.
      *
      * @param encoded Stream holding the contents to decode.
      * @param decoded Stream to store the decoded contents.
@@ -66,9 +105,12 @@ class HuffmanDecoder : public BinaryDecoder
     bool decode_binary(fly::BitStreamReader &encoded, std::ostream &decoded) override;
 
 private:
+    class Session;
+
     /**
      * Decode the version of the encoder used to encode the stream, and invoke the header decoder
-     * associated with that version.
+     * associated with that version. The chunk buffer and decoding tables are allocated for the
+     * decoded chunk size and maximum Huffman code length.
      *
      * @param encoded Stream storing the encoded header.
      * @param chunk_size Location to store the maximum chunk size (in bytes).
@@ -88,6 +130,29 @@ class HuffmanDecoder : public BinaryDecoder
      */
     bool decode_header_version1(fly::BitStreamReader &encoded, std::uint32_t &chunk_size);
 
+    /**
+     * Decode version 2 of the header. The header is identical to version 1, but indicates that each
+     * chunk is encoded as interleaved bit streams.
+     *
+     * @param encoded Stream storing the encoded header.
+     * @param chunk_size Location to store the maximum chunk size (in bytes).
+     *
+     * @return True if the header was successfully encoded.
+     */
+    bool decode_header_version2(fly::BitStreamReader &encoded, std::uint32_t &chunk_size);
+
+    /**
+     * Decode a single chunk from an encoded input stream.
+     *
+     * @param encoded Stream holding the chunk to decode.
+     * @param chunk_size The maximum chunk size (in bytes).
+     * @param decoded Stream to store the decoded chunk.
+     *
+     * @return True if the chunk was successfully decoded.
+     */
+    bool
+    decode_chunk(fly::BitStreamReader &encoded, std::uint32_t chunk_size, std::ostream &decoded);
+
     /**
      * Decode Huffman codes from an encoded input stream. The list of codes will be stored as a
      * prefix table.
@@ -106,6 +171,13 @@ class HuffmanDecoder : public BinaryDecoder
      */
     void convert_to_prefix_table(length_type max_code_length);
 
+    /**
+     * Convert the prefix table into a multi-symbol decoding table.
+     *
+     * @param max_code_length The maximum length of the decoded Huffman codes.
+     */
+    void convert_to_decoding_table(length_type max_code_length);
+
     /**
      * Decode symbols from an encoded input stream with a Huffman tree. Store decoded data into a
      * chunk buffer until the decoded chunk size is reached, or the end of the encoded input stream
@@ -124,8 +196,30 @@ class HuffmanDecoder : public BinaryDecoder
         std::uint32_t chunk_size,
         std::ostream &decoded) const;
 
+    /**
+     * Decode symbols from an encoded input stream which were encoded as interleaved bit streams.
+     * The bit streams are read into memory and decoded into the chunk buffer. Then flush those
+     * bytes to the real output stream.
+     *
+     * @param encoded Stream holding the symbols to decode.
+     * @param max_code_length The maximum length of the decoded Huffman codes.
+     * @param chunk_size The number of bytes the chunk buffer can hold.
+     * @param decoded Stream to store the decoded symbols.
+     *
+     * @return True if the input stream was successfully decoded.
+     */
+    bool decode_interleaved_symbols(
+        fly::BitStreamReader &encoded,
+        length_type max_code_length,
+        std::uint32_t chunk_size,
+        std::ostream &decoded);
+
     std::unique_ptr<symbol_type[]> m_chunk_buffer;
 
+    // Holds the interleaved bit streams of a chunk, if the stream was encoded as such.
+    std::vector<byte_type> m_interleaved_buffer;
+    bool m_interleaved;
+
     // Sized to fit 8-bit ASCII symbols.
     std::array<HuffmanCode, 1 << 8> m_huffman_codes;
     std::uint16_t m_huffman_codes_size;
@@ -134,6 +228,9 @@ class HuffmanDecoder : public BinaryDecoder
     // Will be sized to fit the global maximum Huffman code length used by the encoder. The size
     // will be 2^L, were L is the maximum code length.
     std::unique_ptr<HuffmanCode[]> m_prefix_table;
+
+    // Will be sized to fit the global maximum Huffman code length used by the encoder, as above.
+    std::unique_ptr<HuffmanDecodeEntry[]> m_decoding_table;
 };
 
 } // namespace fly::coders
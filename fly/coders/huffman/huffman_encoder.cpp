@@ -1,13 +1,24 @@
 #include "fly/coders/huffman/huffman_encoder.hpp"
 
 #include "fly/coders/coder_config.hpp"
+#include "fly/coders/detail/stream_buffers.hpp"
 #include "fly/logger/logger.hpp"
+#include "fly/task/task_runner.hpp"
 #include "fly/types/bit_stream/bit_stream_writer.hpp"
+#include "fly/types/bit_stream/detail/constants.hpp"
+#include "fly/types/numeric/endian.hpp"
 #include "fly/types/numeric/literals.hpp"
 
 #include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <future>
 #include <limits>
-#include <stack>
+#include <sstream>
+#include <thread>
+#include <utility>
 #include <vector>
 
 using namespace fly::literals::numeric_literals;
@@ -17,19 +28,499 @@ namespace fly::coders {
 namespace {
 
     constexpr std::uint8_t s_huffman_version = 1;
+    constexpr std::uint8_t s_huffman_version_interleaved = 2;
+
+    // Number of chunks to encode concurrently per hardware thread. Chunks are read and encoded in
+    // groups of this size (times the number of threads) to bound memory usage.
+    constexpr std::size_t s_chunks_per_thread = 2;
+
+    // Size of the regions which adaptive chunks are formed from (in bytes).
+    constexpr std::uint32_t s_adaptive_region_size = 16 << 10;
+
+    // Factor by which the bits saved by starting a new adaptive chunk must exceed the estimated
+    // cost of encoding the new chunk's codes. Entropy estimates of small regions are optimistic, so
+    // this avoids splitting chunks over noise in their statistics.
+    constexpr double s_adaptive_split_factor = 2.0;
+
+    // The maximum code length of an adaptive chunk may cost at most 1/N of its encoded size.
+    constexpr std::uint64_t s_adaptive_code_length_tolerance = 512;
+
+    /**
+     * Compute the number of bits needed to encode a sequence of symbols with ideal entropy codes.
+     */
+    double entropy_bits(std::array<frequency_type, 1 << 8> const &counts, std::uint32_t size)
+    {
+        double bits = 0.0;
+
+        for (frequency_type const count : counts)
+        {
+            if (count > 0)
+            {
+                bits += static_cast<double>(count) * std::log2(static_cast<double>(size) / count);
+            }
+        }
+
+        return bits;
+    }
+
+    /**
+     * Determine whether a region of symbols should start a new adaptive chunk. The region starts a
+     * new chunk if the bits saved by encoding the chunk and the region with their own codes, rather
+     * than with shared codes, exceed the cost of encoding another set of codes.
+     */
+    bool should_split_chunk(
+        std::array<frequency_type, 1 << 8> const &chunk_counts,
+        std::uint32_t chunk_size,
+        std::array<frequency_type, 1 << 8> const &region_counts,
+        std::uint32_t region_size,
+        length_type max_code_length)
+    {
+        std::array<frequency_type, 1 << 8> merged_counts;
+        std::size_t symbols = 0;
+
+        for (std::size_t i = 0; i < merged_counts.size(); ++i)
+        {
+            merged_counts[i] = chunk_counts[i] + region_counts[i];
+            symbols += (region_counts[i] > 0) ? 1 : 0;
+        }
+
+        double const saved = entropy_bits(merged_counts, chunk_size + region_size) -
+            entropy_bits(chunk_counts, chunk_size) - entropy_bits(region_counts, region_size);
+
+        // The number of code length counts, the code length counts, the symbols, the interleaved
+        // symbol count and bit stream sizes, and the zero-filled bits of each bit stream.
+        auto const cost = static_cast<double>(
+            detail::s_bits_per_byte + (max_code_length + 1_zu) * detail::s_bits_per_word +
+            symbols * detail::s_bits_per_byte +
+            (s_interleaved_stream_count + 1_zu) * std::numeric_limits<std::uint32_t>::digits +
+            s_interleaved_stream_count * detail::s_bits_per_byte);
+
+        return saved > (cost * s_adaptive_split_factor);
+    }
+
+    /**
+     * Compute the lengths of minimum-redundancy codes in-place, using the algorithm described by
+     * Alistair Moffat and Jyrki Katajainen in "In-Place Calculation of Minimum-Redundancy Codes".
+     * The weights must be sorted in ascending order, and there must be at least two weights. Each
+     * weight is replaced by the length of its code; the lengths will be in descending order.
+     */
+    void compute_minimum_redundancy(frequency_type *weights, std::size_t size)
+    {
+        // First pass, left to right: combine the two lightest nodes into an internal node, where
+        // leaves are taken from the unprocessed weights. Combined internal nodes are replaced with
+        // the index of their parent.
+        std::size_t root = 0;
+        std::size_t leaf = 2;
+
+        weights[0] += weights[1];
+
+        for (std::size_t next = 1; next < (size - 1); ++next)
+        {
+            if ((leaf >= size) || (weights[root] < weights[leaf]))
+            {
+                weights[next] = weights[root];
+                weights[root++] = next;
+            }
+            else
+            {
+                weights[next] = weights[leaf++];
+            }
+
+            if ((leaf >= size) || ((root < next) && (weights[root] < weights[leaf])))
+            {
+                weights[next] += weights[root];
+                weights[root++] = next;
+            }
+            else
+            {
+                weights[next] += weights[leaf++];
+            }
+        }
+
+        // Second pass, right to left: convert the parent indices into internal node depths.
+        weights[size - 2] = 0;
+
+        for (std::size_t next = size - 2; next-- > 0;)
+        {
+            weights[next] = weights[weights[next]] + 1;
+        }
+
+        // Third pass, right to left: convert the internal node depths into leaf depths.
+        std::size_t internal = size - 1;
+        std::size_t next = size;
+        std::size_t available = 1;
+        frequency_type depth = 0;
+
+        while (available > 0)
+        {
+            std::size_t used = 0;
+
+            for (; (internal > 0) && (weights[internal - 1] == depth); --internal)
+            {
+                ++used;
+            }
+
+            for (; available > used; --available)
+            {
+                weights[--next] = depth;
+            }
+
+            available = used * 2;
+            ++depth;
+        }
+    }
+
+    /**
+     * An in-memory bit stream for encoding one of the interleaved bit streams of a chunk. Codes are
+     * accumulated in a 64-bit buffer, which is flushed to memory 32 bits at a time.
+     */
+    class InterleavedStream
+    {
+    public:
+        explicit InterleavedStream(std::size_t capacity)
+        {
+            m_bytes.reserve(capacity);
+        }
+
+        void write(code_type code, length_type length)
+        {
+            static constexpr byte_type s_word_bits = std::numeric_limits<std::uint32_t>::digits;
+
+            m_buffer = (m_buffer << length) | code;
+            m_bits += length;
+
+            if (m_bits >= s_word_bits)
+            {
+                m_bits -= s_word_bits;
+
+                auto const word = static_cast<std::uint32_t>(m_buffer >> m_bits);
+                append(endian_swap_if_non_native<std::endian::big>(word));
+            }
+        }
+
+        void finish()
+        {
+            // Zero-fill the remaining bits to a byte boundary.
+            for (; m_bits >= detail::s_bits_per_byte; m_bits -= detail::s_bits_per_byte)
+            {
+                append(static_cast<byte_type>(m_buffer >> (m_bits - detail::s_bits_per_byte)));
+            }
+
+            if (m_bits > 0)
+            {
+                append(static_cast<byte_type>(m_buffer << (detail::s_bits_per_byte - m_bits)));
+                m_bits = 0;
+            }
+        }
+
+        std::string const &bytes() const
+        {
+            return m_bytes;
+        }
+
+    private:
+        template <typename DataType>
+        void append(DataType data)
+        {
+            std::size_t const size = m_bytes.size();
+            m_bytes.resize(size + sizeof(DataType));
+
+            std::memcpy(m_bytes.data() + size, &data, sizeof(DataType));
+        }
+
+        std::string m_bytes;
+        std::uint64_t m_buffer {0};
+        byte_type m_bits {0};
+    };
+
+    /**
+     * Write a sequence of bytes to a bit stream, writing as many bytes as possible as large words.
+     */
+    void write_bytes(char const *data, std::size_t size, fly::BitStreamWriter &encoded)
+    {
+        static constexpr std::size_t s_word_size = sizeof(std::uint32_t);
+        std::size_t position = 0;
+
+        for (; (position + s_word_size) <= size; position += s_word_size)
+        {
+            std::uint32_t word = 0;
+            std::memcpy(&word, data + position, s_word_size);
+
+            encoded.write_bits(
+                endian_swap_if_non_native<std::endian::big>(word),
+                static_cast<byte_type>(s_word_size * detail::s_bits_per_byte));
+        }
+
+        for (; position < size; ++position)
+        {
+            encoded.write_byte(static_cast<byte_type>(data[position]));
+        }
+    }
+
+    /**
+     * Add the time spent within the lifetime of the timer to a stage of encoding, if stage timing
+     * is enabled.
+     */
+    class StageTimer
+    {
+    public:
+        StageTimer(bool enabled, std::chrono::nanoseconds &stage) noexcept :
+            m_stage(enabled ? &stage : nullptr)
+        {
+            if (m_stage != nullptr)
+            {
+                m_start = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~StageTimer()
+        {
+            if (m_stage != nullptr)
+            {
+                *m_stage += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - m_start);
+            }
+        }
+
+        StageTimer(StageTimer const &) = delete;
+        StageTimer &operator=(StageTimer const &) = delete;
+
+    private:
+        std::chrono::nanoseconds *m_stage;
+        std::chrono::steady_clock::time_point m_start;
+    };
 
 } // namespace
 
+/**
+ * Session to incrementally Huffman encode a sequence of bytes. Input is buffered until a full chunk
+ * is available, unless a full chunk is provided at once, in which case it is encoded in place.
+ */
+class HuffmanEncoder::Session final : public EncoderSession
+{
+public:
+    Session(
+        std::uint32_t chunk_size,
+        length_type max_code_length,
+        bool adaptive,
+        std::ostream &encoded) :
+        m_encoder(chunk_size, max_code_length, true, adaptive),
+        m_stream(encoded),
+        m_writer(encoded)
+    {
+        if (max_code_length >= std::numeric_limits<code_type>::digits)
+        {
+            LOGW("Maximum Huffman code length {} is too large for code_type", max_code_length);
+            m_finished = true;
+        }
+        else
+        {
+            m_encoder.m_chunk_buffer = std::make_unique<symbol_type[]>(chunk_size);
+            m_encoder.encode_header(m_writer);
+        }
+    }
+
+    bool update(std::span<std::byte const> decoded) override
+    {
+        if (m_finished)
+        {
+            return false;
+        }
+
+        auto const *data = reinterpret_cast<symbol_type const *>(decoded.data());
+        std::size_t size = decoded.size();
+
+        std::uint32_t const chunk_size = m_encoder.m_chunk_size;
+
+        while (size > 0)
+        {
+            if ((m_buffered == 0) && (size >= chunk_size))
+            {
+                m_encoder.m_chunk = data;
+                m_encoder.encode_chunk(chunk_size, m_writer);
+
+                data += chunk_size;
+                size -= chunk_size;
+            }
+            else
+            {
+                auto const fill = static_cast<std::uint32_t>(
+                    std::min<std::size_t>(chunk_size - m_buffered, size));
+                std::memcpy(m_encoder.m_chunk_buffer.get() + m_buffered, data, fill);
+
+                m_buffered += fill;
+                data += fill;
+                size -= fill;
+
+                if (m_buffered == chunk_size)
+                {
+                    encode_buffered();
+                }
+            }
+        }
+
+        return m_stream.good();
+    }
+
+    bool finish() override
+    {
+        if (std::exchange(m_finished, true))
+        {
+            return false;
+        }
+
+        if (m_buffered > 0)
+        {
+            encode_buffered();
+        }
+
+        return m_writer.finish();
+    }
+
+private:
+    void encode_buffered()
+    {
+        m_encoder.m_chunk = m_encoder.m_chunk_buffer.get();
+        m_encoder.encode_chunk(m_buffered, m_writer);
+
+        m_buffered = 0;
+    }
+
+    HuffmanEncoder m_encoder;
+
+    std::ostream &m_stream;
+    fly::BitStreamWriter m_writer;
+
+    std::uint32_t m_buffered {0};
+    bool m_finished {false};
+};
+
 //==================================================================================================
 HuffmanEncoder::HuffmanEncoder(std::shared_ptr<CoderConfig> const &config) noexcept :
-    m_chunk_size(config->huffman_encoder_chunk_size()),
-    m_max_code_length(config->huffman_encoder_max_code_length()),
+    HuffmanEncoder(
+        config->huffman_encoder_chunk_size(),
+        config->huffman_encoder_max_code_length(),
+        config->huffman_encoder_interleaved_streams(),
+        config->huffman_encoder_adaptive_chunks())
+{
+}
+
+//==================================================================================================
+HuffmanEncoder::HuffmanEncoder(
+    std::shared_ptr<CoderConfig> const &config,
+    std::shared_ptr<fly::task::TaskRunner> task_runner) noexcept :
+    HuffmanEncoder(config)
+{
+    m_task_runner = std::move(task_runner);
+}
+
+//==================================================================================================
+HuffmanEncoder::HuffmanEncoder(
+    std::uint32_t chunk_size,
+    length_type max_code_length,
+    bool interleaved,
+    bool adaptive) noexcept :
+    m_chunk_size(chunk_size),
+    m_max_code_length(max_code_length),
+    m_interleaved(interleaved || adaptive),
+    m_adaptive(adaptive),
     m_huffman_codes_size(0)
 {
 }
 
+//==================================================================================================
+std::size_t HuffmanEncoder::max_encoded_size(std::size_t decoded_size) const
+{
+    static constexpr std::size_t s_max_symbols = 1 << 8;
+    static constexpr std::size_t s_word_bits = std::numeric_limits<std::uint32_t>::digits;
+
+    // The BitStream header, Huffman coder version, chunk size, and maximum code length.
+    std::size_t bits = detail::s_bits_per_byte * 3 + detail::s_bits_per_word;
+
+    // The number of code length counts, the code length counts, and the symbols.
+    std::size_t const codes_bits = detail::s_bits_per_byte +
+        (m_max_code_length + 1_zu) * detail::s_bits_per_word +
+        s_max_symbols * detail::s_bits_per_byte;
+
+    // The symbol count, the bit stream sizes, and the zero-filled bits of each bit stream.
+    std::size_t const interleaved_bits = m_interleaved ?
+        (s_interleaved_stream_count + 1_zu) * s_word_bits +
+            s_interleaved_stream_count * (detail::s_bits_per_byte - 1_zu) :
+        0;
+
+    std::size_t chunks = (decoded_size + m_chunk_size - 1) / m_chunk_size;
+
+    if (m_adaptive)
+    {
+        // Each chunk may be split into as many chunks as it has regions.
+        chunks *= (m_chunk_size + s_adaptive_region_size - 1) / s_adaptive_region_size;
+    }
+    bits += chunks * (codes_bits + interleaved_bits) + decoded_size * m_max_code_length;
+
+    return (bits + detail::s_bits_per_byte - 1) / detail::s_bits_per_byte;
+}
+
+//==================================================================================================
+std::unique_ptr<EncoderSession> HuffmanEncoder::create_encoder_session(std::ostream &encoded)
+{
+    return std::make_unique<Session>(m_chunk_size, m_max_code_length, m_adaptive, encoded);
+}
+
+//==================================================================================================
+void HuffmanEncoder::set_stage_timing(bool enabled)
+{
+    m_stage_timing = enabled;
+
+    if (m_stage_timing)
+    {
+        m_stages = {};
+    }
+}
+
+//==================================================================================================
+HuffmanEncoderStages const &HuffmanEncoder::stage_durations() const
+{
+    return m_stages;
+}
+
 //==================================================================================================
 bool HuffmanEncoder::encode_binary(std::istream &decoded, fly::BitStreamWriter &encoded)
+{
+    return encode_chunks(
+        [&decoded](HuffmanEncoder &encoder) { return encoder.read_stream(decoded); },
+        encoded);
+}
+
+//==================================================================================================
+std::optional<std::size_t>
+HuffmanEncoder::encode_span(std::span<std::byte const> decoded, std::span<std::byte> encoded)
+{
+    detail::SpanStreamBuffer buffer(encoded);
+    std::ostream stream(&buffer);
+    fly::BitStreamWriter writer(stream, detail::s_default_block_size);
+
+    std::size_t position = 0;
+
+    auto read_chunk = [&decoded, &position](HuffmanEncoder &encoder) {
+        std::size_t const size =
+            std::min<std::size_t>(decoded.size() - position, encoder.m_chunk_size);
+
+        encoder.m_chunk = reinterpret_cast<symbol_type const *>(decoded.data() + position);
+        position += size;
+
+        return static_cast<std::uint32_t>(size);
+    };
+
+    if (encode_chunks(read_chunk, writer))
+    {
+        return buffer.size();
+    }
+
+    return std::nullopt;
+}
+
+//==================================================================================================
+bool HuffmanEncoder::encode_chunks(ChunkReader const &read_chunk, fly::BitStreamWriter &encoded)
 {
     if (m_max_code_length >= std::numeric_limits<code_type>::digits)
     {
@@ -39,24 +530,225 @@ bool HuffmanEncoder::encode_binary(std::istream &decoded, fly::BitStreamWriter &
 
     encode_header(encoded);
 
-    m_chunk_buffer = std::make_unique<symbol_type[]>(m_chunk_size);
-    std::uint32_t chunk_size = 0;
+    auto const read_next_chunk = [this, &read_chunk](HuffmanEncoder &encoder) {
+        StageTimer timer(m_stage_timing, m_stages.m_bit_io);
+        return read_chunk(encoder);
+    };
 
-    while ((chunk_size = read_stream(decoded)) > 0)
+    if (m_task_runner)
     {
-        create_tree(chunk_size);
-        create_codes();
+        encode_chunks_concurrently(read_next_chunk, encoded);
+    }
+    else
+    {
+        std::uint32_t chunk_size = 0;
 
-        encode_codes(encoded);
-        encode_symbols(chunk_size, encoded);
+        while ((chunk_size = read_next_chunk(*this)) > 0)
+        {
+            encode_chunk(chunk_size, encoded);
+        }
     }
 
+    StageTimer timer(m_stage_timing, m_stages.m_bit_io);
     return encoded.finish();
 }
 
 //==================================================================================================
-std::uint32_t HuffmanEncoder::read_stream(std::istream &decoded) const
+void HuffmanEncoder::encode_chunks_concurrently(
+    ChunkReader const &read_chunk,
+    fly::BitStreamWriter &encoded)
+{
+    std::size_t const threads = std::max(std::thread::hardware_concurrency(), 1U);
+    std::vector<std::unique_ptr<HuffmanEncoder>> encoders(threads * s_chunks_per_thread);
+
+    for (auto &encoder : encoders)
+    {
+        encoder.reset(
+            new HuffmanEncoder(m_chunk_size, m_max_code_length, m_interleaved, m_adaptive));
+        encoder->m_stage_timing = m_stage_timing;
+    }
+
+    bool fully_read = false;
+
+    while (!fully_read)
+    {
+        std::vector<std::future<std::string>> chunks;
+        chunks.reserve(encoders.size());
+
+        for (auto &encoder : encoders)
+        {
+            std::uint32_t const chunk_size = read_chunk(*encoder);
+
+            if (chunk_size == 0)
+            {
+                fully_read = true;
+                break;
+            }
+
+            auto task = [encoder = encoder.get(), chunk_size]() {
+                return encoder->encode_chunk(chunk_size);
+            };
+
+            chunks.push_back(m_task_runner->post_task_with_future(FROM_HERE, std::move(task)));
+        }
+
+        // Every chunk must be waited upon before any is consumed, as consuming a chunk may throw
+        // and the encoders may not be re-used or destroyed while a task is using them.
+        for (auto const &chunk : chunks)
+        {
+            chunk.wait();
+        }
+
+        for (auto &chunk : chunks)
+        {
+            std::string const encoded_chunk = chunk.get();
+
+            StageTimer timer(m_stage_timing, m_stages.m_bit_io);
+            append_chunk(encoded_chunk, encoded);
+        }
+    }
+
+    for (auto const &encoder : encoders)
+    {
+        m_stages.m_histogram += encoder->m_stages.m_histogram;
+        m_stages.m_tree += encoder->m_stages.m_tree;
+        m_stages.m_emission += encoder->m_stages.m_emission;
+        m_stages.m_bit_io += encoder->m_stages.m_bit_io;
+    }
+}
+
+//==================================================================================================
+std::string HuffmanEncoder::encode_chunk(std::uint32_t chunk_size)
+{
+    std::ostringstream stream(std::ios::out | std::ios::binary);
+    fly::BitStreamWriter encoded(stream, detail::s_default_block_size);
+
+    encode_chunk(chunk_size, encoded);
+
+    StageTimer timer(m_stage_timing, m_stages.m_bit_io);
+    encoded.finish();
+
+    return stream.str();
+}
+
+//==================================================================================================
+void HuffmanEncoder::encode_chunk(std::uint32_t chunk_size, fly::BitStreamWriter &encoded)
+{
+    if (m_adaptive)
+    {
+        encode_adaptive_chunks(chunk_size, encoded);
+        return;
+    }
+
+    SymbolCounts counts {};
+    {
+        StageTimer timer(m_stage_timing, m_stages.m_histogram);
+        count_symbols(m_chunk, chunk_size, counts);
+    }
+
+    encode_single_chunk(counts, chunk_size, encoded);
+}
+
+//==================================================================================================
+void HuffmanEncoder::encode_single_chunk(
+    SymbolCounts const &counts,
+    std::uint32_t chunk_size,
+    fly::BitStreamWriter &encoded)
+{
+    {
+        StageTimer timer(m_stage_timing, m_stages.m_tree);
+        compute_code_lengths(counts);
+        create_codes();
+    }
+
+    StageTimer timer(m_stage_timing, m_stages.m_emission);
+    encode_codes(encoded);
+    encode_symbols(chunk_size, encoded);
+}
+
+//==================================================================================================
+void HuffmanEncoder::encode_adaptive_chunks(std::uint32_t chunk_size, fly::BitStreamWriter &encoded)
+{
+    symbol_type const *chunk = m_chunk;
+
+    SymbolCounts counts {};
+    std::uint32_t size = 0;
+
+    for (std::uint32_t start = 0; start < chunk_size; start += s_adaptive_region_size)
+    {
+        std::uint32_t const region_size = std::min(s_adaptive_region_size, chunk_size - start);
+
+        SymbolCounts region_counts {};
+        bool split = false;
+        {
+            StageTimer timer(m_stage_timing, m_stages.m_histogram);
+            count_symbols(chunk + start, region_size, region_counts);
+
+            split = (size > 0) &&
+                should_split_chunk(counts, size, region_counts, region_size, m_max_code_length);
+        }
+
+        if (split)
+        {
+            encode_single_chunk(counts, size, encoded);
+
+            m_chunk += size;
+            counts = {};
+            size = 0;
+        }
+
+        for (std::size_t i = 0; i < counts.size(); ++i)
+        {
+            counts[i] += region_counts[i];
+        }
+
+        size += region_size;
+    }
+
+    if (size > 0)
+    {
+        encode_single_chunk(counts, size, encoded);
+    }
+
+    m_chunk = chunk;
+}
+
+//==================================================================================================
+void HuffmanEncoder::append_chunk(std::string const &chunk, fly::BitStreamWriter &encoded)
 {
+    // The first byte is the chunk's BitStream header, which holds the number of zero-filled bits at
+    // the end of the chunk.
+    if (chunk.size() <= detail::s_byte_type_size)
+    {
+        return;
+    }
+
+    auto const header = static_cast<byte_type>(chunk[0]);
+    auto const remainder =
+        static_cast<byte_type>((header >> detail::s_remainder_shift) & detail::s_remainder_mask);
+
+    char const *data = chunk.data() + detail::s_byte_type_size;
+    std::size_t const size = chunk.size() - detail::s_byte_type_size;
+
+    // Append all but the last byte as is, and the last byte without its zero-filled bits.
+    write_bytes(data, size - 1, encoded);
+
+    auto const last = static_cast<byte_type>(data[size - 1]);
+    encoded.write_bits(
+        static_cast<byte_type>(last >> remainder),
+        static_cast<byte_type>(detail::s_bits_per_byte - remainder));
+}
+
+//==================================================================================================
+std::uint32_t HuffmanEncoder::read_stream(std::istream &decoded)
+{
+    if (!m_chunk_buffer)
+    {
+        m_chunk_buffer = std::make_unique<symbol_type[]>(m_chunk_size);
+    }
+
+    m_chunk = m_chunk_buffer.get();
+
     decoded.read(
         reinterpret_cast<std::ios::char_type *>(m_chunk_buffer.get()),
         static_cast<std::streamsize>(m_chunk_size));
@@ -65,128 +757,191 @@ std::uint32_t HuffmanEncoder::read_stream(std::istream &decoded) const
 }
 
 //==================================================================================================
-void HuffmanEncoder::create_tree(std::uint32_t chunk_size)
+void HuffmanEncoder::count_symbols(
+    symbol_type const *symbols,
+    std::uint32_t size,
+    SymbolCounts &counts)
 {
-    std::uint16_t index = 0;
-
-    // Create a frequency map of each input symbol.
-    std::array<frequency_type, 1 << 8> counts {};
-
-    for (std::uint32_t i = 0; i < chunk_size; ++i)
+    for (std::uint32_t i = 0; i < size; ++i)
     {
-        ++counts[m_chunk_buffer[i]];
+        ++counts[symbols[i]];
     }
+}
+
+//==================================================================================================
+void HuffmanEncoder::compute_code_lengths(SymbolCounts const &counts)
+{
+    static constexpr frequency_type s_symbol_mask = std::numeric_limits<symbol_type>::max();
+    static constexpr int s_symbol_shift = std::numeric_limits<symbol_type>::digits;
 
-    // Create a priority queue of HuffmanNode, sorted such that the least common symbol is on top.
-    HuffmanNodeQueue queue;
+    // Sort the symbols by frequency, least common first. Frequencies are bounded by the chunk size,
+    // so each symbol is packed into the low bits of its frequency to be sorted as a single integer.
+    std::array<frequency_type, 1 << 8> weights;
+    std::uint16_t size = 0;
     symbol_type symbol = 0;
 
     do
     {
         if (counts[symbol] > 0)
         {
-            HuffmanNode *node = &m_huffman_tree[++index];
-            node->become_symbol(symbol, counts[symbol]);
-            queue.push(node);
+            weights[size++] = (counts[symbol] << s_symbol_shift) | symbol;
         }
     } while (++symbol != 0);
 
-    // Convert the priority queue to a Huffman tree. Remove the two least common symbols, combining
-    // their frequencies into a new node, and insert the new node back into the priority queue.
-    // Continue until only the root remains.
-    while (queue.size() > 1)
+    std::sort(weights.begin(), weights.begin() + size);
+
+    std::array<symbol_type, 1 << 8> symbols;
+
+    for (std::uint16_t i = 0; i < size; ++i)
     {
-        auto *left = queue.top();
-        queue.pop();
+        symbols[i] = static_cast<symbol_type>(weights[i] & s_symbol_mask);
+        weights[i] >>= s_symbol_shift;
+    }
 
-        auto *right = queue.top();
-        queue.pop();
+    if (size == 1)
+    {
+        // Single-symbol chunks occur when the input stream contains only one unique symbol. Set its
+        // length to one so a single bit is encoded for each occurrence of that symbol.
+        weights[0] = 1;
+    }
+    else
+    {
+        compute_minimum_redundancy(weights.data(), size);
+    }
+
+    // The least common symbols have the longest codes. Store the codes in reverse order so they are
+    // sorted by code length.
+    m_huffman_codes_size = size;
+
+    for (std::uint16_t i = 0; i < size; ++i)
+    {
+        HuffmanCode &code = m_huffman_codes[size - i - 1_u16];
 
-        HuffmanNode *node = &m_huffman_tree[++index];
-        node->become_intermediate(left, right);
-        queue.push(node);
+        code.m_symbol = symbols[i];
+        code.m_code = 0;
+        code.m_length = static_cast<length_type>(weights[i]);
     }
 
-    HuffmanNode *node = queue.top();
-    m_huffman_tree[0] = std::move(*node);
+    if (m_adaptive)
+    {
+        select_max_code_length(counts);
+    }
+    else if (weights[0] > m_max_code_length)
+    {
+        limit_code_lengths(m_max_code_length);
+    }
 }
 
 //==================================================================================================
-void HuffmanEncoder::create_codes()
+void HuffmanEncoder::select_max_code_length(SymbolCounts const &counts)
 {
-    std::stack<HuffmanNode const *> pending;
-    std::stack<HuffmanNode const *> path;
+    // The codes are sorted by code length, so the last code is the longest.
+    length_type const longest = m_huffman_codes[m_huffman_codes_size - 1_u16].m_length;
+    length_type const upper = std::min(longest, m_max_code_length);
 
-    length_type max_code_length = 0;
-    m_huffman_codes_size = 0;
+    // The shortest maximum code length which may represent every symbol: N symbols need codes of
+    // ceil(log2(N)) bits, though a single symbol still needs a 1-bit code.
+    auto const max_code = static_cast<unsigned int>(m_huffman_codes_size - 1);
+    auto const lower = static_cast<length_type>(std::max<int>(std::bit_width(max_code), 1));
 
-    // Symbol frequency is no longer needed. Use that field to form codes.
-    m_huffman_tree[0].m_frequency = 0;
+    std::array<length_type, 1 << 8> lengths;
 
-    HuffmanNode const *node = nullptr;
-    pending.push(&m_huffman_tree[0]);
-
-    while (!pending.empty())
+    for (std::uint16_t i = 0; i < m_huffman_codes_size; ++i)
     {
-        node = pending.top();
+        lengths[i] = m_huffman_codes[i].m_length;
+    }
 
-        if (!path.empty() && (node == path.top()))
+    // Length-limit the codes from their original lengths, and compute the resulting size of the
+    // codes and encoded symbols.
+    auto limit_and_measure = [this, &counts, &lengths, longest](length_type max_code_length) {
+        for (std::uint16_t i = 0; i < m_huffman_codes_size; ++i)
         {
-            pending.pop();
-            path.pop();
+            m_huffman_codes[i].m_length = lengths[i];
         }
-        else
-        {
-            if ((node->m_left == nullptr) || (node->m_right == nullptr))
-            {
-                auto const code = static_cast<code_type>(node->m_frequency);
-                auto const length = static_cast<length_type>(path.size());
-                max_code_length = std::max(max_code_length, length);
 
-                insert_code(HuffmanCode(node->m_symbol, code, length));
-            }
-            else
-            {
-                node->m_left->m_frequency = node->m_frequency << 1;
-                pending.push(node->m_left);
+        if (longest > max_code_length)
+        {
+            limit_code_lengths(max_code_length);
+        }
 
-                node->m_right->m_frequency = (node->m_frequency << 1) + 1;
-                pending.push(node->m_right);
-            }
+        std::uint64_t bits = (max_code_length + 1_u64) * detail::s_bits_per_word;
 
-            path.push(node);
+        for (std::uint16_t i = 0; i < m_huffman_codes_size; ++i)
+        {
+            HuffmanCode const &code = m_huffman_codes[i];
+            bits += counts[code.m_symbol] * code.m_length;
         }
-    }
 
-    if (max_code_length > m_max_code_length)
+        return bits;
+    };
+
+    std::uint64_t const target_bits =
+        limit_and_measure(upper) * (s_adaptive_code_length_tolerance + 1);
+
+    for (length_type length = lower; length < upper; ++length)
     {
-        limit_code_lengths();
+        if ((limit_and_measure(length) * s_adaptive_code_length_tolerance) <= target_bits)
+        {
+            return;
+        }
     }
 
-    convert_to_canonical_form();
+    limit_and_measure(upper);
 }
 
 //==================================================================================================
-void HuffmanEncoder::insert_code(HuffmanCode &&code)
+void HuffmanEncoder::create_codes()
 {
-    std::uint16_t pos = m_huffman_codes_size++;
+    std::array<length_type, 1 << 8> lengths {};
+    std::array<std::uint16_t, std::numeric_limits<code_type>::digits + 1> counts {};
 
-    for (; (pos > 0) && (code < m_huffman_codes[pos - 1_u16]); --pos)
+    for (std::uint16_t i = 0; i < m_huffman_codes_size; ++i)
     {
-        m_huffman_codes[pos] = std::move(m_huffman_codes[pos - 1_u16]);
+        HuffmanCode const &code = m_huffman_codes[i];
+
+        lengths[code.m_symbol] = code.m_length;
+        ++counts[code.m_length];
     }
 
-    m_huffman_codes[pos] = std::move(code);
+    // Compute the first canonical code and the first position in the list of codes for each code
+    // length. The first code of each length is one greater than the last code of the previous
+    // length, bit-shifted left to maintain the new length.
+    decltype(counts) positions {};
+    std::array<code_type, counts.size()> next_codes {};
+
+    code_type next_code = 0;
+    std::uint16_t position = 0;
+
+    for (std::size_t length = 1; length < counts.size(); ++length)
+    {
+        next_code = static_cast<code_type>((next_code + counts[length - 1]) << 1);
+        next_codes[length] = next_code;
+
+        positions[length] = position;
+        position += counts[length];
+    }
+
+    // Assign codes in order of symbol value, so that codes of the same length are sorted by symbol.
+    symbol_type symbol = 0;
+
+    do
+    {
+        if (length_type const length = lengths[symbol]; length > 0)
+        {
+            m_huffman_codes[positions[length]++] =
+                HuffmanCode(symbol, next_codes[length]++, length);
+        }
+    } while (++symbol != 0);
 }
 
 //==================================================================================================
-void HuffmanEncoder::limit_code_lengths()
+void HuffmanEncoder::limit_code_lengths(length_type max_code_length)
 {
-    auto compute_kraft = [this](HuffmanCode const &code) -> code_type {
-        return 1_u16 << (m_max_code_length - code.m_length);
+    auto compute_kraft = [max_code_length](HuffmanCode const &code) -> code_type {
+        return 1_u16 << (max_code_length - code.m_length);
     };
 
-    code_type const max_allowed_kraft = (1_u16 << m_max_code_length) - 1;
+    code_type const max_allowed_kraft = (1_u16 << max_code_length) - 1;
     code_type kraft = 0;
 
     // Limit all Huffman codes to not be larger than the maximum code length. Compute the Kraft
@@ -195,7 +950,7 @@ void HuffmanEncoder::limit_code_lengths()
     {
         HuffmanCode &code = m_huffman_codes[i];
 
-        code.m_length = std::min(code.m_length, m_max_code_length);
+        code.m_length = std::min(code.m_length, max_code_length);
         kraft += compute_kraft(code);
     }
 
@@ -205,7 +960,7 @@ void HuffmanEncoder::limit_code_lengths()
     {
         HuffmanCode &code = m_huffman_codes[i];
 
-        while (code.m_length < m_max_code_length)
+        while (code.m_length < max_code_length)
         {
             ++code.m_length;
             kraft -= compute_kraft(code);
@@ -227,36 +982,12 @@ void HuffmanEncoder::limit_code_lengths()
     }
 }
 
-//==================================================================================================
-void HuffmanEncoder::convert_to_canonical_form()
-{
-    // First code is always set to zero. Its length does not change.
-    m_huffman_codes[0].m_code = 0;
-
-    if (m_huffman_codes_size == 1)
-    {
-        // Single-node Huffman trees occur when the input stream contains only one unique symbol.
-        // Set its length to one so a single bit is encoded for each occurrence of that symbol.
-        m_huffman_codes[0].m_length = 1;
-    }
-
-    for (std::uint16_t i = 1; i < m_huffman_codes_size; ++i)
-    {
-        HuffmanCode const &previous = m_huffman_codes[i - 1_u16];
-        HuffmanCode &code = m_huffman_codes[i];
-
-        // Subsequent codes are one greater than the previous code, but also bit-shifted left enough
-        // times to maintain the same code length.
-        code.m_code = previous.m_code + 1;
-        code.m_code <<= code.m_length - previous.m_length;
-    }
-}
-
 //==================================================================================================
 void HuffmanEncoder::encode_header(fly::BitStreamWriter &encoded) const
 {
     // Encode the Huffman coder version.
-    encoded.write_byte(static_cast<byte_type>(s_huffman_version));
+    encoded.write_byte(
+        static_cast<byte_type>(m_interleaved ? s_huffman_version_interleaved : s_huffman_version));
 
     // Encode the chunk size.
     encoded.write_word(static_cast<word_type>(m_chunk_size >> 10));
@@ -311,13 +1042,74 @@ void HuffmanEncoder::encode_symbols(std::uint32_t chunk_size, fly::BitStreamWrit
         symbols[code.m_symbol] = std::move(code);
     }
 
+    if (m_interleaved)
+    {
+        encode_interleaved_symbols(symbols, chunk_size, encoded);
+        return;
+    }
+
     for (std::uint32_t i = 0; i < chunk_size; ++i)
     {
-        HuffmanCode const &code = symbols[m_chunk_buffer[i]];
+        HuffmanCode const &code = symbols[m_chunk[i]];
         auto const length = static_cast<byte_type>(code.m_length);
 
         encoded.write_bits(code.m_code, length);
     }
 }
 
+//==================================================================================================
+void HuffmanEncoder::encode_interleaved_symbols(
+    std::array<HuffmanCode, 1 << 8> const &symbols,
+    std::uint32_t chunk_size,
+    fly::BitStreamWriter &encoded) const
+{
+    static constexpr auto s_word_bits =
+        static_cast<byte_type>(std::numeric_limits<std::uint32_t>::digits);
+
+    std::uint32_t const segment_size = chunk_size / s_interleaved_stream_count;
+    std::uint32_t const remainder = chunk_size % s_interleaved_stream_count;
+
+    std::array<symbol_type const *, s_interleaved_stream_count> segments;
+    std::vector<InterleavedStream> streams;
+    streams.reserve(s_interleaved_stream_count);
+
+    for (std::uint32_t i = 0, start = 0; i < s_interleaved_stream_count; ++i)
+    {
+        segments[i] = m_chunk + start;
+        start += segment_size + ((i < remainder) ? 1 : 0);
+
+        streams.emplace_back(segment_size);
+    }
+
+    // Encode one symbol from each segment at a time. Each stream has its own buffer, so the
+    // encoding of each segment is independent of the others.
+    for (std::uint32_t i = 0; i < segment_size; ++i)
+    {
+        for (std::uint32_t j = 0; j < s_interleaved_stream_count; ++j)
+        {
+            HuffmanCode const &code = symbols[segments[j][i]];
+            streams[j].write(code.m_code, code.m_length);
+        }
+    }
+
+    for (std::uint32_t j = 0; j < remainder; ++j)
+    {
+        HuffmanCode const &code = symbols[segments[j][segment_size]];
+        streams[j].write(code.m_code, code.m_length);
+    }
+
+    encoded.write_bits(chunk_size, s_word_bits);
+
+    for (auto &stream : streams)
+    {
+        stream.finish();
+        encoded.write_bits(static_cast<std::uint32_t>(stream.bytes().size()), s_word_bits);
+    }
+
+    for (auto const &stream : streams)
+    {
+        write_bytes(stream.bytes().data(), stream.bytes().size(), encoded);
+    }
+}
+
 } // namespace fly::coders
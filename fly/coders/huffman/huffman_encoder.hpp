@@ -4,21 +4,71 @@
 #include "fly/coders/huffman/types.hpp"
 
 #include <array>
+#include <chrono>
+#include <cstddef>
+#include <functional>
 #include <istream>
 #include <memory>
+#include <optional>
+#include <span>
+#include <string>
 
 namespace fly {
 class BitStreamWriter;
 } // namespace fly
 
+namespace fly::task {
+class TaskRunner;
+} // namespace fly::task
+
 namespace fly::coders {
 
 class CoderConfig;
 
+/**
+ * Time spent in each stage of Huffman encoding, summed over every chunk encoded while stage timing
+ * was enabled. If chunks are encoded concurrently, the time spent by each task is summed, so the
+ * total may exceed the time spent encoding.
+ */
+struct HuffmanEncoderStages
+{
+    // Counting the symbols of each chunk, including choosing where to split adaptive chunks.
+    std::chrono::nanoseconds m_histogram {0};
+
+    // Computing the length-limited code lengths and the canonical codes of each chunk.
+    std::chrono::nanoseconds m_tree {0};
+
+    // Writing the codes and the encoded symbols of each chunk into a bit stream.
+    std::chrono::nanoseconds m_emission {0};
+
+    // Reading each chunk from the input, and finishing or appending the encoded bit streams. Bytes
+    // which are flushed to the output while writing codes and symbols are included in emission.
+    std::chrono::nanoseconds m_bit_io {0};
+};
+
 /**
  * Implementation of the Encoder interface for Huffman coding. Forms length-limted, canonical
  * Huffman codes to encode symbols.
  *
+ * If created with a task runner, chunks of the input stream are encoded concurrently as tasks
+ * posted to that task runner. Each chunk is encoded into its own buffer, and the buffers are then
+ * concatenated in order, so the encoded output is identical to that of serial encoding. Encoding
+ * blocks the calling thread until all chunks have been encoded, and the task manager must be
+ * running. Encoding must not be invoked from a task running on the provided task runner, as the
+ * encoding tasks could then deadlock waiting for the blocked thread.
+ *
+ * Encoder sessions buffer at most one chunk of the input at a time, and encode each chunk serially
+ * as soon as it is filled. Sessions always encode chunks as interleaved bit streams, regardless of
+ * configuration, as interleaved chunks end on a byte boundary. Thus, the BitStream header never
+ * needs to be rewritten to hold the number of zero-filled bits, and sessions may write to streams
+ * which cannot be repositioned, such as network connections.
+ *
+ * If configured with adaptive chunks, the configured chunk size is instead the maximum chunk size.
+ * Each chunk read from the input is split into smaller chunks where its symbol statistics shift,
+ * and the maximum code length of each chunk is chosen to keep its decoding table small. Adaptive
+ * chunks are always encoded as interleaved bit streams, as only interleaved chunks hold their
+ * symbol count. The encoded stream is decoded by any HuffmanDecoder without changes.
+ *
  * @author Timothy Flynn (trflynn89@pm.me)
  * @version July 7, 2019
  */
@@ -32,6 +82,58 @@ class HuffmanEncoder : public BinaryEncoder
      */
     explicit HuffmanEncoder(std::shared_ptr<CoderConfig> const &config) noexcept;
 
+    /**
+     * Constructor. Chunks of the input stream will be encoded concurrently.
+     *
+     * @param config Reference to coder configuration.
+     * @param task_runner Task runner for posting chunk encoding tasks onto.
+     */
+    HuffmanEncoder(
+        std::shared_ptr<CoderConfig> const &config,
+        std::shared_ptr<fly::task::TaskRunner> task_runner) noexcept;
+
+    /**
+     * Compute an upper bound of the size of the encoding of a sequence of bytes. The bound assumes
+     * each chunk holds every symbol, and that every symbol is encoded with the maximum allowed
+     * Huffman code length.
+     *
+     * @param decoded_size The size of the sequence to encode.
+     *
+     * @return The maximum size of the encoded sequence.
+     */
+    std::size_t max_encoded_size(std::size_t decoded_size) const override;
+
+    /**
+     * Create a session to incrementally Huffman encode a sequence of bytes. The session is created
+     * with this encoder's chunk size and maximum code length, but always encodes serially.
+     *
+     * The session always encodes chunks as interleaved bit streams (Huffman coder version 2), even
+     * if this encoder is not configured to. Interleaved chunks end on a byte boundary, so the
+     * BitStream header never needs to be rewritten once the session is finished, which allows the
+     * session to write to streams which cannot be repositioned. Thus, the encoded output of the
+     * session differs from that of encode_string with the same configuration, though either is
+     * decoded to the same contents by any HuffmanDecoder.
+     *
+     * @param encoded Stream to store the encoded contents. Must outlive the session.
+     *
+     * @return The created session.
+     */
+    std::unique_ptr<EncoderSession> create_encoder_session(std::ostream &encoded) override;
+
+    /**
+     * Enable or disable timing each stage of encoding. Stage timing is disabled by default, as it
+     * reads the clock several times per chunk. Enabling stage timing resets the time spent in each
+     * stage.
+     *
+     * @param enabled Whether to time each stage of encoding.
+     */
+    void set_stage_timing(bool enabled);
+
+    /**
+     * @return The time spent in each stage of encoding while stage timing was enabled.
+     */
+    HuffmanEncoderStages const &stage_durations() const;
+
 protected:
     /**
      * Huffman encode a stream.
@@ -51,15 +153,21 @@ class HuffmanEncoder : public BinaryEncoder
      *
      * The sequence to encode a stream is:
      *
-     *     1. Create a Huffman tree from the input stream.
-     *     2. Generate standard Huffman codes from the Huffman tree.
-     *     3. Length-limit the standard Huffman codes.
-     *     4. Convert the length-limited codes to canonical Huffman codes.
+     *     1. Count the frequency of each symbol in the input stream.
+     *     2. Compute the optimal Huffman code length of each symbol from those frequencies.
+     *     3. Length-limit the Huffman code lengths.
+     *     4. Assign canonical Huffman codes from the length-limited code lengths.
      *     5. Encode the canonical codes.
      *     6. Encode the input stream using the canonical codes.
      *
-     * This sequence involves iterating over the entire input stream twice (to create the Huffman
-     * tree and to encode the stream).
+     * This sequence involves iterating over the entire input stream twice (to count symbols and to
+     * encode the stream).
+     *
+     * The code lengths (step 2) are computed without forming an explicit Huffman tree. Instead, the
+     * symbols are sorted by frequency and the algorithm described by Alistair Moffat and Jyrki
+     * Katajainen in "In-Place Calculation of Minimum-Redundancy Codes" is applied to the sorted
+     * frequencies. This requires no allocations, and only a constant amount of stack space for the
+     * 256 possible symbols.
      *
      * The coder does not assume the Huffman codes are retained between calls. Thus, the codes are
      * encoded before the input stream (step 5) so that they may be learned during decoding.
@@ -84,6 +192,33 @@ class HuffmanEncoder : public BinaryEncoder
      * Encoding the input stream (step 6) consists of reading each symbol from the input stream and
      * outputting that symbol's canonical Huffman code.
      *
+     * If configured to encode interleaved streams, the version of the Huffman coder in the header
+     * is 2 rather than 1, and step 6 differs. Each chunk is split into 4 contiguous segments, and
+     * each segment is encoded into its own bit stream. The segments are encoded in an interleaved
+     * order, one symbol from each segment at a time, so that the CPU may overlap the otherwise
+     * serial dependency chain of appending codes to a single bit stream. The same is then true for
+     * decoding. After the canonical codes, an interleaved chunk contains:
+     *
+     *     |   32 bits    |         4 x 32 bits         |     4 x N bytes    |
+     *     -------------------------------------------------------------------
+     *     | Symbol count | Bit stream lengths (bytes) | Bit stream contents |
+     *
+     * Each bit stream is zero-filled to a byte boundary. The first (symbol count % 4) segments hold
+     * one more symbol than the remaining segments.
+     *
+     * If configured with adaptive chunks, each chunk is first divided into 16 KB regions, and the
+     * symbols of each region are counted. Regions are appended to the current chunk for as long as
+     * their symbols have similar statistics: a new chunk is started when the entropy saved by
+     * encoding a region with its own codes, rather than with codes shared with the current chunk,
+     * exceeds the cost of encoding another set of codes. Thus, chunks grow to the configured size
+     * while the statistics are stable, and shrink to as small as a region when they shift.
+     *
+     * The maximum code length of each adaptive chunk is then chosen as the smallest length whose
+     * encoded size is within 1/512 of the size with the configured maximum code length. Shorter
+     * codes shrink the decoder's tables, which are rebuilt for every chunk, at a negligible cost in
+     * compression ratio. The chosen length is recorded by the number of code length counts, so no
+     * change to the encoded format is needed.
+     *
      * @param decoded Stream holding the contents to encode.
      * @param encoded Stream to store the encoded contents.
      *
@@ -91,50 +226,167 @@ class HuffmanEncoder : public BinaryEncoder
      */
     bool encode_binary(std::istream &decoded, fly::BitStreamWriter &encoded) override;
 
+    /**
+     * Huffman encode a sequence of bytes into a buffer. Chunks are encoded directly from the input
+     * buffer, rather than first being read into the chunk buffer.
+     *
+     * @param decoded Buffer holding the contents to encode.
+     * @param encoded Buffer to store the encoded contents.
+     *
+     * @return If successful, the number of bytes written to the encoded buffer. Otherwise, an
+     *         uninitialized value.
+     */
+    std::optional<std::size_t>
+    encode_span(std::span<std::byte const> decoded, std::span<std::byte> encoded) override;
+
 private:
+    class Session;
+
+    /**
+     * Callable to provide the next chunk to encode. The callable should point the given encoder's
+     * current chunk at the chunk's contents and return the chunk's size, or 0 if there are no more
+     * chunks.
+     */
+    using ChunkReader = std::function<std::uint32_t(HuffmanEncoder &)>;
+
+    /**
+     * The number of occurrences of each symbol in a chunk.
+     */
+    using SymbolCounts = std::array<frequency_type, 1 << 8>;
+
+    /**
+     * Constructor. Create an encoder to encode single chunks on behalf of a concurrent encoder.
+     *
+     * @param chunk_size The maximum chunk size (in bytes).
+     * @param max_code_length The maximum allowed Huffman code length.
+     * @param interleaved Whether to encode each chunk as interleaved bit streams.
+     * @param adaptive Whether to adapt the size and maximum code length of each chunk.
+     */
+    HuffmanEncoder(
+        std::uint32_t chunk_size,
+        length_type max_code_length,
+        bool interleaved,
+        bool adaptive) noexcept;
+
+    /**
+     * Encode the header and each chunk provided by a chunk reader to the output stream.
+     *
+     * @param read_chunk Callable to provide the next chunk to encode.
+     * @param encoded Stream to store the encoded contents.
+     *
+     * @return True if the chunks were successfully encoded.
+     */
+    bool encode_chunks(ChunkReader const &read_chunk, fly::BitStreamWriter &encoded);
+
+    /**
+     * Encode chunks in groups, encoding each group of chunks concurrently on the task runner. Each
+     * chunk is encoded into its own stream by a separate encoder, and the encoded chunks are then
+     * appended in order to the output stream.
+     *
+     * @param read_chunk Callable to provide the next chunk to encode.
+     * @param encoded Stream to store the encoded contents.
+     */
+    void encode_chunks_concurrently(ChunkReader const &read_chunk, fly::BitStreamWriter &encoded);
+
+    /**
+     * Encode the current chunk into its own stream.
+     *
+     * @param chunk_size The number of bytes the current chunk holds.
+     *
+     * @return The stream holding the encoded chunk.
+     */
+    std::string encode_chunk(std::uint32_t chunk_size);
+
+    /**
+     * Encode the current chunk to the output stream. If configured with adaptive chunks, the chunk
+     * may be encoded as multiple smaller chunks.
+     *
+     * @param chunk_size The number of bytes the current chunk holds.
+     * @param encoded Stream to store the encoded chunk.
+     */
+    void encode_chunk(std::uint32_t chunk_size, fly::BitStreamWriter &encoded);
+
+    /**
+     * Encode the current chunk to the output stream as a single chunk.
+     *
+     * @param counts The number of occurrences of each symbol in the current chunk.
+     * @param chunk_size The number of bytes the current chunk holds.
+     * @param encoded Stream to store the encoded chunk.
+     */
+    void encode_single_chunk(
+        SymbolCounts const &counts,
+        std::uint32_t chunk_size,
+        fly::BitStreamWriter &encoded);
+
+    /**
+     * Split the current chunk into smaller chunks wherever the symbol statistics of the chunk
+     * shift, and encode each of those chunks to the output stream.
+     *
+     * @param chunk_size The number of bytes the current chunk holds.
+     * @param encoded Stream to store the encoded chunks.
+     */
+    void encode_adaptive_chunks(std::uint32_t chunk_size, fly::BitStreamWriter &encoded);
+
+    /**
+     * Append a chunk which was encoded into its own stream to the output stream. The chunk is
+     * appended bit-for-bit, i.e. without the chunk's BitStream header or zero-filled bits.
+     *
+     * @param chunk The stream holding the encoded chunk.
+     * @param encoded Stream to store the encoded chunk.
+     */
+    static void append_chunk(std::string const &chunk, fly::BitStreamWriter &encoded);
+
     /**
      * Read the stream into a buffer, up to a static maximum size, storing bytes in the chunk
-     * buffer.
+     * buffer. The current chunk is pointed at the chunk buffer.
      *
      * @param decoded Stream holding the contents to encode.
      *
      * @return The number of bytes that were read.
      */
-    std::uint32_t read_stream(std::istream &decoded) const;
+    std::uint32_t read_stream(std::istream &decoded);
 
     /**
-     * Create a Huffman tree from the current chunk buffer.
+     * Count the number of occurrences of each symbol in a sequence of symbols.
      *
-     * @param chunk_size The number of bytes the chunk buffer holds.
+     * @param symbols The symbols to count.
+     * @param size The number of symbols to count.
+     * @param counts The location to add the counts to.
      */
-    void create_tree(std::uint32_t chunk_size);
+    static void count_symbols(symbol_type const *symbols, std::uint32_t size, SymbolCounts &counts);
 
     /**
-     * Create a list of Huffman codes from the generated Huffman tree. The list of codes will be in
-     * canonical form.
+     * Compute the Huffman code length of each symbol in the current chunk. The list of codes
+     * will be sorted by code length, but will not yet hold canonical codes.
+     *
+     * @param counts The number of occurrences of each symbol in the current chunk.
      */
-    void create_codes();
+    void compute_code_lengths(SymbolCounts const &counts);
 
     /**
-     * Insert a new Huffman code into the list of already sorted codes.
+     * Choose the smallest maximum code length whose encoded size of the current chunk is within a
+     * small tolerance of the encoded size with the configured maximum code length, and length-limit
+     * the generated Huffman codes to that length.
      *
-     * @param code The Huffman code to insert.
+     * @param counts The number of occurrences of each symbol in the current chunk.
      */
-    void insert_code(HuffmanCode &&code);
+    void select_max_code_length(SymbolCounts const &counts);
 
     /**
-     * Length-limit the generated Huffman codes to a static maximum size, using a method described
-     * in Charles Bloom's blog, which is based around the Kraft-McMillan inequality:
+     * Length-limit the generated Huffman codes to a maximum size, using a method described in
+     * Charles Bloom's blog, which is based around the Kraft-McMillan inequality:
      *
      * https://cbloomrants.blogspot.com/2010/07/07-03-10-length-limitted-huffman-codes.html
+     *
+     * @param max_code_length The maximum allowed Huffman code length.
      */
-    void limit_code_lengths();
+    void limit_code_lengths(length_type max_code_length);
 
     /**
-     * Convert the generated list of standard Huffman codes into canonical form. It is assumed that
-     * the codes are already sorted in accordance with canonical form.
+     * Assign canonical Huffman codes from the computed code lengths. The list of codes will be
+     * sorted in accordance with canonical form, i.e. by code length and then by symbol.
      */
-    void convert_to_canonical_form();
+    void create_codes();
 
     /**
      * Encode the header to the output stream.
@@ -151,27 +403,45 @@ class HuffmanEncoder : public BinaryEncoder
     void encode_codes(fly::BitStreamWriter &encoded) const;
 
     /**
-     * Encode symbols from the current chunk buffer with the generated list of Huffman codes. The
+     * Encode symbols from the current chunk with the generated list of Huffman codes. The
      * list of codes is effectively destroyed as its elements are moved to a map for faster lookups.
      *
-     * @param chunk_size The number of bytes the chunk buffer holds.
+     * @param chunk_size The number of bytes the current chunk holds.
      * @param encoded Stream to store the encoded symbols.
      */
     void encode_symbols(std::uint32_t chunk_size, fly::BitStreamWriter &encoded);
 
+    /**
+     * Encode symbols from the current chunk as interleaved bit streams.
+     *
+     * @param symbols The generated Huffman codes, indexed by symbol.
+     * @param chunk_size The number of bytes the current chunk holds.
+     * @param encoded Stream to store the encoded symbols.
+     */
+    void encode_interleaved_symbols(
+        std::array<HuffmanCode, 1 << 8> const &symbols,
+        std::uint32_t chunk_size,
+        fly::BitStreamWriter &encoded) const;
+
+    std::shared_ptr<fly::task::TaskRunner> m_task_runner;
+
     // Configuration.
     std::uint32_t const m_chunk_size;
     length_type const m_max_code_length;
+    bool const m_interleaved;
+    bool const m_adaptive;
+
+    bool m_stage_timing {false};
+    HuffmanEncoderStages m_stages;
 
     std::unique_ptr<symbol_type[]> m_chunk_buffer;
 
+    // The chunk being encoded, either the chunk buffer or a chunk of a contiguous input buffer.
+    symbol_type const *m_chunk {nullptr};
+
     // Sized to fit 8-bit ASCII symbols.
     std::array<HuffmanCode, 1 << 8> m_huffman_codes;
     std::uint16_t m_huffman_codes_size;
-
-    // Sized to fit a complete Huffman tree. With 8-bit symbols, a complete tree
-    // will have a height of 9, and 2^9 - 1 = 511 nodes (round to 512).
-    std::array<HuffmanNode, 1 << 9> m_huffman_tree;
 };
 
 } // namespace fly::coders
@@ -2,53 +2,6 @@
 
 namespace fly::coders {
 
-//==================================================================================================
-HuffmanNode::HuffmanNode() noexcept :
-    m_symbol(0),
-    m_frequency(0),
-    m_left(nullptr),
-    m_right(nullptr)
-{
-}
-
-//==================================================================================================
-HuffmanNode &HuffmanNode::operator=(HuffmanNode &&node) noexcept
-{
-    m_symbol = node.m_symbol;
-    m_frequency = node.m_frequency;
-    m_left = node.m_left;
-    m_right = node.m_right;
-
-    node.m_left = nullptr;
-    node.m_right = nullptr;
-
-    return *this;
-}
-
-//==================================================================================================
-void HuffmanNode::become_symbol(symbol_type symbol, frequency_type frequency)
-{
-    m_symbol = symbol;
-    m_frequency = frequency;
-    m_left = nullptr;
-    m_right = nullptr;
-}
-
-//==================================================================================================
-void HuffmanNode::become_intermediate(HuffmanNode *left, HuffmanNode *right)
-{
-    m_symbol = 0;
-    m_frequency = left->m_frequency + right->m_frequency;
-    m_left = left;
-    m_right = right;
-}
-
-//==================================================================================================
-bool HuffmanNodeComparator::operator()(HuffmanNode const *left, HuffmanNode const *right)
-{
-    return left->m_frequency > right->m_frequency;
-}
-
 //==================================================================================================
 HuffmanCode::HuffmanCode() noexcept :
     m_symbol(0),
@@ -1,8 +1,7 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
-#include <queue>
-#include <vector>
 
 namespace fly::coders {
 
@@ -12,74 +11,8 @@ using frequency_type = std::uint64_t;
 using code_type = std::uint16_t;
 using length_type = std::uint8_t;
 
-struct HuffmanNode;
-struct HuffmanNodeComparator;
-
-using HuffmanNodeQueue =
-    std::priority_queue<HuffmanNode *, std::vector<HuffmanNode *>, HuffmanNodeComparator>;
-
-/**
- * Struct to store data for a single node in a Huffman tree. Huffman trees are binary trees. A node
- * represents either a symbol from the input stream and its frequency, or the node is a junction
- * storing the sum total of the frequencies of each node in its subtree.
- *
- * @author Timothy Flynn (trflynn89@pm.me)
- * @version July 7, 2019
- */
-struct HuffmanNode
-{
-    /**
-     * Default constructor. Set all fields to zero/null.
-     */
-    HuffmanNode() noexcept;
-
-    /**
-     * Move assignment operator. Move all member variables from the given HuffmanNode instance into
-     * this instance.
-     *
-     * @param node The HuffmanNode instance to move.
-     */
-    HuffmanNode &operator=(HuffmanNode &&node) noexcept;
-
-    /**
-     * Change this node to represent a symbol from the input stream.
-     *
-     * @param symbol The symbol from the input stream.
-     * @param frequency The frequency of the symbol in the input stream.
-     */
-    void become_symbol(symbol_type symbol, frequency_type frequency);
-
-    /**
-     * Change this node to represent an intermediate, non-symbol. Its frequency is set to the sum of
-     * its children's frequencies.
-     *
-     * @param left Pointer to the intermediate's left child.
-     * @param right Pointer to the intermediate's right child.
-     */
-    void become_intermediate(HuffmanNode *left, HuffmanNode *right);
-
-    symbol_type m_symbol;
-    frequency_type m_frequency;
-
-    HuffmanNode *m_left;
-    HuffmanNode *m_right;
-
-private:
-    HuffmanNode(HuffmanNode const &) = delete;
-    HuffmanNode &operator=(HuffmanNode const &) = delete;
-};
-
-/**
- * Comparator for HuffmanNode to be sorted such that the node with the lowest frequency has the
- * highest priority.
- *
- * @author Timothy Flynn (trflynn89@pm.me)
- * @version July 7, 2019
- */
-struct HuffmanNodeComparator
-{
-    bool operator()(HuffmanNode const *left, HuffmanNode const *right);
-};
+// Number of bit streams each chunk is split into when encoded as interleaved streams.
+inline constexpr std::uint8_t s_interleaved_stream_count = 4;
 
 /**
  * Struct to store data for a Huffman code.
@@ -138,4 +71,22 @@ struct HuffmanCode
     HuffmanCode &operator=(HuffmanCode const &) = delete;
 };
 
+/**
+ * Struct to store data for a single entry of a multi-symbol Huffman decoding table. The index of
+ * each entry is a sequence of encoded bits; the entry holds every symbol whose Huffman code is
+ * fully contained within that sequence, up to a static maximum number of symbols.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+struct HuffmanDecodeEntry
+{
+    static constexpr std::uint8_t s_max_symbols = 4;
+
+    std::array<symbol_type, s_max_symbols> m_symbols {};
+    std::uint8_t m_count {0};
+    length_type m_first_length {0};
+    length_type m_length {0};
+};
+
 } // namespace fly::coders
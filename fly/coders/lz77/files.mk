@@ -0,0 +1,3 @@
+SRC_$(d) := \
+    $(d)/lz77_decoder.cpp \
+    $(d)/lz77_encoder.cpp
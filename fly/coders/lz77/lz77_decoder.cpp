@@ -0,0 +1,436 @@
+#include "fly/coders/lz77/lz77_decoder.hpp"
+
+#include "fly/coders/detail/stream_buffers.hpp"
+#include "fly/coders/lz77/types.hpp"
+#include "fly/logger/logger.hpp"
+#include "fly/types/bit_stream/bit_stream_reader.hpp"
+#include "fly/types/bit_stream/detail/constants.hpp"
+#include "fly/types/numeric/endian.hpp"
+
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+
+namespace fly::coders {
+
+namespace {
+
+    constexpr auto s_word_bits = static_cast<byte_type>(std::numeric_limits<std::uint32_t>::digits);
+
+    // Matches whose offset is at least this large are copied 8 bytes at a time.
+    constexpr std::size_t s_copy_size = sizeof(std::uint64_t);
+
+    // Size of the BitStream header and the LZ77 coder header (in bytes).
+    constexpr std::size_t s_header_size = detail::s_byte_type_size * 2 + sizeof(word_type);
+
+    // Number of bytes a decoder session holds beyond what is needed to decode the next part of the
+    // stream. A BitStream reader reads at most one buffer's worth of bytes beyond the bits it has
+    // consumed, so this ensures the reader never reaches the end of the buffered bytes.
+    constexpr std::size_t s_session_lookahead = sizeof(std::uint64_t) * 2;
+
+    /**
+     * Read a sequence of bytes from a bit stream, reading as many bytes as possible as large words.
+     */
+    bool read_bytes(fly::BitStreamReader &encoded, byte_type *data, std::size_t size)
+    {
+        std::size_t position = 0;
+
+        for (; (position + sizeof(std::uint32_t)) <= size; position += sizeof(std::uint32_t))
+        {
+            std::uint32_t word;
+
+            if (encoded.read_bits(word, s_word_bits) != s_word_bits)
+            {
+                return false;
+            }
+
+            word = endian_swap_if_non_native<std::endian::big>(word);
+            std::memcpy(data + position, &word, sizeof(word));
+        }
+
+        for (; position < size; ++position)
+        {
+            if (!encoded.read_byte(data[position]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Read the bytes extending a count which did not fit in a token from a sequences stream.
+     */
+    bool
+    read_length(std::vector<byte_type> const &sequences, std::size_t &position, std::size_t &length)
+    {
+        byte_type extension;
+
+        do
+        {
+            if (position == sequences.size())
+            {
+                return false;
+            }
+
+            extension = sequences[position++];
+            length += extension;
+        } while (extension == s_lz77_length_extension);
+
+        return true;
+    }
+
+    /**
+     * Copy a match from earlier in the decoded block. Matches which overlap the bytes being copied
+     * are copied one byte at a time, so that each byte is copied after it has been written.
+     */
+    void copy_match(byte_type *target, std::size_t offset, std::size_t length)
+    {
+        byte_type const *source = target - offset;
+
+        if (offset >= s_copy_size)
+        {
+            // Each 8-byte copy reads bytes which were written before the copy, and may write up to
+            // 7 bytes beyond the end of the match, which the decoded block has room for.
+            for (std::size_t i = 0; i < length; i += s_copy_size)
+            {
+                std::memcpy(target + i, source + i, s_copy_size);
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                target[i] = source[i];
+            }
+        }
+    }
+
+} // namespace
+
+/**
+ * Session to incrementally LZ77 decode a sequence of bytes. The header is decoded once enough of
+ * the stream has been buffered, and blocks are then decoded as soon as the largest possible
+ * encoding of a block has been buffered. The remainder of the stream is decoded when the session is
+ * finished.
+ */
+class Lz77Decoder::Session final : public DecoderSession
+{
+public:
+    explicit Session(std::ostream &decoded) : m_stream(decoded), m_input(&m_buffer)
+    {
+    }
+
+    bool update(std::span<std::byte const> encoded) override
+    {
+        if (m_finished)
+        {
+            return false;
+        }
+
+        m_buffer.append(encoded);
+        return decode_available(false);
+    }
+
+    bool finish() override
+    {
+        if (std::exchange(m_finished, true))
+        {
+            return false;
+        }
+
+        return decode_available(true);
+    }
+
+private:
+    bool decode_available(bool finishing)
+    {
+        if (!m_reader)
+        {
+            if (!finishing && (m_buffer.available() < (s_header_size + s_session_lookahead)))
+            {
+                return true;
+            }
+
+            m_reader.emplace(m_input);
+
+            if (!m_decoder.decode_header(*m_reader, m_block_size))
+            {
+                LOGW("Error decoding header from stream");
+                return fail();
+            }
+
+            m_required_size = lz77_max_encoded_block_size(m_block_size) + s_session_lookahead;
+        }
+
+        while (finishing ? !m_reader->fully_consumed() : (m_buffer.available() >= m_required_size))
+        {
+            if (!m_decoder.decode_block(*m_reader, m_block_size, m_stream))
+            {
+                return fail();
+            }
+        }
+
+        return m_stream.good();
+    }
+
+    bool fail()
+    {
+        m_finished = true;
+        return false;
+    }
+
+    Lz77Decoder m_decoder;
+    std::ostream &m_stream;
+
+    fly::detail::QueueStreamBuffer m_buffer;
+    std::istream m_input;
+    std::optional<fly::BitStreamReader> m_reader;
+
+    std::uint32_t m_block_size {0};
+    std::size_t m_required_size {0};
+
+    bool m_finished {false};
+};
+
+//==================================================================================================
+std::size_t Lz77Decoder::max_decoded_size(std::size_t encoded_size) const
+{
+    return encoded_size * detail::s_bits_per_byte * s_lz77_length_extension;
+}
+
+//==================================================================================================
+std::unique_ptr<DecoderSession> Lz77Decoder::create_decoder_session(std::ostream &decoded)
+{
+    return std::make_unique<Session>(decoded);
+}
+
+//==================================================================================================
+bool Lz77Decoder::decode_binary(fly::BitStreamReader &encoded, std::ostream &decoded)
+{
+    std::uint32_t block_size;
+
+    if (!decode_header(encoded, block_size))
+    {
+        LOGW("Error decoding header from stream");
+        return false;
+    }
+
+    while (!encoded.fully_consumed())
+    {
+        if (!decode_block(encoded, block_size, decoded))
+        {
+            return false;
+        }
+    }
+
+    return decoded.good();
+}
+
+//==================================================================================================
+bool Lz77Decoder::decode_header(fly::BitStreamReader &encoded, std::uint32_t &block_size)
+{
+    byte_type version;
+    word_type block_size_kb;
+
+    if (!encoded.read_byte(version))
+    {
+        LOGW("Could not decode LZ77 coder version");
+        return false;
+    }
+    else if (version != s_lz77_version)
+    {
+        LOGW("Decoded invalid LZ77 version {}", version);
+        return false;
+    }
+    else if (!encoded.read_word(block_size_kb))
+    {
+        LOGW("Could not decode block size");
+        return false;
+    }
+    else if (block_size_kb == 0)
+    {
+        LOGW("Decoded invalid block size {}", block_size_kb);
+        return false;
+    }
+
+    block_size = static_cast<std::uint32_t>(block_size_kb) << 10;
+    m_block.resize(block_size + s_copy_size);
+
+    return true;
+}
+
+//==================================================================================================
+bool Lz77Decoder::decode_block(
+    fly::BitStreamReader &encoded,
+    std::uint32_t block_size,
+    std::ostream &decoded)
+{
+    std::uint32_t size;
+
+    if (encoded.read_bits(size, s_word_bits) != s_word_bits)
+    {
+        LOGW("Could not decode block size");
+        return false;
+    }
+    else if ((size == 0) || (size > block_size))
+    {
+        LOGW("Decoded invalid block size {}", size);
+        return false;
+    }
+    else if (!decode_stream(encoded, size, m_literals))
+    {
+        LOGW("Could not decode literals of {} byte block", size);
+        return false;
+    }
+    else if (!decode_stream(encoded, lz77_max_streams_size(size), m_sequences))
+    {
+        LOGW("Could not decode sequences of {} byte block", size);
+        return false;
+    }
+    else if (!decode_sequences(size))
+    {
+        LOGW("Decoded invalid sequences of {} byte block", size);
+        return false;
+    }
+
+    decoded.write(
+        reinterpret_cast<std::ios::char_type const *>(m_block.data()),
+        static_cast<std::streamsize>(size));
+
+    return true;
+}
+
+//==================================================================================================
+bool Lz77Decoder::decode_stream(
+    fly::BitStreamReader &encoded,
+    std::size_t max_size,
+    std::vector<byte_type> &stream)
+{
+    byte_type mode;
+    std::uint32_t size;
+
+    if (!encoded.read_byte(mode) || (encoded.read_bits(size, s_word_bits) != s_word_bits))
+    {
+        return false;
+    }
+    else if (size > max_size)
+    {
+        LOGW("Decoded invalid stream size {}", size);
+        return false;
+    }
+
+    stream.resize(size);
+
+    switch (static_cast<Lz77StreamMode>(mode))
+    {
+        case Lz77StreamMode::Raw:
+            return read_bytes(encoded, stream.data(), stream.size());
+
+        case Lz77StreamMode::Huffman:
+        {
+            std::uint32_t encoded_size;
+
+            if (encoded.read_bits(encoded_size, s_word_bits) != s_word_bits)
+            {
+                return false;
+            }
+            else if (encoded_size >= size)
+            {
+                // Streams are only Huffman encoded if doing so makes them smaller.
+                LOGW("Decoded invalid Huffman encoded stream size {}", encoded_size);
+                return false;
+            }
+
+            m_huffman_buffer.resize(encoded_size);
+
+            if (!read_bytes(encoded, m_huffman_buffer.data(), m_huffman_buffer.size()))
+            {
+                return false;
+            }
+
+            auto const decoded_size = m_huffman_decoder.decode_buffer(
+                std::as_bytes(std::span(m_huffman_buffer)),
+                std::as_writable_bytes(std::span(stream)));
+
+            return decoded_size && (*decoded_size == size);
+        }
+
+        default:
+            LOGW("Decoded invalid stream mode {}", mode);
+            break;
+    }
+
+    return false;
+}
+
+//==================================================================================================
+bool Lz77Decoder::decode_sequences(std::uint32_t size)
+{
+    byte_type *block = m_block.data();
+    std::size_t position = 0;
+
+    std::size_t literal = 0;
+    std::size_t sequence = 0;
+
+    while (sequence < m_sequences.size())
+    {
+        byte_type const token = m_sequences[sequence++];
+
+        std::size_t literal_count = token >> s_lz77_token_shift;
+
+        if ((literal_count == s_lz77_token_mask) &&
+            !read_length(m_sequences, sequence, literal_count))
+        {
+            return false;
+        }
+        else if (
+            (literal_count > (m_literals.size() - literal)) || (literal_count > (size - position)))
+        {
+            return false;
+        }
+
+        std::memcpy(block + position, m_literals.data() + literal, literal_count);
+        position += literal_count;
+        literal += literal_count;
+
+        // The final sequence only holds literal bytes.
+        if (sequence == m_sequences.size())
+        {
+            break;
+        }
+        else if ((m_sequences.size() - sequence) < sizeof(std::uint16_t))
+        {
+            return false;
+        }
+
+        std::size_t const offset = static_cast<std::size_t>(m_sequences[sequence]) |
+            (static_cast<std::size_t>(m_sequences[sequence + 1]) << detail::s_bits_per_byte);
+        sequence += sizeof(std::uint16_t);
+
+        std::size_t length = token & s_lz77_token_mask;
+
+        if ((length == s_lz77_token_mask) && !read_length(m_sequences, sequence, length))
+        {
+            return false;
+        }
+
+        length += s_lz77_min_match_length;
+
+        if ((offset == 0) || (offset > position) || (length > (size - position)))
+        {
+            return false;
+        }
+
+        copy_match(block + position, offset, length);
+        position += length;
+    }
+
+    return (position == size) && (literal == m_literals.size());
+}
+
+} // namespace fly::coders
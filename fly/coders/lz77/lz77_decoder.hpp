@@ -0,0 +1,127 @@
+#pragma once
+
+#include "fly/coders/coder.hpp"
+#include "fly/coders/huffman/huffman_decoder.hpp"
+#include "fly/types/bit_stream/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace fly {
+class BitStreamReader;
+} // namespace fly
+
+namespace fly::coders {
+
+/**
+ * Implementation of the Decoder interface for LZ77 dictionary coding.
+ *
+ * Each block is decoded by reading its literals and sequences streams into memory, Huffman decoding
+ * them if they were Huffman encoded, and then executing each sequence: copying its literal bytes to
+ * the decoded block, followed by copying its match from earlier in the decoded block. Every offset
+ * and length is validated against the decoded block, so corrupt streams are rejected rather than
+ * reading or writing outside of the block.
+ *
+ * Decoder sessions buffer the encoded input until the largest possible encoding of a block is
+ * available, and then decode that block.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+class Lz77Decoder : public BinaryDecoder
+{
+public:
+    /**
+     * Compute an upper bound of the size of the decoding of a sequence of bytes. Each byte of a
+     * sequence may extend a match by up to 255 bytes, and if the sequences were Huffman encoded,
+     * each encoded byte may decode to up to 8 bytes of sequences.
+     *
+     * @param encoded_size The size of the sequence to decode.
+     *
+     * @return The maximum size of the decoded sequence.
+     */
+    std::size_t max_decoded_size(std::size_t encoded_size) const override;
+
+    /**
+     * Create a session to incrementally LZ77 decode a sequence of bytes.
+     *
+     * @param decoded Stream to store the decoded contents. Must outlive the session.
+     *
+     * @return The created session.
+     */
+    std::unique_ptr<DecoderSession> create_decoder_session(std::ostream &decoded) override;
+
+protected:
+    /**
+     * LZ77 decode a stream.
+     *
+     * @param encoded Stream holding the contents to decode.
+     * @param decoded Stream to store the decoded contents.
+     *
+     * @return True if the input stream was successfully decoded.
+     */
+    bool decode_binary(fly::BitStreamReader &encoded, std::ostream &decoded) override;
+
+private:
+    class Session;
+
+    /**
+     * Decode the version of the encoder used to encode the stream and the block size, and allocate
+     * the decoded block for that block size.
+     *
+     * @param encoded Stream storing the encoded header.
+     * @param block_size Location to store the maximum block size (in bytes).
+     *
+     * @return True if the header was successfully decoded.
+     */
+    bool decode_header(fly::BitStreamReader &encoded, std::uint32_t &block_size);
+
+    /**
+     * Decode a single block from an encoded input stream.
+     *
+     * @param encoded Stream holding the block to decode.
+     * @param block_size The maximum block size (in bytes).
+     * @param decoded Stream to store the decoded block.
+     *
+     * @return True if the block was successfully decoded.
+     */
+    bool
+    decode_block(fly::BitStreamReader &encoded, std::uint32_t block_size, std::ostream &decoded);
+
+    /**
+     * Decode the literals or sequences stream of a block, Huffman decoding the stream if needed.
+     *
+     * @param encoded Stream holding the stream to decode.
+     * @param max_size The maximum valid decoded size of the stream.
+     * @param stream Location to store the decoded stream.
+     *
+     * @return True if the stream was successfully decoded.
+     */
+    bool decode_stream(
+        fly::BitStreamReader &encoded,
+        std::size_t max_size,
+        std::vector<byte_type> &stream);
+
+    /**
+     * Execute the decoded sequences of a block to form the decoded block.
+     *
+     * @param size The decoded size of the block.
+     *
+     * @return True if the sequences were valid and formed a block of the expected size.
+     */
+    bool decode_sequences(std::uint32_t size);
+
+    HuffmanDecoder m_huffman_decoder;
+
+    std::vector<byte_type> m_literals;
+    std::vector<byte_type> m_sequences;
+    std::vector<byte_type> m_huffman_buffer;
+
+    // Sized to fit the maximum block size, plus room for matches to be copied 8 bytes at a time.
+    std::vector<byte_type> m_block;
+};
+
+} // namespace fly::coders
@@ -0,0 +1,487 @@
+#include "fly/coders/lz77/lz77_encoder.hpp"
+
+#include "fly/coders/coder_config.hpp"
+#include "fly/coders/lz77/types.hpp"
+#include "fly/logger/logger.hpp"
+#include "fly/types/bit_stream/bit_stream_writer.hpp"
+#include "fly/types/bit_stream/detail/constants.hpp"
+#include "fly/types/numeric/endian.hpp"
+#include "fly/types/numeric/literals.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <span>
+
+using namespace fly::literals::numeric_literals;
+
+namespace fly::coders {
+
+namespace {
+
+    constexpr auto s_word_bits = static_cast<byte_type>(std::numeric_limits<std::uint32_t>::digits);
+
+    // Number of bits of each hash, i.e. the hash heads table holds 2^16 positions.
+    constexpr std::uint32_t s_hash_bits = 16;
+
+    // The hash chain holds the positions within the maximum match offset.
+    constexpr std::uint32_t s_window_size = s_lz77_max_offset + 1;
+    constexpr std::uint32_t s_window_mask = s_window_size - 1;
+
+    // Marks hash heads which do not hold any position.
+    constexpr std::uint32_t s_no_position = std::numeric_limits<std::uint32_t>::max();
+
+    // After every 2^6 consecutive positions without a match, the distance between searched
+    // positions grows by 1. This quickly skips over data which does not compress well.
+    constexpr std::uint32_t s_skip_shift = 6;
+
+    std::uint32_t hash_position(byte_type const *data)
+    {
+        std::uint32_t word;
+        std::memcpy(&word, data, sizeof(word));
+
+        // Knuth's multiplicative hash, keeping the most-significant bits of the product.
+        word = endian_swap_if_non_native<std::endian::little>(word);
+        return (word * 2654435761U) >> (std::numeric_limits<std::uint32_t>::digits - s_hash_bits);
+    }
+
+    /**
+     * Count the number of equal bytes at the start of two byte sequences, comparing 8 bytes at a
+     * time.
+     */
+    std::uint32_t match_length(byte_type const *first, byte_type const *second, std::uint32_t limit)
+    {
+        std::uint32_t length = 0;
+
+        for (; (length + sizeof(std::uint64_t)) <= limit; length += sizeof(std::uint64_t))
+        {
+            std::uint64_t left;
+            std::uint64_t right;
+
+            std::memcpy(&left, first + length, sizeof(left));
+            std::memcpy(&right, second + length, sizeof(right));
+
+            if (std::uint64_t const difference = left ^ right; difference != 0)
+            {
+                if constexpr (std::endian::native == std::endian::little)
+                {
+                    return length + (std::countr_zero(difference) / detail::s_bits_per_byte);
+                }
+                else
+                {
+                    return length + (std::countl_zero(difference) / detail::s_bits_per_byte);
+                }
+            }
+        }
+
+        while ((length < limit) && (first[length] == second[length]))
+        {
+            ++length;
+        }
+
+        return length;
+    }
+
+    /**
+     * Append a count which does not fit in a token to a sequences stream, as a series of bytes
+     * which each add up to 255 to the count.
+     */
+    void write_length(std::vector<byte_type> &sequences, std::uint32_t length)
+    {
+        for (; length >= s_lz77_length_extension; length -= s_lz77_length_extension)
+        {
+            sequences.push_back(s_lz77_length_extension);
+        }
+
+        sequences.push_back(static_cast<byte_type>(length));
+    }
+
+    /**
+     * Write a sequence of bytes to a bit stream, writing as many bytes as possible as large words.
+     */
+    void write_bytes(byte_type const *data, std::size_t size, fly::BitStreamWriter &encoded)
+    {
+        std::size_t position = 0;
+
+        for (; (position + sizeof(std::uint32_t)) <= size; position += sizeof(std::uint32_t))
+        {
+            std::uint32_t word;
+            std::memcpy(&word, data + position, sizeof(word));
+
+            encoded.write_bits(endian_swap_if_non_native<std::endian::big>(word), s_word_bits);
+        }
+
+        for (; position < size; ++position)
+        {
+            encoded.write_byte(data[position]);
+        }
+    }
+
+} // namespace
+
+/**
+ * Session to incrementally LZ77 encode a sequence of bytes. Every field of the encoded format is a
+ * whole number of bytes, so the BitStream header never needs to be rewritten.
+ */
+class Lz77Encoder::Session final : public EncoderSession
+{
+public:
+    Session(std::shared_ptr<CoderConfig> const &config, std::ostream &encoded) :
+        m_encoder(config),
+        m_stream(encoded),
+        m_writer(encoded)
+    {
+        if (m_encoder.initialize())
+        {
+            m_encoder.encode_header(m_writer);
+        }
+        else
+        {
+            m_finished = true;
+        }
+    }
+
+    bool update(std::span<std::byte const> decoded) override
+    {
+        if (m_finished)
+        {
+            return false;
+        }
+
+        auto const *data = reinterpret_cast<byte_type const *>(decoded.data());
+        std::size_t size = decoded.size();
+
+        std::uint32_t const block_size = m_encoder.m_block_size;
+
+        while (size > 0)
+        {
+            if ((m_buffered == 0) && (size >= block_size))
+            {
+                m_encoder.encode_block(data, block_size, m_writer);
+
+                data += block_size;
+                size -= block_size;
+            }
+            else
+            {
+                auto const fill = static_cast<std::uint32_t>(
+                    std::min<std::size_t>(block_size - m_buffered, size));
+                std::memcpy(m_encoder.m_block_buffer.get() + m_buffered, data, fill);
+
+                m_buffered += fill;
+                data += fill;
+                size -= fill;
+
+                if (m_buffered == block_size)
+                {
+                    encode_buffered();
+                }
+            }
+        }
+
+        return m_stream.good();
+    }
+
+    bool finish() override
+    {
+        if (std::exchange(m_finished, true))
+        {
+            return false;
+        }
+
+        if (m_buffered > 0)
+        {
+            encode_buffered();
+        }
+
+        return m_writer.finish();
+    }
+
+private:
+    void encode_buffered()
+    {
+        m_encoder.encode_block(m_encoder.m_block_buffer.get(), m_buffered, m_writer);
+        m_buffered = 0;
+    }
+
+    Lz77Encoder m_encoder;
+
+    std::ostream &m_stream;
+    fly::BitStreamWriter m_writer;
+
+    std::uint32_t m_buffered {0};
+    bool m_finished {false};
+};
+
+//==================================================================================================
+Lz77Encoder::Lz77Encoder(std::shared_ptr<CoderConfig> const &config) noexcept :
+    m_config(config),
+    m_block_size(config->lz77_encoder_block_size()),
+    m_max_chain_length(config->lz77_encoder_max_chain_length()),
+    m_huffman_streams(config->lz77_encoder_huffman_streams()),
+    m_huffman_encoder(config)
+{
+}
+
+//==================================================================================================
+std::size_t Lz77Encoder::max_encoded_size(std::size_t decoded_size) const
+{
+    // The BitStream header, LZ77 coder version, and block size.
+    std::size_t const header_size = detail::s_byte_type_size * 2 + sizeof(word_type);
+
+    if (m_block_size == 0)
+    {
+        return header_size;
+    }
+
+    std::size_t const blocks = (decoded_size + m_block_size - 1) / m_block_size;
+    return header_size + lz77_max_streams_size(decoded_size) + blocks * s_lz77_block_overhead;
+}
+
+//==================================================================================================
+std::unique_ptr<EncoderSession> Lz77Encoder::create_encoder_session(std::ostream &encoded)
+{
+    return std::make_unique<Session>(m_config, encoded);
+}
+
+//==================================================================================================
+bool Lz77Encoder::encode_binary(std::istream &decoded, fly::BitStreamWriter &encoded)
+{
+    if (!initialize())
+    {
+        return false;
+    }
+
+    encode_header(encoded);
+
+    while (decoded)
+    {
+        decoded.read(
+            reinterpret_cast<std::ios::char_type *>(m_block_buffer.get()),
+            static_cast<std::streamsize>(m_block_size));
+
+        if (auto const size = static_cast<std::uint32_t>(decoded.gcount()); size > 0)
+        {
+            encode_block(m_block_buffer.get(), size, encoded);
+        }
+    }
+
+    return encoded.finish();
+}
+
+//==================================================================================================
+bool Lz77Encoder::initialize()
+{
+    if (m_block_size == 0)
+    {
+        LOGW("LZ77 block size {} is too small", m_block_size);
+        return false;
+    }
+
+    if (!m_block_buffer)
+    {
+        m_block_buffer = std::make_unique<byte_type[]>(m_block_size);
+        m_hash_heads.resize(1_zu << s_hash_bits);
+        m_hash_chain.resize(s_window_size);
+    }
+
+    return true;
+}
+
+//==================================================================================================
+void Lz77Encoder::encode_header(fly::BitStreamWriter &encoded) const
+{
+    encoded.write_byte(s_lz77_version);
+    encoded.write_word(static_cast<word_type>(m_block_size >> 10));
+}
+
+//==================================================================================================
+void Lz77Encoder::encode_block(
+    byte_type const *block,
+    std::uint32_t size,
+    fly::BitStreamWriter &encoded)
+{
+    find_sequences(block, size);
+
+    encoded.write_bits(size, s_word_bits);
+    encode_stream(m_literals, encoded);
+    encode_stream(m_sequences, encoded);
+}
+
+//==================================================================================================
+void Lz77Encoder::find_sequences(byte_type const *block, std::uint32_t size)
+{
+    m_literals.clear();
+    m_sequences.clear();
+
+    // Blocks are encoded independently, so matches may not reference previous blocks.
+    std::fill(m_hash_heads.begin(), m_hash_heads.end(), s_no_position);
+
+    std::uint32_t position = 0;
+    std::uint32_t anchor = 0;
+    std::uint32_t misses = 0;
+
+    while ((position + s_lz77_min_match_length) <= size)
+    {
+        auto const [length, offset] = find_match(block, position, size);
+
+        if (length < s_lz77_min_match_length)
+        {
+            position += 1 + (misses++ >> s_skip_shift);
+            continue;
+        }
+
+        encode_sequence(block + anchor, position - anchor, offset, length);
+
+        // Insert the positions within the match, so that later matches may reference them.
+        std::uint32_t const end = position + length;
+
+        for (++position; (position < end) && ((position + s_lz77_min_match_length) <= size);
+             ++position)
+        {
+            insert_position(block, position);
+        }
+
+        position = end;
+        anchor = end;
+        misses = 0;
+    }
+
+    encode_final_sequence(block + anchor, size - anchor);
+}
+
+//==================================================================================================
+std::pair<std::uint32_t, std::uint32_t>
+Lz77Encoder::find_match(byte_type const *block, std::uint32_t position, std::uint32_t size)
+{
+    std::uint32_t const hash = hash_position(block + position);
+    std::uint32_t candidate = m_hash_heads[hash];
+
+    m_hash_chain[position & s_window_mask] = candidate;
+    m_hash_heads[hash] = position;
+
+    std::uint32_t const limit = size - position;
+    std::uint32_t best_length = 0;
+    std::uint32_t best_offset = 0;
+
+    for (std::uint32_t chain = m_max_chain_length; (chain > 0) && (candidate != s_no_position);
+         --chain)
+    {
+        std::uint32_t const offset = position - candidate;
+
+        if (offset > s_lz77_max_offset)
+        {
+            break;
+        }
+
+        // Only fully compare candidates which may be longer than the longest match so far.
+        if (block[candidate + best_length] == block[position + best_length])
+        {
+            if (std::uint32_t const length =
+                    match_length(block + candidate, block + position, limit);
+                length > best_length)
+            {
+                best_length = length;
+                best_offset = offset;
+
+                if (length == limit)
+                {
+                    break;
+                }
+            }
+        }
+
+        candidate = m_hash_chain[candidate & s_window_mask];
+    }
+
+    return {best_length, best_offset};
+}
+
+//==================================================================================================
+void Lz77Encoder::insert_position(byte_type const *block, std::uint32_t position)
+{
+    std::uint32_t const hash = hash_position(block + position);
+
+    m_hash_chain[position & s_window_mask] = m_hash_heads[hash];
+    m_hash_heads[hash] = position;
+}
+
+//==================================================================================================
+void Lz77Encoder::encode_sequence(
+    byte_type const *literals,
+    std::uint32_t literal_count,
+    std::uint32_t offset,
+    std::uint32_t length)
+{
+    std::uint32_t const match_count = length - s_lz77_min_match_length;
+
+    auto const token = static_cast<byte_type>(
+        (std::min<std::uint32_t>(literal_count, s_lz77_token_mask) << s_lz77_token_shift) |
+        std::min<std::uint32_t>(match_count, s_lz77_token_mask));
+
+    m_sequences.push_back(token);
+
+    if (literal_count >= s_lz77_token_mask)
+    {
+        write_length(m_sequences, literal_count - s_lz77_token_mask);
+    }
+
+    m_literals.insert(m_literals.end(), literals, literals + literal_count);
+
+    m_sequences.push_back(static_cast<byte_type>(offset));
+    m_sequences.push_back(static_cast<byte_type>(offset >> detail::s_bits_per_byte));
+
+    if (match_count >= s_lz77_token_mask)
+    {
+        write_length(m_sequences, match_count - s_lz77_token_mask);
+    }
+}
+
+//==================================================================================================
+void Lz77Encoder::encode_final_sequence(byte_type const *literals, std::uint32_t literal_count)
+{
+    auto const token = static_cast<byte_type>(
+        std::min<std::uint32_t>(literal_count, s_lz77_token_mask) << s_lz77_token_shift);
+
+    m_sequences.push_back(token);
+
+    if (literal_count >= s_lz77_token_mask)
+    {
+        write_length(m_sequences, literal_count - s_lz77_token_mask);
+    }
+
+    m_literals.insert(m_literals.end(), literals, literals + literal_count);
+}
+
+//==================================================================================================
+void Lz77Encoder::encode_stream(std::vector<byte_type> const &stream, fly::BitStreamWriter &encoded)
+{
+    Lz77StreamMode mode = Lz77StreamMode::Raw;
+
+    if (m_huffman_streams && !stream.empty() &&
+        m_huffman_encoder.encode_buffer(std::as_bytes(std::span(stream)), m_huffman_buffer) &&
+        (m_huffman_buffer.size() < stream.size()))
+    {
+        mode = Lz77StreamMode::Huffman;
+    }
+
+    encoded.write_byte(static_cast<byte_type>(mode));
+    encoded.write_bits(static_cast<std::uint32_t>(stream.size()), s_word_bits);
+
+    if (mode == Lz77StreamMode::Huffman)
+    {
+        encoded.write_bits(static_cast<std::uint32_t>(m_huffman_buffer.size()), s_word_bits);
+
+        write_bytes(
+            reinterpret_cast<byte_type const *>(m_huffman_buffer.data()),
+            m_huffman_buffer.size(),
+            encoded);
+    }
+    else
+    {
+        write_bytes(stream.data(), stream.size(), encoded);
+    }
+}
+
+} // namespace fly::coders
@@ -0,0 +1,194 @@
+#pragma once
+
+#include "fly/coders/coder.hpp"
+#include "fly/coders/huffman/huffman_encoder.hpp"
+#include "fly/types/bit_stream/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+namespace fly {
+class BitStreamWriter;
+} // namespace fly
+
+namespace fly::coders {
+
+class CoderConfig;
+
+/**
+ * Implementation of the Encoder interface for LZ77 dictionary coding, in the style of LZ4.
+ *
+ * The input stream is split into blocks, each of which is encoded independently. Repeated byte
+ * sequences within a block are found with a hash-chain match finder: every 4-byte sequence is
+ * hashed, positions with the same hash are chained together, and the most recent positions in the
+ * chain within the previous 64 KB are searched for the longest match. The block is then encoded as
+ * a list of sequences, each of which is a run of literal bytes followed by a match, and the final of
+ * which is only a run of literal bytes.
+ *
+ * Each sequence is encoded as a token, whose upper 4 bits hold the number of literals and whose
+ * lower 4 bits hold the match length less 4, followed by any bytes extending the literal count, the
+ * 16-bit offset of the match, and any bytes extending the match length. The literal bytes of every
+ * sequence are stored together in their own stream, separate from the sequences.
+ *
+ * If configured, the literals and sequences streams of each block are each Huffman encoded, which
+ * trades encoding speed for a better compression ratio. Either stream is stored as is if Huffman
+ * encoding does not make it smaller.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+class Lz77Encoder : public BinaryEncoder
+{
+public:
+    /**
+     * Constructor.
+     *
+     * @param config Reference to coder configuration.
+     */
+    explicit Lz77Encoder(std::shared_ptr<CoderConfig> const &config) noexcept;
+
+    /**
+     * Compute an upper bound of the size of the encoding of a sequence of bytes. The bound assumes
+     * no matches are found, so each block is stored as literals.
+     *
+     * @param decoded_size The size of the sequence to encode.
+     *
+     * @return The maximum size of the encoded sequence.
+     */
+    std::size_t max_encoded_size(std::size_t decoded_size) const override;
+
+    /**
+     * Create a session to incrementally LZ77 encode a sequence of bytes. Input is buffered until a
+     * full block is available.
+     *
+     * @param encoded Stream to store the encoded contents. Must outlive the session.
+     *
+     * @return The created session.
+     */
+    std::unique_ptr<EncoderSession> create_encoder_session(std::ostream &encoded) override;
+
+protected:
+    /**
+     * LZ77 encode a stream.
+     *
+     * @param decoded Stream holding the contents to encode.
+     * @param encoded Stream to store the encoded contents.
+     *
+     * @return True if the input stream was successfully encoded.
+     */
+    bool encode_binary(std::istream &decoded, fly::BitStreamWriter &encoded) override;
+
+private:
+    class Session;
+
+    /**
+     * Validate the configuration and allocate the match finder's tables.
+     *
+     * @return True if the configuration is valid.
+     */
+    bool initialize();
+
+    /**
+     * Encode the header to the output stream.
+     *
+     * @param encoded Stream to store the encoded header.
+     */
+    void encode_header(fly::BitStreamWriter &encoded) const;
+
+    /**
+     * Encode a block to the output stream.
+     *
+     * @param block The block to encode.
+     * @param size The number of bytes the block holds.
+     * @param encoded Stream to store the encoded block.
+     */
+    void encode_block(byte_type const *block, std::uint32_t size, fly::BitStreamWriter &encoded);
+
+    /**
+     * Find matches within a block, and split the block into its literals and sequences streams.
+     *
+     * @param block The block to encode.
+     * @param size The number of bytes the block holds.
+     */
+    void find_sequences(byte_type const *block, std::uint32_t size);
+
+    /**
+     * Find the longest match for the bytes at a position within the previous 64 KB of the block,
+     * and insert the position into the hash chains.
+     *
+     * @param block The block being encoded.
+     * @param position The position to find a match for.
+     * @param size The number of bytes the block holds.
+     *
+     * @return The length and offset of the longest match. The length is 0 if no match was found.
+     */
+    std::pair<std::uint32_t, std::uint32_t>
+    find_match(byte_type const *block, std::uint32_t position, std::uint32_t size);
+
+    /**
+     * Insert a position into the hash chains without searching for a match.
+     *
+     * @param block The block being encoded.
+     * @param position The position to insert.
+     */
+    void insert_position(byte_type const *block, std::uint32_t position);
+
+    /**
+     * Append a sequence to the literals and sequences streams.
+     *
+     * @param literals The literal bytes which precede the match.
+     * @param literal_count The number of literal bytes.
+     * @param offset The offset of the match.
+     * @param length The length of the match.
+     */
+    void encode_sequence(
+        byte_type const *literals,
+        std::uint32_t literal_count,
+        std::uint32_t offset,
+        std::uint32_t length);
+
+    /**
+     * Append the final sequence, which only holds literal bytes, to the literals and sequences
+     * streams.
+     *
+     * @param literals The literal bytes at the end of the block.
+     * @param literal_count The number of literal bytes.
+     */
+    void encode_final_sequence(byte_type const *literals, std::uint32_t literal_count);
+
+    /**
+     * Encode the literals or sequences stream of a block to the output stream, Huffman encoding
+     * the stream if configured and if doing so makes the stream smaller.
+     *
+     * @param stream The stream to encode.
+     * @param encoded Stream to store the encoded stream.
+     */
+    void encode_stream(std::vector<byte_type> const &stream, fly::BitStreamWriter &encoded);
+
+    std::shared_ptr<CoderConfig> m_config;
+
+    // Configuration.
+    std::uint32_t const m_block_size;
+    std::uint32_t const m_max_chain_length;
+    bool const m_huffman_streams;
+
+    HuffmanEncoder m_huffman_encoder;
+
+    std::unique_ptr<byte_type[]> m_block_buffer;
+
+    // The most recent position of each hash, and the previous position with the same hash as each
+    // position within the last 64 KB.
+    std::vector<std::uint32_t> m_hash_heads;
+    std::vector<std::uint32_t> m_hash_chain;
+
+    std::vector<byte_type> m_literals;
+    std::vector<byte_type> m_sequences;
+    std::vector<std::byte> m_huffman_buffer;
+};
+
+} // namespace fly::coders
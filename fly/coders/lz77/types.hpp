@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace fly::coders {
+
+// Version of the LZ77 encoded format.
+inline constexpr std::uint8_t s_lz77_version = 1;
+
+// Minimum length of a match. Shorter matches are not worth the size of a sequence.
+inline constexpr std::uint32_t s_lz77_min_match_length = 4;
+
+// Matches are referenced by 16-bit offsets from the current position.
+inline constexpr std::uint32_t s_lz77_max_offset = (1 << 16) - 1;
+
+// Each sequence token holds the literal count in its upper 4 bits and the match length (less the
+// minimum match length) in its lower 4 bits. Counts which do not fit are extended with bytes that
+// follow the token, each of which adds up to 255 to the count.
+inline constexpr std::uint8_t s_lz77_token_shift = 4;
+inline constexpr std::uint8_t s_lz77_token_mask = 0x0f;
+inline constexpr std::uint8_t s_lz77_length_extension = 0xff;
+
+// Size of the fields of an encoded block: the decoded block size, and for each of the literals and
+// sequences streams, the stream's mode, decoded size, and (if Huffman encoded) encoded size.
+inline constexpr std::size_t s_lz77_block_overhead = 4 + (1 + 4 + 4) * 2;
+
+/**
+ * Enumeration of the ways the literals and sequences streams of a block may be stored.
+ */
+enum class Lz77StreamMode : std::uint8_t
+{
+    Raw = 0,
+    Huffman = 1,
+};
+
+/**
+ * Compute an upper bound of the combined size of the literals and sequences of an LZ77 block. Each
+ * match covers more bytes than its sequence occupies, so only the literal count extensions and the
+ * final sequence may exceed the size of the block.
+ *
+ * @param block_size The decoded size of the block.
+ *
+ * @return The maximum combined size of the block's literals and sequences.
+ */
+constexpr std::size_t lz77_max_streams_size(std::size_t block_size)
+{
+    return block_size + (block_size / s_lz77_length_extension) + 2;
+}
+
+/**
+ * Compute an upper bound of the encoded size of an LZ77 block.
+ *
+ * @param block_size The decoded size of the block.
+ *
+ * @return The maximum encoded size of the block.
+ */
+constexpr std::size_t lz77_max_encoded_block_size(std::size_t block_size)
+{
+    return lz77_max_streams_size(block_size) + s_lz77_block_overhead;
+}
+
+} // namespace fly::coders
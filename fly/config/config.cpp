@@ -1,14 +1,28 @@
 #include "fly/config/config.hpp"
 
 #include <mutex>
+#include <utility>
 
 namespace fly::config {
 
 //==================================================================================================
 void Config::update(Json const &values)
+{
+    update(JsonSnapshot(values));
+}
+
+//==================================================================================================
+void Config::update(JsonSnapshot values)
 {
     std::unique_lock<std::shared_timed_mutex> lock(m_values_mutex);
-    m_values = values;
+    m_values = std::move(values);
+}
+
+//==================================================================================================
+JsonSnapshot Config::values() const
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_values_mutex);
+    return m_values;
 }
 
 } // namespace fly::config
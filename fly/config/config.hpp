@@ -1,9 +1,11 @@
 #pragma once
 
 #include "fly/types/json/json.hpp"
+#include "fly/types/json/json_snapshot.hpp"
 
 #include <shared_mutex>
 #include <string>
+#include <utility>
 
 namespace fly::config {
 
@@ -44,25 +46,37 @@ class Config
     /**
      * Update this configuration with a new set of parsed values.
      */
-    void update(Json const &);
+    void update(Json const &values);
+
+    /**
+     * Update this configuration with a new set of parsed values. The values are shared rather than
+     * copied, so updating is O(1) regardless of the size of the values.
+     */
+    void update(JsonSnapshot values);
+
+    /**
+     * @return The current set of parsed values. The returned snapshot may be read without locking,
+     *         and is unaffected by subsequent updates.
+     */
+    JsonSnapshot values() const;
 
 private:
     mutable std::shared_timed_mutex m_values_mutex;
-    Json m_values;
+    JsonSnapshot m_values;
 };
 
 //==================================================================================================
 template <typename T>
 T Config::get_value(std::string const &name, T def) const
 {
-    std::shared_lock<std::shared_timed_mutex> lock(m_values_mutex);
+    JsonSnapshot const values = this->values();
 
-    try
-    {
-        return T(m_values[name]);
-    }
-    catch (JsonException const &)
+    if (Json const *value = values->try_at(name); value != nullptr)
     {
+        if (auto converted = value->try_as<T>(); converted)
+        {
+            return *std::move(converted);
+        }
     }
 
     return def;
@@ -124,15 +124,15 @@ void ConfigManager::update_config()
 
     if (auto values = m_parser->parse_file(m_path); values)
     {
-        m_values = *std::move(values);
+        m_values = fly::JsonSnapshot(*std::move(values));
     }
     else
     {
         LOGW("Could not parse file, ignoring update");
-        m_values = nullptr;
+        m_values = fly::JsonSnapshot();
     }
 
-    if (m_values.is_object() || m_values.is_null())
+    if (m_values->is_object() || m_values->is_null())
     {
         for (auto it = m_configs.begin(); it != m_configs.end();)
         {
@@ -140,7 +140,7 @@ void ConfigManager::update_config()
 
             if (config)
             {
-                config->update(m_values[it->first]);
+                config->update(m_values.child(it->first));
                 ++it;
             }
             else
@@ -152,7 +152,7 @@ void ConfigManager::update_config()
     else
     {
         LOGW("Parsed non key-value pairs file, ignoring update");
-        m_values = nullptr;
+        m_values = fly::JsonSnapshot();
     }
 }
 
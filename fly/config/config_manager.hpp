@@ -4,6 +4,7 @@
 #include "fly/config/config.hpp"
 #include "fly/logger/logger.hpp"
 #include "fly/types/json/json.hpp"
+#include "fly/types/json/json_snapshot.hpp"
 #include "fly/types/string/formatters.hpp"
 
 #include <cstdint>
@@ -116,7 +117,7 @@ class ConfigManager : public std::enable_shared_from_this<ConfigManager>
 
     std::shared_ptr<fly::path::PathMonitor> m_monitor;
     std::unique_ptr<fly::parser::Parser> m_parser;
-    fly::Json m_values;
+    fly::JsonSnapshot m_values;
 
     std::filesystem::path const m_path;
 
@@ -155,7 +156,8 @@ std::shared_ptr<T> ConfigManager::create_config()
 
     if (config)
     {
-        config->update(m_values[T::identifier]);
+        // Derived configurations may hide the snapshot overload, so call it on the base class.
+        config->Config::update(m_values.child(T::identifier));
     }
     else
     {
@@ -0,0 +1,2 @@
+SRC_$(d) := \
+    $(d)/utf8_transcoder.cpp
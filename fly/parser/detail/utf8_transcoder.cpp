@@ -0,0 +1,297 @@
+#include "fly/parser/detail/utf8_transcoder.hpp"
+
+#include "fly/types/string/detail/unicode.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <future>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#    define FLY_PARSER_TRANSCODE_SSE2
+#    include <emmintrin.h>
+#endif
+
+namespace fly::parser::detail {
+
+namespace {
+
+    // Minimum number of code units in each concurrently transcoded piece. Smaller strings are not
+    // worth the overhead of creating threads.
+    constexpr std::size_t s_min_piece_size = 1 << 20;
+
+    constexpr std::uint32_t s_max_ascii = 0x7f;
+
+    constexpr std::uint32_t s_low_surrogate_min = 0xdc00;
+    constexpr std::uint32_t s_low_surrogate_max = 0xdfff;
+
+    /**
+     * Count the number of leading ASCII code units in a string.
+     */
+    template <typename CharType>
+    std::size_t ascii_prefix_length(CharType const *data, std::size_t size)
+    {
+        std::size_t length = 0;
+
+#if defined(FLY_PARSER_TRANSCODE_SSE2)
+        static constexpr std::size_t s_units_per_block = sizeof(__m128i) / sizeof(CharType);
+
+        __m128i const zero = _mm_setzero_si128();
+        __m128i mask;
+
+        if constexpr (sizeof(CharType) == 2)
+        {
+            mask = _mm_set1_epi16(static_cast<short>(~s_max_ascii));
+        }
+        else
+        {
+            mask = _mm_set1_epi32(static_cast<int>(~s_max_ascii));
+        }
+
+        for (; length + s_units_per_block <= size; length += s_units_per_block)
+        {
+            __m128i const block =
+                _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + length));
+            __m128i const high_bits = _mm_and_si128(block, mask);
+
+            // Every byte of the comparison is set if every code unit in the block is ASCII, so the
+            // comparison need not be specific to the size of the code units.
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(high_bits, zero)) != 0xffff)
+            {
+                break;
+            }
+        }
+#endif
+
+        for (; length < size; ++length)
+        {
+            if (static_cast<std::uint32_t>(data[length]) > s_max_ascii)
+            {
+                break;
+            }
+        }
+
+        return length;
+    }
+
+    /**
+     * Narrow a string of ASCII code units to a UTF-8 encoded string.
+     */
+    template <typename CharType>
+    void narrow_ascii(CharType const *data, std::size_t size, char *output)
+    {
+        std::size_t i = 0;
+
+#if defined(FLY_PARSER_TRANSCODE_SSE2)
+        if constexpr (sizeof(CharType) == 2)
+        {
+            for (; i + 16 <= size; i += 16)
+            {
+                __m128i const low = _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + i));
+                __m128i const high =
+                    _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + i + 8));
+
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i *>(output + i),
+                    _mm_packus_epi16(low, high));
+            }
+        }
+        else
+        {
+            for (; i + 16 <= size; i += 16)
+            {
+                auto const *input = reinterpret_cast<__m128i const *>(data + i);
+
+                __m128i const low =
+                    _mm_packs_epi32(_mm_loadu_si128(input), _mm_loadu_si128(input + 1));
+                __m128i const high =
+                    _mm_packs_epi32(_mm_loadu_si128(input + 2), _mm_loadu_si128(input + 3));
+
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i *>(output + i),
+                    _mm_packus_epi16(low, high));
+            }
+        }
+#endif
+
+        for (; i < size; ++i)
+        {
+            output[i] = static_cast<char>(data[i]);
+        }
+    }
+
+    /**
+     * Transcode a single piece of a UTF-16 or UTF-32 encoded string.
+     */
+    template <typename CharType>
+    std::optional<std::string> transcode_piece(std::basic_string_view<CharType> contents)
+    {
+        using unicode_type = fly::detail::BasicUnicode<CharType>;
+
+        std::string result;
+        result.reserve(contents.size());
+
+        CharType const *data = contents.data();
+        std::size_t const size = contents.size();
+
+        for (std::size_t position = 0; position < size;)
+        {
+            if (std::size_t const ascii = ascii_prefix_length(data + position, size - position);
+                ascii > 0)
+            {
+                std::size_t const offset = result.size();
+                result.resize(offset + ascii);
+
+                narrow_ascii(data + position, ascii, result.data() + offset);
+                position += ascii;
+            }
+
+            // Non-ASCII runs end at the next ASCII code unit, which never splits a surrogate pair.
+            std::size_t end = position;
+
+            while ((end < size) && (static_cast<std::uint32_t>(data[end]) > s_max_ascii))
+            {
+                ++end;
+            }
+
+            if (end != position)
+            {
+                auto const run = contents.substr(position, end - position);
+
+                if (!unicode_type::template convert_encoding_into<std::string>(
+                        run,
+                        std::back_inserter(result)))
+                {
+                    return std::nullopt;
+                }
+
+                position = end;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * Find the position nearest to, but not before, a position at which a string may be split
+     * without splitting a surrogate pair.
+     */
+    template <typename CharType>
+    std::size_t split_point(std::basic_string_view<CharType> contents, std::size_t position)
+    {
+        if constexpr (sizeof(CharType) == 2)
+        {
+            if (position < contents.size())
+            {
+                auto const unit = static_cast<std::uint32_t>(contents[position]);
+
+                if ((unit >= s_low_surrogate_min) && (unit <= s_low_surrogate_max))
+                {
+                    ++position;
+                }
+            }
+        }
+
+        return std::min(position, contents.size());
+    }
+
+    template <typename CharType>
+    std::optional<std::string>
+    transcode(std::basic_string_view<CharType> contents, std::size_t pieces)
+    {
+        pieces = std::clamp<std::size_t>(pieces, 1, std::max<std::size_t>(contents.size(), 1));
+
+        if (pieces == 1)
+        {
+            return transcode_piece(contents);
+        }
+
+        std::size_t const piece_size = contents.size() / pieces;
+        std::vector<std::future<std::optional<std::string>>> futures;
+        futures.reserve(pieces - 1);
+
+        std::size_t const first_end = split_point(contents, piece_size);
+        std::size_t start = first_end;
+
+        for (std::size_t i = 1; i < pieces; ++i)
+        {
+            std::size_t const end =
+                (i == pieces - 1) ? contents.size() : split_point(contents, piece_size * (i + 1));
+            auto const piece = contents.substr(start, std::max(start, end) - start);
+
+            futures.push_back(std::async(std::launch::async, [piece]() {
+                return transcode_piece(piece);
+            }));
+
+            start = std::max(start, end);
+        }
+
+        auto result = transcode_piece(contents.substr(0, first_end));
+
+        std::vector<std::optional<std::string>> results;
+        results.reserve(futures.size());
+
+        for (auto &future : futures)
+        {
+            results.push_back(future.get());
+        }
+
+        if (!result || !std::all_of(results.begin(), results.end(), [](auto const &piece) {
+                return piece.has_value();
+            }))
+        {
+            return std::nullopt;
+        }
+
+        std::size_t size = result->size();
+
+        for (auto const &piece : results)
+        {
+            size += piece->size();
+        }
+
+        result->reserve(size);
+
+        for (auto const &piece : results)
+        {
+            result->append(*piece);
+        }
+
+        return result;
+    }
+
+    std::size_t default_pieces(std::size_t size)
+    {
+        std::size_t const threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+        return std::clamp<std::size_t>(size / s_min_piece_size, 1, threads);
+    }
+
+} // namespace
+
+//==================================================================================================
+std::optional<std::string> transcode_to_utf8(std::u16string_view contents)
+{
+    return transcode(contents, default_pieces(contents.size()));
+}
+
+//==================================================================================================
+std::optional<std::string> transcode_to_utf8(std::u32string_view contents)
+{
+    return transcode(contents, default_pieces(contents.size()));
+}
+
+//==================================================================================================
+std::optional<std::string> transcode_to_utf8(std::u16string_view contents, std::size_t pieces)
+{
+    return transcode(contents, pieces);
+}
+
+//==================================================================================================
+std::optional<std::string> transcode_to_utf8(std::u32string_view contents, std::size_t pieces)
+{
+    return transcode(contents, pieces);
+}
+
+} // namespace fly::parser::detail
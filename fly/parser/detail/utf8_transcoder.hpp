@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace fly::parser::detail {
+
+/**
+ * Transcode a UTF-16 encoded string, in native endianness, to a UTF-8 encoded string.
+ *
+ * Runs of ASCII code units are narrowed directly, using SIMD instructions where available. All
+ * other code units are transcoded one codepoint at a time. Very large strings are split into pieces
+ * which are transcoded concurrently, and the pieces are then concatenated.
+ *
+ * @param contents The UTF-16 encoded string to transcode.
+ *
+ * @return If successful, the UTF-8 encoded string. Otherwise, an uninitialized value.
+ */
+std::optional<std::string> transcode_to_utf8(std::u16string_view contents);
+
+/**
+ * Transcode a UTF-32 encoded string, in native endianness, to a UTF-8 encoded string.
+ *
+ * @param contents The UTF-32 encoded string to transcode.
+ *
+ * @return If successful, the UTF-8 encoded string. Otherwise, an uninitialized value.
+ */
+std::optional<std::string> transcode_to_utf8(std::u32string_view contents);
+
+/**
+ * Transcode a UTF-16 encoded string, in native endianness, to a UTF-8 encoded string, splitting the
+ * string into a specific number of pieces to be transcoded concurrently. Pieces are only split at
+ * code-unit-safe boundaries, i.e. surrogate pairs are never split.
+ *
+ * @param contents The UTF-16 encoded string to transcode.
+ * @param pieces The number of pieces to split the string into.
+ *
+ * @return If successful, the UTF-8 encoded string. Otherwise, an uninitialized value.
+ */
+std::optional<std::string> transcode_to_utf8(std::u16string_view contents, std::size_t pieces);
+
+/**
+ * Transcode a UTF-32 encoded string, in native endianness, to a UTF-8 encoded string, splitting the
+ * string into a specific number of pieces to be transcoded concurrently.
+ *
+ * @param contents The UTF-32 encoded string to transcode.
+ * @param pieces The number of pieces to split the string into.
+ *
+ * @return If successful, the UTF-8 encoded string. Otherwise, an uninitialized value.
+ */
+std::optional<std::string> transcode_to_utf8(std::u32string_view contents, std::size_t pieces);
+
+} // namespace fly::parser::detail
@@ -1,4 +1,8 @@
+SRC_DIRS_$(d) := \
+    $(d)/detail
+
 SRC_$(d) := \
     $(d)/ini_parser.cpp \
     $(d)/json_parser.cpp \
+    $(d)/parallel_json_parser.cpp \
     $(d)/parser.cpp
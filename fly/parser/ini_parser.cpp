@@ -3,11 +3,11 @@
 #include "fly/logger/logger.hpp"
 #include "fly/types/string/string.hpp"
 
-#include <vector>
+#include <algorithm>
 
 namespace fly::parser {
 
-#define ILOG(format, ...) LOGW("[line {}]: " format, line() __VA_OPT__(, ) __VA_ARGS__)
+#define ILOG(format, ...) LOGW("[line {}]: " format, m_line_number __VA_OPT__(, ) __VA_ARGS__)
 
 //==================================================================================================
 std::optional<fly::Json> IniParser::parse_internal()
@@ -15,11 +15,14 @@ std::optional<fly::Json> IniParser::parse_internal()
     fly::Json values = json_object_type();
     fly::Json::iterator current;
 
-    std::string data;
+    std::string_view contents = read_remaining();
+    std::string_view data;
 
-    while (getline(data))
+    m_line_number = 0;
+
+    while (getline(contents, data))
     {
-        fly::String::trim(data);
+        data = trim_whitespace(data);
 
         if (data.empty() || data.starts_with(';'))
         {
@@ -37,7 +40,7 @@ std::optional<fly::Json> IniParser::parse_internal()
                 {
                     try
                     {
-                        auto it = values.insert_or_assign(*std::move(section), json_object_type());
+                        auto it = values.insert_or_assign(*section, json_object_type());
                         current = it.first;
                     }
                     catch (JsonException const &ex)
@@ -63,9 +66,7 @@ std::optional<fly::Json> IniParser::parse_internal()
                 {
                     try
                     {
-                        current->insert_or_assign(
-                            std::move(value->first),
-                            std::move(value->second));
+                        current->insert_or_assign(value->first, value->second);
                     }
                     catch (JsonException const &ex)
                     {
@@ -86,25 +87,28 @@ std::optional<fly::Json> IniParser::parse_internal()
 }
 
 //==================================================================================================
-bool IniParser::getline(std::string &result)
+bool IniParser::getline(std::string_view &contents, std::string_view &result)
 {
-    static constexpr int const s_new_line = 0x0a;
-
-    result.clear();
-    int ch;
+    static constexpr char const s_new_line = 0x0a;
 
-    while (!eof() && ((ch = get()) != s_new_line))
+    if (contents.empty())
     {
-        result += ch;
+        return false;
     }
 
-    return !eof() || !result.empty();
+    std::size_t const end = std::min(contents.find(s_new_line), contents.size());
+
+    result = contents.substr(0, end);
+    contents.remove_prefix(std::min(end + 1, contents.size()));
+
+    ++m_line_number;
+    return true;
 }
 
 //==================================================================================================
-std::optional<std::string> IniParser::on_section(std::string &section)
+std::optional<std::string_view> IniParser::on_section(std::string_view section)
 {
-    fly::String::trim(section);
+    section = trim_whitespace(section);
 
     if ((trim_value(section, '\'') != TrimResult::Untrimmed) ||
         (trim_value(section, '\"') != TrimResult::Untrimmed))
@@ -117,50 +121,66 @@ std::optional<std::string> IniParser::on_section(std::string &section)
 }
 
 //==================================================================================================
-std::optional<std::pair<std::string, std::string>>
-IniParser::on_name_value_pair(std::string const &name_value)
+std::optional<std::pair<std::string_view, std::string_view>>
+IniParser::on_name_value_pair(std::string_view name_value)
 {
-    static constexpr std::uint32_t s_size = 2;
+    std::size_t const delimiter = name_value.find('=');
 
-    std::vector<std::string> pair = fly::String::split(name_value, '=', s_size);
-
-    if (pair.size() == s_size)
+    if (delimiter == std::string_view::npos)
     {
-        std::string name(std::move(pair[0])), value(std::move(pair[1]));
+        ILOG("Require name/value pairs of the form name=value");
+        return std::nullopt;
+    }
 
-        fly::String::trim(name);
-        fly::String::trim(value);
+    std::string_view const assignment = name_value.substr(delimiter + 1);
 
-        if ((trim_value(name, '\'') != TrimResult::Untrimmed) ||
-            (trim_value(name, '\"') != TrimResult::Untrimmed))
-        {
-            ILOG("Value names must not be quoted");
-            return std::nullopt;
-        }
-        else if (
-            (trim_value(value, '\'') == TrimResult::Imbalanced) ||
-            (trim_value(value, '\"') == TrimResult::Imbalanced))
-        {
-            return std::nullopt;
-        }
+    std::string_view name = trim_whitespace(name_value.substr(0, delimiter));
+    std::string_view value = trim_whitespace(assignment);
 
-        return std::make_pair(std::move(name), std::move(value));
-    }
-    else
+    // An assignment operator immediately followed by another assigns an empty value.
+    if (name.empty() || value.empty() || assignment.starts_with('='))
     {
         ILOG("Require name/value pairs of the form name=value");
         return std::nullopt;
     }
+    else if (
+        (trim_value(name, '\'') != TrimResult::Untrimmed) ||
+        (trim_value(name, '\"') != TrimResult::Untrimmed))
+    {
+        ILOG("Value names must not be quoted");
+        return std::nullopt;
+    }
+    else if (
+        (trim_value(value, '\'') == TrimResult::Imbalanced) ||
+        (trim_value(value, '\"') == TrimResult::Imbalanced))
+    {
+        return std::nullopt;
+    }
+
+    return std::make_pair(name, value);
+}
+
+//==================================================================================================
+std::string_view IniParser::trim_whitespace(std::string_view str)
+{
+    auto is_non_space = [](char ch) {
+        return !fly::String::is_space(ch);
+    };
+
+    auto const begin = std::find_if(str.begin(), str.end(), is_non_space);
+    auto const end = std::find_if(str.rbegin(), str.rend(), is_non_space).base();
+
+    return (begin < end) ? std::string_view(begin, end) : std::string_view();
 }
 
 //==================================================================================================
-IniParser::TrimResult IniParser::trim_value(std::string &str, char ch) const
+IniParser::TrimResult IniParser::trim_value(std::string_view &str, char ch) const
 {
     return trim_value(str, ch, ch);
 }
 
 //==================================================================================================
-IniParser::TrimResult IniParser::trim_value(std::string &str, char start, char end) const
+IniParser::TrimResult IniParser::trim_value(std::string_view &str, char start, char end) const
 {
     bool starts_with_char = str.starts_with(start);
     bool ends_with_char = str.ends_with(end);
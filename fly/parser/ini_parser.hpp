@@ -3,15 +3,19 @@
 #include "fly/parser/parser.hpp"
 #include "fly/types/json/json.hpp"
 
-#include <istream>
+#include <cstdint>
 #include <optional>
-#include <string>
+#include <string_view>
+#include <utility>
 
 namespace fly::parser {
 
 /**
  * Implementation of the Parser interface for the .ini format.
  *
+ * The contents are scanned line-by-line as views into a single contiguous buffer. Lines are split
+ * and trimmed without copying; the only allocations made are for the parsed values themselves.
+ *
  * @author Timothy Flynn (trflynn89@pm.me)
  * @version July 18, 2016
  */
@@ -42,13 +46,14 @@ class IniParser : public Parser
     };
 
     /**
-     * Read symbols from the stream until a newline or end-of-file is reached.
+     * Extract symbols from the contents until a newline or the end of the contents is reached.
      *
-     * @param result The string to insert extracted symbols ito.
+     * @param contents The contents to extract symbols from.
+     * @param result The view to set to the extracted symbols.
      *
-     * @return True if any symbols were read.
+     * @return True if any symbols were extracted.
      */
-    bool getline(std::string &result);
+    bool getline(std::string_view &contents, std::string_view &result);
 
     /**
      * Parse a line containing a section name.
@@ -57,18 +62,26 @@ class IniParser : public Parser
      *
      * @return If successful, the parsed section name. Otherwise, an uninitialized value.
      */
-    std::optional<std::string> on_section(std::string &section);
+    std::optional<std::string_view> on_section(std::string_view section);
 
     /**
      * Parse a line containing a name/value pair.
      *
-     * @param section Section containing the pair.
      * @param name_value Line containing the pair.
      *
      * @return If successful, the parsed name/value pair. Otherwise, an uninitialized value.
      */
-    std::optional<std::pair<std::string, std::string>>
-    on_name_value_pair(std::string const &name_value);
+    std::optional<std::pair<std::string_view, std::string_view>>
+    on_name_value_pair(std::string_view name_value);
+
+    /**
+     * Remove leading and trailing whitespace from the given string.
+     *
+     * @param str The string to trim.
+     *
+     * @return A view into the given string without leading or trailing whitespace.
+     */
+    static std::string_view trim_whitespace(std::string_view str);
 
     /**
      * If the given string begins and ends with the given character, remove that character from each
@@ -79,7 +92,7 @@ class IniParser : public Parser
      *
      * @return The result of the trim operation.
      */
-    TrimResult trim_value(std::string &str, char ch) const;
+    TrimResult trim_value(std::string_view &str, char ch) const;
 
     /**
      * If the given string begins with the first given character and ends with the second given
@@ -91,7 +104,10 @@ class IniParser : public Parser
      *
      * @return The result of the trim operation.
      */
-    TrimResult trim_value(std::string &str, char start, char end) const;
+    TrimResult trim_value(std::string_view &str, char start, char end) const;
+
+    // Lines are extracted without updating the stream's line number, so they are counted here.
+    std::uint32_t m_line_number {0};
 };
 
 } // namespace fly::parser
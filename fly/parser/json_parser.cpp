@@ -3,6 +3,12 @@
 #include "fly/fly.hpp"
 #include "fly/logger/logger.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
+
 namespace fly::parser {
 
 #define JLOG(format, ...)                                                                          \
@@ -10,6 +16,47 @@ namespace fly::parser {
 
 namespace {
 
+    using FloatLimits = std::numeric_limits<fly::json_floating_point_type>;
+    using UnsignedLimits = std::numeric_limits<fly::json_unsigned_integer_type>;
+
+    constexpr auto const s_max_mantissa = UnsignedLimits::max();
+    constexpr auto const s_max_negative_mantissa =
+        static_cast<fly::json_unsigned_integer_type>(
+            std::numeric_limits<fly::json_signed_integer_type>::max()) +
+        1;
+
+    // Largest mantissa which may be exactly represented by the floating-point type.
+    constexpr auto const s_max_exact_mantissa = (FloatLimits::digits >= UnsignedLimits::digits) ?
+        s_max_mantissa :
+        ((fly::json_unsigned_integer_type(1) << FloatLimits::digits) - 1);
+
+    // Largest power of 10 which may be exactly represented by the floating-point type. A power of
+    // 10 is exact if its odd factor, 5^N, fits within the mantissa (i.e. N <= digits / log2(5)).
+    constexpr std::int32_t const s_max_exact_exponent = (FloatLimits::digits * 10000) / 23220;
+
+    // Largest exponent to accumulate while parsing; anything larger is out of range regardless.
+    constexpr std::int32_t const s_max_exponent = 100'000;
+
+    constexpr auto const s_powers_of_10 = []() {
+        std::array<fly::json_floating_point_type, s_max_exact_exponent + 1> powers {};
+        powers[0] = 1;
+
+        for (std::size_t i = 1; i < powers.size(); ++i)
+        {
+            powers[i] = powers[i - 1] * 10;
+        }
+
+        return powers;
+    }();
+
+    inline bool is_digit(JsonParser::Token token)
+    {
+        // The JSON string classifier is not used here because the token may be the end-of-file
+        // indicator, which is not a valid character.
+        auto const symbol = static_cast<std::underlying_type_t<JsonParser::Token>>(token);
+        return (symbol >= 0x30) && (symbol <= 0x39);
+    }
+
     inline bool
     is_feature_enabled(JsonParser::Features enabled_features, JsonParser::Features feature)
     {
@@ -219,53 +266,203 @@ std::optional<fly::json_string_type> JsonParser::parse_quoted_string()
 //==================================================================================================
 std::optional<fly::Json> JsonParser::parse_value()
 {
-    fly::json_string_type const value = consume_value();
-
-    if (value == FLY_JSON_STR("true"))
-    {
-        return true;
-    }
-    else if (value == FLY_JSON_STR("false"))
-    {
-        return false;
-    }
-    else if (value == FLY_JSON_STR("null"))
+    switch (peek<fly::json_char_type>())
     {
-        return nullptr;
-    }
-
-    switch (validate_number(value))
-    {
-        case NumberType::SignedInteger:
-            if (auto num = fly::JsonStringType::convert<fly::json_signed_integer_type>(value); num)
+        case FLY_JSON_CHR('t'):
+            if (consume_literal(FLY_JSON_STR("true")))
             {
-                return *num;
+                return true;
             }
             break;
 
-        case NumberType::UnsignedInteger:
-            if (auto num = fly::JsonStringType::convert<fly::json_unsigned_integer_type>(value);
-                num)
+        case FLY_JSON_CHR('f'):
+            if (consume_literal(FLY_JSON_STR("false")))
             {
-                return *num;
+                return false;
             }
             break;
 
-        case NumberType::FloatingPoint:
-            if (auto num = fly::JsonStringType::convert<fly::json_floating_point_type>(value); num)
+        case FLY_JSON_CHR('n'):
+            if (consume_literal(FLY_JSON_STR("null")))
             {
-                return *num;
+                return nullptr;
             }
             break;
 
         default:
-            break;
+            return parse_number();
     }
 
-    JLOG("Could not convert '{}' to a JSON value", value);
+    JLOG("Could not convert literal name to a JSON value");
     return std::nullopt;
 }
 
+//==================================================================================================
+std::optional<fly::Json> JsonParser::parse_number()
+{
+    m_number_buffer.clear();
+
+    fly::json_unsigned_integer_type mantissa = 0;
+    std::int32_t exponent = 0;
+
+    bool mantissa_overflow = false;
+    bool is_floating_point = false;
+
+    // Extract consecutive digits, accumulating them into the mantissa while it does not overflow.
+    // Digits after the decimal point shift the decimal exponent of the mantissa.
+    auto consume_digits = [&](bool is_fraction) -> std::size_t {
+        std::size_t count = 0;
+
+        for (; is_digit(peek<Token>()); ++count)
+        {
+            auto const digit =
+                static_cast<fly::json_unsigned_integer_type>(consume_number_symbol() - '0');
+
+            if (mantissa_overflow)
+            {
+                continue;
+            }
+            else if (mantissa > ((s_max_mantissa - digit) / 10))
+            {
+                mantissa_overflow = true;
+            }
+            else
+            {
+                mantissa = (mantissa * 10) + digit;
+                exponent -= is_fraction ? 1 : 0;
+            }
+        }
+
+        return count;
+    };
+
+    bool const is_negative = peek<Token>() == Token::Hyphen;
+
+    if (is_negative)
+    {
+        consume_number_symbol();
+    }
+
+    fly::json_char_type const first_digit = peek<fly::json_char_type>();
+
+    if (std::size_t const digits = consume_digits(false);
+        (digits == 0) || ((first_digit == FLY_JSON_CHR('0')) && (digits > 1)))
+    {
+        JLOG("Could not convert '{}' to a JSON number, invalid integral part", m_number_buffer);
+        return std::nullopt;
+    }
+
+    if (peek<fly::json_char_type>() == FLY_JSON_CHR('.'))
+    {
+        consume_number_symbol();
+        is_floating_point = true;
+
+        if (consume_digits(true) == 0)
+        {
+            JLOG("Could not convert '{}' to a JSON number, invalid fraction", m_number_buffer);
+            return std::nullopt;
+        }
+    }
+
+    if (fly::json_char_type const ch = peek<fly::json_char_type>();
+        (ch == FLY_JSON_CHR('e')) || (ch == FLY_JSON_CHR('E')))
+    {
+        consume_number_symbol();
+        is_floating_point = true;
+
+        bool const is_negative_exponent = peek<Token>() == Token::Hyphen;
+
+        if (is_negative_exponent || (peek<fly::json_char_type>() == FLY_JSON_CHR('+')))
+        {
+            consume_number_symbol();
+        }
+
+        std::int32_t explicit_exponent = 0;
+        std::size_t count = 0;
+
+        for (; is_digit(peek<Token>()); ++count)
+        {
+            auto const digit = static_cast<std::int32_t>(consume_number_symbol() - '0');
+
+            // Values this large cannot be computed directly anyways. Clamp the exponent to avoid
+            // overflow and let the slow path below determine whether the value is valid.
+            explicit_exponent = std::min((explicit_exponent * 10) + digit, s_max_exponent);
+        }
+
+        if (count == 0)
+        {
+            JLOG("Could not convert '{}' to a JSON number, invalid exponent", m_number_buffer);
+            return std::nullopt;
+        }
+
+        exponent += is_negative_exponent ? -explicit_exponent : explicit_exponent;
+    }
+
+    if (!is_value_terminator(peek<Token>()))
+    {
+        JLOG("Could not convert '{}' to a JSON number, found {:#04x}", m_number_buffer, peek());
+        return std::nullopt;
+    }
+
+    if (!is_floating_point)
+    {
+        if (mantissa_overflow)
+        {
+            JLOG("Could not convert '{}' to a JSON number, value out of range", m_number_buffer);
+            return std::nullopt;
+        }
+        else if (is_negative)
+        {
+            if (mantissa > s_max_negative_mantissa)
+            {
+                JLOG(
+                    "Could not convert '{}' to a JSON number, value out of range",
+                    m_number_buffer);
+                return std::nullopt;
+            }
+
+            // Negating the unsigned mantissa before the conversion is well-defined, and allows the
+            // minimum signed integer to be represented.
+            return static_cast<fly::json_signed_integer_type>(~mantissa + 1);
+        }
+
+        return mantissa;
+    }
+
+    // Fast path: if the mantissa and the power of 10 are both exactly representable, a single
+    // multiplication or division results in a correctly rounded value.
+    if (!mantissa_overflow && (mantissa <= s_max_exact_mantissa) &&
+        (exponent >= -s_max_exact_exponent) && (exponent <= s_max_exact_exponent))
+    {
+        auto value = static_cast<fly::json_floating_point_type>(mantissa);
+
+        if (exponent < 0)
+        {
+            value /= s_powers_of_10[static_cast<std::size_t>(-exponent)];
+        }
+        else
+        {
+            value *= s_powers_of_10[static_cast<std::size_t>(exponent)];
+        }
+
+        return is_negative ? -value : value;
+    }
+
+    // Slow path: the value cannot be computed directly, so convert the stored symbols.
+    char *end = nullptr;
+    errno = 0;
+
+    fly::json_floating_point_type const value = std::strtold(m_number_buffer.c_str(), &end);
+
+    if ((errno == ERANGE) || (end != (m_number_buffer.c_str() + m_number_buffer.size())))
+    {
+        JLOG("Could not convert '{}' to a JSON number, value out of range", m_number_buffer);
+        return std::nullopt;
+    }
+
+    return value;
+}
+
 //==================================================================================================
 JsonParser::ParseState JsonParser::consume_token(Token token)
 {
@@ -302,31 +499,26 @@ JsonParser::ParseState JsonParser::consume_comma(Token end_token)
 }
 
 //==================================================================================================
-fly::json_string_type JsonParser::consume_value()
+bool JsonParser::consume_literal(fly::JsonStringType::view_type literal)
 {
-    fly::json_string_type value;
-
-    auto keep_parsing = [this](Token token) -> bool {
-        switch (token)
+    for (fly::json_char_type const ch : literal)
+    {
+        if (get<fly::json_char_type>() != ch)
         {
-            case Token::Comma:
-            case Token::Solidus:
-            case Token::CloseBracket:
-            case Token::CloseBrace:
-            case Token::EndOfFile:
-                return false;
-
-            default:
-                return !is_whitespace(token);
+            return false;
         }
-    };
-
-    while (keep_parsing(peek<Token>()))
-    {
-        value.push_back(get<fly::json_char_type>());
     }
 
-    return value;
+    return is_value_terminator(peek<Token>());
+}
+
+//==================================================================================================
+fly::json_char_type JsonParser::consume_number_symbol()
+{
+    auto const ch = get<fly::json_char_type>();
+    m_number_buffer.push_back(ch);
+
+    return ch;
 }
 
 //==================================================================================================
@@ -412,55 +604,6 @@ JsonParser::ParseState JsonParser::consume_comment()
     return ParseState::KeepParsing;
 }
 
-//==================================================================================================
-JsonParser::NumberType JsonParser::validate_number(fly::json_string_type const &value) const
-{
-    fly::JsonStringType::view_type const value_view = value;
-
-    bool const is_signed = !value_view.empty() && (value_view[0] == '-');
-    auto const signless = value_view.substr(is_signed ? 1 : 0);
-
-    if (signless.empty())
-    {
-        return NumberType::Invalid;
-    }
-
-    bool const is_octal =
-        (signless.size() > 1) && (signless[0] == '0') && fly::JsonStringType::is_digit(signless[1]);
-
-    if (!fly::JsonStringType::is_digit(signless[0]) || is_octal)
-    {
-        return NumberType::Invalid;
-    }
-
-    fly::json_string_type::size_type const d = signless.find('.');
-    fly::json_string_type::size_type const e1 = signless.find('e');
-    fly::json_string_type::size_type const e2 = signless.find('E');
-
-    if (d != fly::json_string_type::npos)
-    {
-        fly::json_string_type::size_type end = signless.size();
-
-        if ((e1 != fly::json_string_type::npos) || (e2 != fly::json_string_type::npos))
-        {
-            end = std::min(e1, e2);
-        }
-
-        if ((d + 1) >= end)
-        {
-            return NumberType::Invalid;
-        }
-
-        return NumberType::FloatingPoint;
-    }
-    else if ((e1 != fly::json_string_type::npos) || (e2 != fly::json_string_type::npos))
-    {
-        return NumberType::FloatingPoint;
-    }
-
-    return is_signed ? NumberType::SignedInteger : NumberType::UnsignedInteger;
-}
-
 //==================================================================================================
 bool JsonParser::is_whitespace(Token token) const
 {
@@ -478,6 +621,23 @@ bool JsonParser::is_whitespace(Token token) const
     }
 }
 
+//==================================================================================================
+bool JsonParser::is_value_terminator(Token token) const
+{
+    switch (token)
+    {
+        case Token::Comma:
+        case Token::Solidus:
+        case Token::CloseBracket:
+        case Token::CloseBrace:
+        case Token::EndOfFile:
+            return true;
+
+        default:
+            return is_whitespace(token);
+    }
+}
+
 //==================================================================================================
 JsonParser::Features operator&(JsonParser::Features a, JsonParser::Features b)
 {
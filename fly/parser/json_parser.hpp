@@ -91,17 +91,6 @@ class JsonParser : public Parser
     std::optional<fly::Json> parse_internal() override;
 
 private:
-    /**
-     * Enumeration to indicate the type of a JSON number to parse.
-     */
-    enum class NumberType : std::uint8_t
-    {
-        Invalid,
-        SignedInteger,
-        UnsignedInteger,
-        FloatingPoint,
-    };
-
     /**
      * Enumeration to indicate the current status of parsing the JSON value.
      */
@@ -160,6 +149,16 @@ class JsonParser : public Parser
      */
     std::optional<fly::Json> parse_value();
 
+    /**
+     * Parse a JSON number from the stream in a single pass. Integers are accumulated directly from
+     * the stream, and floating-point values which are exactly representable as the product of an
+     * integer mantissa and a power of 10 are computed without any intermediate conversion. Only
+     * floating-point values which do not meet that criteria are converted from their textual form.
+     *
+     * @return If successful, the parsed JSON number. Otherwise, an uninitialized value.
+     */
+    std::optional<fly::Json> parse_number();
+
     /**
      * Extract a single symbol from the stream. Ensure that symbol is equal to an expected token.
      *
@@ -178,11 +177,21 @@ class JsonParser : public Parser
     ParseState consume_comma(Token end_token);
 
     /**
-     * Extract a number, boolean, or null value from the stream.
+     * Extract a literal name (true, false, or null) from the stream. The literal must be followed
+     * by a symbol which may terminate a JSON value.
+     *
+     * @param literal The literal name to extract.
      *
-     * @return The JSON value that was parsed as a string.
+     * @return True if the literal was extracted.
      */
-    fly::json_string_type consume_value();
+    bool consume_literal(fly::JsonStringType::view_type literal);
+
+    /**
+     * Extract a single symbol from the stream and store it in the number buffer.
+     *
+     * @return The extracted symbol.
+     */
+    fly::json_char_type consume_number_symbol();
 
     /**
      * Extract all consecutive whitespace symbols and comments (if enabled in the feature set) from
@@ -206,26 +215,30 @@ class JsonParser : public Parser
     ParseState consume_comment();
 
     /**
-     * Validate that a parsed number is valid and interpret its numeric JSON type.
+     * Check if a symbol is a whitespace symbol.
      *
-     * @param value String storing the parsed number to validate.
+     * @param token The token to inspect.
      *
-     * @return The interpreted JSON value type.
+     * @return True if the symbol is whitespace.
      */
-    NumberType validate_number(fly::json_string_type const &value) const;
+    bool is_whitespace(Token token) const;
 
     /**
-     * Check if a symbol is a whitespace symbol.
+     * Check if a symbol may terminate a JSON number, boolean, or null value.
      *
      * @param token The token to inspect.
      *
-     * @return True if the symbol is whitespace.
+     * @return True if the symbol terminates the value.
      */
-    bool is_whitespace(Token token) const;
+    bool is_value_terminator(Token token) const;
 
     bool const m_allow_comments {false};
     bool const m_allow_trailing_comma {false};
     bool const m_allow_any_type {false};
+
+    // Storage for the symbols of the number being parsed, only used for conversions which cannot
+    // be performed directly. Re-used between numbers to avoid repeated allocations.
+    fly::json_string_type m_number_buffer;
 };
 
 /**
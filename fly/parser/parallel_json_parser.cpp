@@ -0,0 +1,480 @@
+#include "fly/parser/parallel_json_parser.hpp"
+
+#include "fly/logger/logger.hpp"
+#include "fly/task/task_runner.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <future>
+#include <system_error>
+#include <thread>
+
+namespace fly::parser {
+
+namespace {
+
+    constexpr std::string_view s_utf8_byte_order_mark = "\xef\xbb\xbf";
+
+    // Automatically sized chunks are no smaller than this, to amortize the cost of each task.
+    constexpr std::size_t s_min_chunk_size = 64 << 10;
+
+    // Number of automatically sized chunks to create per hardware thread, to balance the load
+    // between threads when some chunks are more expensive to parse than others.
+    constexpr std::size_t s_chunks_per_thread = 4;
+
+    inline bool is_whitespace(char ch)
+    {
+        switch (ch)
+        {
+            case '\t':
+            case '\n':
+            case '\v':
+            case '\r':
+            case ' ':
+                return true;
+
+            default:
+                return false;
+        }
+    }
+
+    /**
+     * Find the closing quote of a JSON string.
+     *
+     * @param contents The string to scan.
+     * @param position The position of the opening quote.
+     *
+     * @return The position of the closing quote, or the size of the string if it is unterminated.
+     */
+    std::size_t skip_string(std::string_view contents, std::size_t position)
+    {
+        while ((position = contents.find_first_of("\"\\", position + 1)) != std::string_view::npos)
+        {
+            if (contents[position] == '"')
+            {
+                return position;
+            }
+
+            // Skip the escaped symbol, which may be a quote.
+            ++position;
+        }
+
+        return contents.size();
+    }
+
+    /**
+     * Skip a single- or multi-line comment.
+     *
+     * @param contents The string to scan.
+     * @param position The position of the opening solidus.
+     *
+     * @return The position after the comment, or the given position if it is not a comment.
+     */
+    std::size_t skip_comment(std::string_view contents, std::size_t position)
+    {
+        if ((position + 1) >= contents.size())
+        {
+            return position;
+        }
+        else if (contents[position + 1] == '/')
+        {
+            position = contents.find('\n', position + 2);
+            return (position == std::string_view::npos) ? contents.size() : position + 1;
+        }
+        else if (contents[position + 1] == '*')
+        {
+            position = contents.find("*/", position + 2);
+            return (position == std::string_view::npos) ? contents.size() : position + 2;
+        }
+
+        return position;
+    }
+
+    std::optional<std::string> read_file(std::filesystem::path const &path)
+    {
+        std::error_code error;
+        auto const size = std::filesystem::file_size(path, error);
+
+        if (error)
+        {
+            LOGW("Could not determine size of {}: {}", path.string(), error.message());
+            return std::nullopt;
+        }
+
+        std::ifstream stream(path, std::ios::in | std::ios::binary);
+        std::string contents(static_cast<std::size_t>(size), '\0');
+
+        if (!stream.read(contents.data(), static_cast<std::streamsize>(contents.size())))
+        {
+            LOGW("Could not read {}", path.string());
+            return std::nullopt;
+        }
+
+        return contents;
+    }
+
+} // namespace
+
+//==================================================================================================
+ParallelJsonParser::ParallelJsonParser(
+    std::shared_ptr<fly::task::TaskRunner> task_runner,
+    Layout layout,
+    JsonParser::Features features,
+    std::size_t chunk_size) noexcept :
+    m_task_runner(std::move(task_runner)),
+    m_layout(layout),
+    m_features(features),
+    m_allow_comments(
+        (features & JsonParser::Features::AllowComments) != JsonParser::Features::Strict),
+    m_allow_trailing_comma(
+        (features & JsonParser::Features::AllowTrailingComma) != JsonParser::Features::Strict),
+    m_chunk_size(chunk_size)
+{
+}
+
+//==================================================================================================
+std::optional<fly::Json> ParallelJsonParser::parse_string(std::string_view contents)
+{
+    fly::Json records = fly::json_array_type();
+
+    auto callback = [&records](std::size_t, fly::Json &&record) {
+        records.push_back(std::move(record));
+    };
+
+    if (parse_string(contents, std::move(callback)))
+    {
+        return records;
+    }
+
+    return std::nullopt;
+}
+
+//==================================================================================================
+bool ParallelJsonParser::parse_string(std::string_view contents, RecordCallback callback)
+{
+    using ChunkResult = std::optional<fly::json_array_type>;
+
+    std::size_t chunk_size = m_chunk_size;
+
+    if (chunk_size == 0)
+    {
+        std::size_t const threads = std::max(std::thread::hardware_concurrency(), 1U);
+        chunk_size = std::max(contents.size() / (threads * s_chunks_per_thread), s_min_chunk_size);
+    }
+
+    std::optional<std::vector<Chunk>> chunks = (m_layout == Layout::Array) ?
+        split_array(contents, chunk_size) :
+        split_lines(contents, chunk_size);
+
+    if (!chunks)
+    {
+        return false;
+    }
+
+    std::vector<std::future<ChunkResult>> results;
+    results.reserve(chunks->size());
+
+    for (Chunk const &chunk : *chunks)
+    {
+        auto task = [this, chunk]() {
+            return parse_chunk(chunk);
+        };
+
+        results.push_back(m_task_runner->post_task_with_future(FROM_HERE, std::move(task)));
+    }
+
+    std::exception_ptr exception;
+    bool success = true;
+    std::size_t index = 0;
+
+    // Every result must be waited upon, even after a failure, because the parsing tasks reference
+    // the contents and this parser. Thus, the first exception thrown by a parsing task or by the
+    // callback is only rethrown once all tasks have completed.
+    for (auto &result : results)
+    {
+        try
+        {
+            ChunkResult records = result.get();
+
+            if (!success)
+            {
+                continue;
+            }
+            else if (!records)
+            {
+                success = false;
+                continue;
+            }
+
+            for (auto &record : *records)
+            {
+                callback(index++, std::move(record));
+            }
+        }
+        catch (...)
+        {
+            if (success)
+            {
+                exception = std::current_exception();
+                success = false;
+            }
+        }
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+
+    return success;
+}
+
+//==================================================================================================
+std::optional<fly::Json> ParallelJsonParser::parse_file(std::filesystem::path const &path)
+{
+    if (std::optional<std::string> contents = read_file(path); contents)
+    {
+        std::string_view view(*contents);
+
+        if (view.starts_with(s_utf8_byte_order_mark))
+        {
+            view.remove_prefix(s_utf8_byte_order_mark.size());
+        }
+
+        return parse_string(view);
+    }
+
+    return std::nullopt;
+}
+
+//==================================================================================================
+bool ParallelJsonParser::parse_file(std::filesystem::path const &path, RecordCallback callback)
+{
+    if (std::optional<std::string> contents = read_file(path); contents)
+    {
+        std::string_view view(*contents);
+
+        if (view.starts_with(s_utf8_byte_order_mark))
+        {
+            view.remove_prefix(s_utf8_byte_order_mark.size());
+        }
+
+        return parse_string(view, std::move(callback));
+    }
+
+    return false;
+}
+
+//==================================================================================================
+std::optional<std::vector<ParallelJsonParser::Chunk>>
+ParallelJsonParser::split_array(std::string_view contents, std::size_t chunk_size) const
+{
+    std::size_t position = skip_whitespace_and_comments(contents, 0);
+
+    if ((position == contents.size()) || (contents[position] != '['))
+    {
+        LOGW("Parallel JSON parsing requires a top-level array");
+        return std::nullopt;
+    }
+
+    std::vector<Chunk> chunks;
+    std::size_t chunk_start = ++position;
+    std::size_t depth = 1;
+
+    for (; position < contents.size(); ++position)
+    {
+        switch (contents[position])
+        {
+            case '"':
+                position = skip_string(contents, position);
+                break;
+
+            case '[':
+            case '{':
+                ++depth;
+                break;
+
+            case ']':
+            case '}':
+                --depth;
+                break;
+
+            case ',':
+                if ((depth == 1) && ((position - chunk_start) >= chunk_size))
+                {
+                    chunks.push_back({contents.substr(chunk_start, position - chunk_start)});
+                    chunk_start = position + 1;
+                }
+                break;
+
+            case '/':
+                if (m_allow_comments)
+                {
+                    position = std::max(skip_comment(contents, position), position + 1) - 1;
+                }
+                break;
+
+            default:
+                break;
+        }
+
+        if (depth == 0)
+        {
+            break;
+        }
+    }
+
+    // Mismatched brackets within each element are detected when the element is parsed, but the
+    // top-level array is not parsed as a whole, so it must be closed by its own bracket here.
+    if (depth != 0)
+    {
+        LOGW("Top-level JSON array is not terminated");
+        return std::nullopt;
+    }
+    else if (contents[position] != ']')
+    {
+        LOGW("Top-level JSON array is terminated by {:#04x}", contents[position]);
+        return std::nullopt;
+    }
+    else if (skip_whitespace_and_comments(contents, position + 1) != contents.size())
+    {
+        LOGW("Extraneous symbols found after top-level JSON array");
+        return std::nullopt;
+    }
+
+    // The last chunk may only be empty if it is the entire array, or if it follows a trailing
+    // comma.
+    bool const may_be_empty = chunks.empty() || m_allow_trailing_comma;
+
+    chunks.push_back({contents.substr(chunk_start, position - chunk_start), true, may_be_empty});
+    return chunks;
+}
+
+//==================================================================================================
+std::vector<ParallelJsonParser::Chunk>
+ParallelJsonParser::split_lines(std::string_view contents, std::size_t chunk_size) const
+{
+    std::vector<Chunk> chunks;
+    std::size_t chunk_start = 0;
+
+    while ((contents.size() - chunk_start) > chunk_size)
+    {
+        std::size_t const position = contents.find('\n', chunk_start + chunk_size);
+
+        if (position == std::string_view::npos)
+        {
+            break;
+        }
+
+        chunks.push_back({contents.substr(chunk_start, position - chunk_start), false, true});
+        chunk_start = position + 1;
+    }
+
+    chunks.push_back({contents.substr(chunk_start), true, true});
+    return chunks;
+}
+
+//==================================================================================================
+std::optional<fly::json_array_type> ParallelJsonParser::parse_chunk(Chunk const &chunk) const
+{
+    return (m_layout == Layout::Array) ? parse_array_chunk(chunk) : parse_lines_chunk(chunk);
+}
+
+//==================================================================================================
+std::optional<fly::json_array_type> ParallelJsonParser::parse_array_chunk(Chunk const &chunk) const
+{
+    // A chunk which is followed by another chunk is also followed by a comma, so a trailing comma
+    // within the chunk would actually be a repeated comma in the document.
+    JsonParser parser(
+        chunk.m_is_last ? m_features : (m_features & JsonParser::Features::AllowComments));
+
+    std::string wrapped;
+    wrapped.reserve(chunk.m_contents.size() + 2);
+    wrapped.push_back('[');
+    wrapped.append(chunk.m_contents);
+    wrapped.push_back(']');
+
+    std::optional<fly::Json> json = parser.parse_string(wrapped);
+
+    if (!json)
+    {
+        return std::nullopt;
+    }
+
+    auto records = fly::json_array_type(*std::move(json));
+
+    if (records.empty() && !chunk.m_may_be_empty)
+    {
+        LOGW("Found empty element in top-level JSON array");
+        return std::nullopt;
+    }
+
+    return records;
+}
+
+//==================================================================================================
+std::optional<fly::json_array_type> ParallelJsonParser::parse_lines_chunk(Chunk const &chunk) const
+{
+    JsonParser parser(m_features | JsonParser::Features::AllowAnyType);
+    fly::json_array_type records;
+
+    std::string_view contents = chunk.m_contents;
+    std::string line;
+
+    while (!contents.empty())
+    {
+        std::size_t const position = std::min(contents.find('\n'), contents.size());
+
+        line.assign(contents.substr(0, position));
+        contents.remove_prefix(std::min(position + 1, contents.size()));
+
+        if (std::all_of(line.begin(), line.end(), is_whitespace))
+        {
+            continue;
+        }
+        else if (std::optional<fly::Json> record = parser.parse_string(line); record)
+        {
+            records.push_back(*std::move(record));
+        }
+        else
+        {
+            return std::nullopt;
+        }
+    }
+
+    return records;
+}
+
+//==================================================================================================
+std::size_t
+ParallelJsonParser::skip_whitespace_and_comments(std::string_view contents, std::size_t position)
+    const
+{
+    while (position < contents.size())
+    {
+        if (is_whitespace(contents[position]))
+        {
+            ++position;
+        }
+        else if (m_allow_comments && (contents[position] == '/'))
+        {
+            if (std::size_t const next = skip_comment(contents, position); next != position)
+            {
+                position = next;
+            }
+            else
+            {
+                break;
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return position;
+}
+
+} // namespace fly::parser
@@ -0,0 +1,203 @@
+#pragma once
+
+#include "fly/parser/json_parser.hpp"
+#include "fly/types/json/json.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace fly::task {
+class TaskRunner;
+} // namespace fly::task
+
+namespace fly::parser {
+
+/**
+ * Class to parse very large JSON documents concurrently. Supported documents are either a single
+ * top-level JSON array, or newline-delimited JSON (NDJSON), in which each non-empty line holds one
+ * complete JSON value.
+ *
+ * The document is first split into chunks with a fast structural scan, which only tracks string
+ * boundaries and nesting depth to locate top-level element (or record) boundaries. Each chunk is
+ * then parsed with a fly::parser::JsonParser as a task posted to the provided task runner. When
+ * given a parallel task runner, throughput will scale with the task manager's thread count.
+ *
+ * The parsed elements may either be stitched back together into a single JSON array, or delivered
+ * one record at a time to a callback. Records are always delivered in document order on the
+ * calling thread, and each chunk's records are delivered as soon as that chunk has been parsed.
+ *
+ * Parsing blocks the calling thread until all chunks have been parsed, and the task manager must be
+ * running. Parsing must not be invoked from a task running on the provided task runner: a sequenced
+ * task runner would deadlock, as would a parallel task runner whose worker threads are all blocked.
+ * If parsing a chunk throws an exception, the exception is rethrown on the calling thread once all
+ * chunks have completed.
+ *
+ * Only UTF-8 encoded contents are supported.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+class ParallelJsonParser
+{
+public:
+    /**
+     * Enumerated list of supported document layouts.
+     */
+    enum class Layout : std::uint8_t
+    {
+        // A single top-level JSON array.
+        Array,
+
+        // Newline-delimited JSON values.
+        NewlineDelimited,
+    };
+
+    /**
+     * Callback to receive each parsed record, along with the record's index within the document.
+     * If the callback throws an exception, no further records are delivered, and the exception is
+     * rethrown once all outstanding parsing tasks have completed.
+     */
+    using RecordCallback = std::function<void(std::size_t, fly::Json &&)>;
+
+    /**
+     * Constructor.
+     *
+     * @param task_runner Task runner for posting parsing tasks onto.
+     * @param layout The layout of documents to parse.
+     * @param features The extra JSON parsing features to allow.
+     * @param chunk_size The approximate size in bytes of each parsed chunk. If zero, the chunk size
+     *        is computed from the size of the document and the number of hardware threads.
+     */
+    ParallelJsonParser(
+        std::shared_ptr<fly::task::TaskRunner> task_runner,
+        Layout layout,
+        JsonParser::Features features = JsonParser::Features::Strict,
+        std::size_t chunk_size = 0) noexcept;
+
+    /**
+     * Parse a string and stitch the parsed records into a single JSON array.
+     *
+     * @param contents String contents to parse.
+     *
+     * @return If successful, the parsed records. Otherwise, an uninitialized value.
+     */
+    std::optional<fly::Json> parse_string(std::string_view contents);
+
+    /**
+     * Parse a string and deliver each parsed record to a callback. If parsing fails, records which
+     * were parsed before the failing chunk may have already been delivered.
+     *
+     * @param contents String contents to parse.
+     * @param callback The callback to receive each parsed record.
+     *
+     * @return True if the entire string was successfully parsed.
+     */
+    bool parse_string(std::string_view contents, RecordCallback callback);
+
+    /**
+     * Parse a file and stitch the parsed records into a single JSON array.
+     *
+     * @param path Path to the file to parse.
+     *
+     * @return If successful, the parsed records. Otherwise, an uninitialized value.
+     */
+    std::optional<fly::Json> parse_file(std::filesystem::path const &path);
+
+    /**
+     * Parse a file and deliver each parsed record to a callback. If parsing fails, records which
+     * were parsed before the failing chunk may have already been delivered.
+     *
+     * @param path Path to the file to parse.
+     * @param callback The callback to receive each parsed record.
+     *
+     * @return True if the entire file was successfully parsed.
+     */
+    bool parse_file(std::filesystem::path const &path, RecordCallback callback);
+
+private:
+    /**
+     * A contiguous range of the document to be parsed by a single task.
+     */
+    struct Chunk
+    {
+        std::string_view m_contents;
+        bool m_is_last {false};
+        bool m_may_be_empty {false};
+    };
+
+    /**
+     * Split a top-level JSON array into chunks of consecutive elements.
+     *
+     * @param contents String contents to split.
+     * @param chunk_size The approximate size in bytes of each chunk.
+     *
+     * @return If successful, the list of chunks. Otherwise, an uninitialized value.
+     */
+    std::optional<std::vector<Chunk>>
+    split_array(std::string_view contents, std::size_t chunk_size) const;
+
+    /**
+     * Split newline-delimited JSON values into chunks of consecutive lines.
+     *
+     * @param contents String contents to split.
+     * @param chunk_size The approximate size in bytes of each chunk.
+     *
+     * @return The list of chunks.
+     */
+    std::vector<Chunk> split_lines(std::string_view contents, std::size_t chunk_size) const;
+
+    /**
+     * Parse a single chunk of the document.
+     *
+     * @param chunk The chunk to parse.
+     *
+     * @return If successful, the parsed records in the chunk. Otherwise, an uninitialized value.
+     */
+    std::optional<fly::json_array_type> parse_chunk(Chunk const &chunk) const;
+
+    /**
+     * Parse a single chunk of a top-level JSON array.
+     *
+     * @param chunk The chunk to parse.
+     *
+     * @return If successful, the parsed records in the chunk. Otherwise, an uninitialized value.
+     */
+    std::optional<fly::json_array_type> parse_array_chunk(Chunk const &chunk) const;
+
+    /**
+     * Parse a single chunk of newline-delimited JSON values.
+     *
+     * @param chunk The chunk to parse.
+     *
+     * @return If successful, the parsed records in the chunk. Otherwise, an uninitialized value.
+     */
+    std::optional<fly::json_array_type> parse_lines_chunk(Chunk const &chunk) const;
+
+    /**
+     * Skip whitespace, and comments if enabled, starting at a position in a string.
+     *
+     * @param contents The string to scan.
+     * @param position The position to start scanning from.
+     *
+     * @return The position of the first symbol which is not whitespace or part of a comment.
+     */
+    std::size_t skip_whitespace_and_comments(std::string_view contents, std::size_t position) const;
+
+    std::shared_ptr<fly::task::TaskRunner> m_task_runner;
+
+    Layout const m_layout;
+    JsonParser::Features const m_features;
+    bool const m_allow_comments;
+    bool const m_allow_trailing_comma;
+
+    std::size_t const m_chunk_size;
+};
+
+} // namespace fly::parser
@@ -1,12 +1,21 @@
 #include "fly/parser/parser.hpp"
 
+#include "fly/parser/detail/utf8_transcoder.hpp"
+#include "fly/types/numeric/endian.hpp"
+
+#include <algorithm>
 #include <cstring>
 #include <fstream>
+#include <sstream>
 
 namespace fly::parser {
 
 namespace {
 
+    // Size of each block read from streams by ensure_utf8(), and by read_remaining() from streams
+    // which are not backed by a string.
+    constexpr std::streamsize s_read_block_size = 64 << 10;
+
     constexpr std::istream::char_type const *s_utf8_byte_order_mark = "\xef\xbb\xbf";
     constexpr std::size_t s_utf8_byte_order_mark_size = 3;
 
@@ -44,6 +53,39 @@ namespace {
 
 } // namespace
 
+//==================================================================================================
+template <typename StringType, std::endian Endianness>
+std::optional<std::string> Parser::ensure_utf8(std::istream &stream) const
+{
+    using char_type = typename StringType::value_type;
+
+    static constexpr std::size_t s_char_size = sizeof(char_type);
+    static constexpr std::size_t s_block_size = static_cast<std::size_t>(s_read_block_size);
+
+    // Read the stream directly into the code unit buffer. A trailing partial code unit is dropped.
+    StringType contents;
+    std::size_t size = 0;
+
+    do
+    {
+        contents.resize((size + s_block_size + s_char_size - 1) / s_char_size);
+
+        stream.read(reinterpret_cast<char *>(contents.data()) + size, s_read_block_size);
+        size += static_cast<std::size_t>(stream.gcount());
+    } while (stream);
+
+    contents.resize(size / s_char_size);
+
+    if constexpr (Endianness != std::endian::native)
+    {
+        std::transform(contents.begin(), contents.end(), contents.begin(), [](char_type unit) {
+            return endian_swap(unit);
+        });
+    }
+
+    return detail::transcode_to_utf8(std::basic_string_view<char_type>(contents));
+}
+
 //==================================================================================================
 std::optional<fly::Json> Parser::parse_file(std::filesystem::path const &path)
 {
@@ -100,6 +142,32 @@ std::optional<fly::Json> Parser::parse_stream(std::istream &&stream)
     return result;
 }
 
+//==================================================================================================
+std::string_view Parser::read_remaining()
+{
+    if (auto *buffer = dynamic_cast<std::stringbuf *>(m_stream_buffer); buffer != nullptr)
+    {
+        auto const position = buffer->pubseekoff(0, std::ios::cur, std::ios::in);
+        buffer->pubseekoff(0, std::ios::end, std::ios::in);
+
+        return buffer->view().substr(static_cast<std::size_t>(position));
+    }
+
+    std::size_t size = 0;
+    std::streamsize read = 0;
+
+    do
+    {
+        m_buffer.resize(size + static_cast<std::size_t>(s_read_block_size));
+
+        read = m_stream_buffer->sgetn(m_buffer.data() + size, s_read_block_size);
+        size += static_cast<std::size_t>(read);
+    } while (read == s_read_block_size);
+
+    m_buffer.resize(size);
+    return m_buffer;
+}
+
 //==================================================================================================
 Parser::Encoding Parser::parse_byte_order_mark(std::istream &stream) const
 {
@@ -2,7 +2,6 @@
 
 #include "fly/fly.hpp"
 #include "fly/types/json/json.hpp"
-#include "fly/types/numeric/endian.hpp"
 #include "fly/types/string/string.hpp"
 
 #include <bit>
@@ -13,6 +12,7 @@
 #include <optional>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <type_traits>
 
 namespace fly::parser {
@@ -116,6 +116,19 @@ class Parser
      */
     bool eof();
 
+    /**
+     * Extract the remainder of the stream as a contiguous sequence of symbols, for concrete parsers
+     * which scan their input with views rather than symbol-by-symbol. If the stream is backed by a
+     * string, the returned view refers directly to that string. Otherwise, the stream is read in
+     * large blocks into a buffer which is re-used between parses.
+     *
+     * Afterwards, the stream will have reached end-of-file. The current line and column numbers are
+     * not updated.
+     *
+     * @return A view into the remainder of the stream, valid until parsing is complete.
+     */
+    std::string_view read_remaining();
+
     /**
      * @return The current line number in the stream.
      */
@@ -150,7 +163,7 @@ class Parser
     std::optional<fly::Json> parse_stream(std::istream &&stream);
 
     /**
-     * Parse a non-UTF-8 encoded stream and convert the result to a UTF-8 encoded string.
+     * Read a non-UTF-8 encoded stream in bulk and convert the result to a UTF-8 encoded string.
      *
      * @tparam StringType String type which can hold the non-UTF-8 encoded contents.
      * @tparam Endianness The endianness of the non-UTF-8 encoded contents.
@@ -174,6 +187,7 @@ class Parser
     Encoding parse_byte_order_mark(std::istream &stream) const;
 
     std::streambuf *m_stream_buffer {nullptr};
+    std::string m_buffer;
 
     std::uint32_t m_line {0};
     std::uint32_t m_column {0};
@@ -197,39 +211,6 @@ std::optional<fly::Json> Parser::parse_string(StringType const &contents)
     }
 }
 
-//==================================================================================================
-template <typename StringType, std::endian Endianness>
-std::optional<std::string> Parser::ensure_utf8(std::istream &stream) const
-{
-    using char_type = typename StringType::value_type;
-
-    static constexpr std::uint8_t const s_char_size = sizeof(char_type);
-    StringType contents;
-
-    while (stream)
-    {
-        char_type character = 0;
-
-        for (std::uint8_t i = 0; stream && (i < s_char_size); ++i)
-        {
-            std::uint8_t const shift = 8 * (s_char_size - i - 1);
-            character |= static_cast<char_type>(stream.get() & 0xff) << shift;
-        }
-
-        if (stream)
-        {
-            if constexpr (Endianness == std::endian::little)
-            {
-                character = endian_swap(character);
-            }
-
-            contents.push_back(character);
-        }
-    }
-
-    return fly::BasicString<char_type>::template convert<std::string>(contents);
-}
-
 //==================================================================================================
 template <typename SymbolType>
 inline SymbolType Parser::peek()
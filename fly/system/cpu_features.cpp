@@ -0,0 +1,57 @@
+#include "fly/system/cpu_features.hpp"
+
+#if defined(FLY_X86) && defined(FLY_COMPILER_MSVC)
+#    include <intrin.h>
+
+#    include <array>
+#endif
+
+namespace fly::system {
+
+namespace {
+
+    CpuFeatures detect_cpu_features()
+    {
+        CpuFeatures features;
+
+#if defined(FLY_X86)
+#    if defined(FLY_COMPILER_MSVC)
+        std::array<int, 4> info {};
+        __cpuid(info.data(), 0);
+        int const max_leaf = info[0];
+
+        __cpuid(info.data(), 1);
+        features.m_ssse3 = (info[2] & (1 << 9)) != 0;
+        features.m_sse41 = (info[2] & (1 << 19)) != 0;
+        features.m_sse42 = (info[2] & (1 << 20)) != 0;
+
+        // AVX2 also requires the operating system to save the YMM registers on context switches.
+        bool const has_os_avx = ((info[2] & (1 << 27)) != 0) && ((info[2] & (1 << 28)) != 0) &&
+            ((_xgetbv(0) & 0x6) == 0x6);
+
+        if (has_os_avx && (max_leaf >= 7))
+        {
+            __cpuidex(info.data(), 7, 0);
+            features.m_avx2 = (info[1] & (1 << 5)) != 0;
+        }
+#    else
+        features.m_ssse3 = __builtin_cpu_supports("ssse3");
+        features.m_sse41 = __builtin_cpu_supports("sse4.1");
+        features.m_sse42 = __builtin_cpu_supports("sse4.2");
+        features.m_avx2 = __builtin_cpu_supports("avx2");
+#    endif
+#endif
+
+        return features;
+    }
+
+} // namespace
+
+//==================================================================================================
+CpuFeatures const &cpu_features()
+{
+    static CpuFeatures const s_features = detect_cpu_features();
+    return s_features;
+}
+
+} // namespace fly::system
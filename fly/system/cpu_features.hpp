@@ -0,0 +1,47 @@
+#pragma once
+
+#include "fly/fly.hpp"
+
+// Detect x86 CPUs, for which SIMD kernels may be compiled.
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#    define FLY_X86
+#    include <immintrin.h>
+
+#    if defined(__x86_64__) || defined(_M_X64)
+#        define FLY_X86_64
+#    endif
+
+// Define a macro to compile a function for an instruction set extension which the rest of the
+// program is not compiled for. MSVC allows any intrinsic in any function, so requires no attribute.
+#    if defined(FLY_COMPILER_MSVC)
+#        define FLY_TARGET(features)
+#    else
+#        define FLY_TARGET(features) __attribute__((target(features)))
+#    endif
+#endif
+
+namespace fly::system {
+
+/**
+ * The instruction set extensions supported by the running CPU (and enabled by the operating system)
+ * which SIMD kernels may be selected for at runtime. On CPUs other than x86, no extensions are
+ * supported.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+struct CpuFeatures
+{
+    bool m_ssse3 {false};
+    bool m_sse41 {false};
+    bool m_sse42 {false};
+    bool m_avx2 {false};
+};
+
+/**
+ * @return The instruction set extensions supported by the running CPU. The CPU is only queried the
+ *         first time this is invoked.
+ */
+CpuFeatures const &cpu_features();
+
+} // namespace fly::system
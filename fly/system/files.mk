@@ -1,4 +1,5 @@
 SRC_$(d) := \
+    $(d)/cpu_features.cpp \
     $(d)/system.cpp \
     $(d)/system_config.cpp \
     $(d)/system_monitor.cpp \
@@ -6,6 +6,7 @@
 #include <chrono>
 #include <cstdint>
 #include <functional>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -199,6 +200,27 @@ class TaskRunner : public std::enable_shared_from_this<TaskRunner>
         TaskType &&task,
         ReplyType &&reply);
 
+    /**
+     * Post a task for execution, and obtain a future which is satisfied with the result of the
+     * task. The task may be any callable type which is invocable without any arguments. If the task
+     * throws an exception, the exception is stored in the future. If the task could not be posted
+     * for execution, it is instead executed immediately on the calling thread.
+     *
+     * The future must not be waited upon from a task executing on this same task runner. A
+     * sequenced task runner cannot execute the posted task until the waiting task completes, and a
+     * parallel task runner cannot execute it if every worker thread is waiting on such a future.
+     *
+     * @tparam TaskType Callable type of the task.
+     *
+     * @param location The location from which the task was posted (use FROM_HERE).
+     * @param task The task to be executed.
+     *
+     * @return A future which is satisfied with the result of the task.
+     */
+    template <typename TaskType>
+    std::future<std::invoke_result_t<TaskType>>
+    post_task_with_future(TaskLocation &&location, TaskType &&task);
+
     /**
      * Schedule a task to be posted after a delay. The task may be any callable type.
      *
@@ -589,6 +611,33 @@ bool TaskRunner::post_task_with_reply(
             std::forward<ReplyType>(reply)));
 }
 
+//==================================================================================================
+template <typename TaskType>
+std::future<std::invoke_result_t<TaskType>>
+TaskRunner::post_task_with_future(TaskLocation &&location, TaskType &&task)
+{
+    static_assert(std::is_invocable_v<TaskType>, "Task must be invocable without any arguments");
+
+    // Tasks are stored as copyable functions, so the move-only packaged task is shared. Besides
+    // storing any thrown exception, the packaged task breaks its promise if it is destroyed without
+    // being executed, so the future may never be left waiting forever.
+    using PackagedTask = std::packaged_task<std::invoke_result_t<TaskType>()>;
+    auto packaged = std::make_shared<PackagedTask>(std::forward<TaskType>(task));
+
+    auto future = packaged->get_future();
+
+    auto wrapped_task = [packaged]() {
+        (*packaged)();
+    };
+
+    if (!post_task(std::move(location), std::move(wrapped_task)))
+    {
+        (*packaged)();
+    }
+
+    return future;
+}
+
 //==================================================================================================
 template <typename TaskType>
 bool TaskRunner::post_task_with_delay(
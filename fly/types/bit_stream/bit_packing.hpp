@@ -0,0 +1,170 @@
+#pragma once
+
+#include "fly/concepts/concepts.hpp"
+#include "fly/types/bit_stream/bit_span_reader.hpp"
+#include "fly/types/bit_stream/bit_stream_reader.hpp"
+#include "fly/types/bit_stream/bit_stream_writer.hpp"
+#include "fly/types/bit_stream/detail/bit_packing.hpp"
+#include "fly/types/bit_stream/detail/concepts.hpp"
+#include "fly/types/bit_stream/types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+namespace fly {
+
+/**
+ * The number of values in each block of a bit-packed array.
+ *
+ * With frame-of-reference packing, an array is split into blocks of this many values (the last
+ * block may be smaller). Each block is packed as:
+ *
+ *     | Bit width (7 bits) | Reference (digits of the value type) | Offsets (width bits each) |
+ *
+ * The reference is the block's minimum value, and each value is packed as its offset from that
+ * reference, using the fewest number of bits which hold the block's largest offset. Blocks whose
+ * values are all equal are packed without any offsets.
+ *
+ * The number of values in the array is not packed, so arrays must be unpacked into the same number
+ * of values as were packed.
+ */
+inline constexpr std::size_t s_bit_packing_block_size = detail::s_bit_packing_block_size;
+
+/**
+ * Concept that is satisfied if the given type is a stream which bit-packed arrays may be unpacked
+ * from.
+ */
+template <typename T>
+concept BitPackingReader = fly::SameAsAny<T, BitStreamReader, BitSpanReader>;
+
+/**
+ * Pack an array of values with frame-of-reference packing.
+ *
+ * @tparam DataType The type of the values to pack.
+ *
+ * @param stream The stream to write the packed values onto.
+ * @param values The values to pack.
+ */
+template <detail::BitStreamInteger DataType>
+void pack_frame_of_reference(BitStreamWriter &stream, std::span<DataType> values)
+{
+    using value_type = std::remove_const_t<DataType>;
+
+    for (std::size_t i = 0; i < values.size(); i += s_bit_packing_block_size)
+    {
+        std::size_t const size = std::min(s_bit_packing_block_size, values.size() - i);
+        detail::pack_block<value_type>(stream, values.subspan(i, size));
+    }
+}
+
+/**
+ * Unpack an array of values which were packed with frame-of-reference packing.
+ *
+ * Unpacking from a BitSpanReader extracts each block's offsets with a single bulk read, which
+ * unpacks 32-bit values several at a time with SIMD instructions where supported.
+ *
+ * @tparam Reader The type of the stream to read the packed values from.
+ * @tparam DataType The type of the values to unpack.
+ *
+ * @param stream The stream to read the packed values from.
+ * @param values The locations to store the unpacked values.
+ *
+ * @return True if the values were successfully unpacked.
+ */
+template <BitPackingReader Reader, detail::BitStreamInteger DataType>
+bool unpack_frame_of_reference(Reader &stream, std::span<DataType> values)
+{
+    for (std::size_t i = 0; i < values.size(); i += s_bit_packing_block_size)
+    {
+        std::size_t const size = std::min(s_bit_packing_block_size, values.size() - i);
+
+        if (!detail::unpack_block(stream, values.subspan(i, size)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Pack an array of values with delta packing. The first value is packed in full, and each
+ * subsequent value is packed as its difference from the value before it, using frame-of-reference
+ * packing.
+ *
+ * Differences are computed modulo the range of the value type, so any array may be delta packed.
+ * But only arrays which are sorted (or nearly so) are packed more compactly than they would be with
+ * frame-of-reference packing alone.
+ *
+ * @tparam DataType The type of the values to pack.
+ *
+ * @param stream The stream to write the packed values onto.
+ * @param values The values to pack.
+ */
+template <detail::BitStreamInteger DataType>
+void pack_delta(BitStreamWriter &stream, std::span<DataType> values)
+{
+    using value_type = std::remove_const_t<DataType>;
+
+    if (values.empty())
+    {
+        return;
+    }
+
+    stream.write_bits(static_cast<value_type>(values[0]), std::numeric_limits<value_type>::digits);
+
+    std::array<value_type, s_bit_packing_block_size> deltas;
+
+    for (std::size_t i = 1; i < values.size(); i += s_bit_packing_block_size)
+    {
+        std::size_t const size = std::min(s_bit_packing_block_size, values.size() - i);
+
+        for (std::size_t j = 0; j < size; ++j)
+        {
+            deltas[j] = static_cast<value_type>(values[i + j] - values[i + j - 1]);
+        }
+
+        detail::pack_block<value_type>(stream, std::span(deltas).first(size));
+    }
+}
+
+/**
+ * Unpack an array of values which were packed with delta packing.
+ *
+ * @tparam Reader The type of the stream to read the packed values from.
+ * @tparam DataType The type of the values to unpack.
+ *
+ * @param stream The stream to read the packed values from.
+ * @param values The locations to store the unpacked values.
+ *
+ * @return True if the values were successfully unpacked.
+ */
+template <BitPackingReader Reader, detail::BitStreamInteger DataType>
+bool unpack_delta(Reader &stream, std::span<DataType> values)
+{
+    static constexpr auto s_digits = static_cast<byte_type>(std::numeric_limits<DataType>::digits);
+
+    if (values.empty())
+    {
+        return true;
+    }
+
+    if ((stream.read_bits(values[0], s_digits) != s_digits) ||
+        !unpack_frame_of_reference(stream, values.subspan(1)))
+    {
+        return false;
+    }
+
+    for (std::size_t i = 1; i < values.size(); ++i)
+    {
+        values[i] = static_cast<DataType>(values[i] + values[i - 1]);
+    }
+
+    return true;
+}
+
+} // namespace fly
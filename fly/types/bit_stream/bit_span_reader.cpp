@@ -0,0 +1,74 @@
+#include "fly/types/bit_stream/bit_span_reader.hpp"
+
+#include "fly/types/bit_stream/detail/constants.hpp"
+
+namespace fly {
+
+//==================================================================================================
+BitSpanReader::BitSpanReader(std::span<std::byte const> data) noexcept
+{
+    if (data.empty())
+    {
+        return;
+    }
+
+    m_header = static_cast<byte_type>(data.front());
+
+    byte_type const magic = (m_header >> detail::s_magic_shift) & detail::s_magic_mask;
+    byte_type const remainder = (m_header >> detail::s_remainder_shift) & detail::s_remainder_mask;
+
+    // A span with only a header has no bits from which remainder bits could have been zero-filled.
+    if ((magic != detail::s_magic) || ((data.size() == 1) && (remainder != 0)))
+    {
+        return;
+    }
+
+    m_valid = true;
+
+    m_data = data.subspan(detail::s_byte_type_size);
+    m_size = (m_data.size() * detail::s_bits_per_byte) - remainder;
+
+    if (m_data.size() >= detail::s_buffer_type_size)
+    {
+        m_unbounded_end =
+            (m_data.size() - detail::s_buffer_type_size + 1) * detail::s_bits_per_byte;
+    }
+}
+
+//==================================================================================================
+bool BitSpanReader::read_word(word_type &word)
+{
+    return read_bits(word, detail::s_bits_per_word) == detail::s_bits_per_word;
+}
+
+//==================================================================================================
+bool BitSpanReader::read_byte(byte_type &byte)
+{
+    return read_bits(byte, detail::s_bits_per_byte) == detail::s_bits_per_byte;
+}
+
+//==================================================================================================
+bool BitSpanReader::is_valid() const
+{
+    return m_valid;
+}
+
+//==================================================================================================
+bool BitSpanReader::fully_consumed() const
+{
+    return m_position >= m_size;
+}
+
+//==================================================================================================
+std::size_t BitSpanReader::remaining_bits() const
+{
+    return m_size - m_position;
+}
+
+//==================================================================================================
+byte_type BitSpanReader::header() const
+{
+    return m_header;
+}
+
+} // namespace fly
@@ -0,0 +1,296 @@
+#pragma once
+
+#include "fly/types/bit_stream/detail/bit_unpacking.hpp"
+#include "fly/types/bit_stream/detail/concepts.hpp"
+#include "fly/types/bit_stream/types.hpp"
+#include "fly/types/numeric/endian.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+namespace fly {
+
+/**
+ * Reader for binary data written by a BitStreamWriter which is already entirely in memory.
+ *
+ * Rather than maintaining a byte buffer which must be refilled from a stream (and handling partial
+ * fills as the end of the stream is approached), bits are extracted directly from the span. Every
+ * read performs an unaligned load of the 8 bytes containing the requested bits, swaps them to big
+ * endian, and shifts the requested bits into place. Only loads within the last 8 bytes of the span
+ * are copied into a zero-filled buffer first, so that the span is never read past its end.
+ *
+ * Fields of up to 57 bits are extracted with a single load; wider fields are extracted with two.
+ * For decoding packed arrays of fixed-width fields, the bulk read_bits overload extracts any number
+ * of fields in a single loop. Arrays of 32-bit fields of up to 25 bits are instead unpacked several
+ * fields at a time with SIMD instructions, where supported by the running CPU.
+ *
+ * The span must outlive the reader.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+class BitSpanReader
+{
+public:
+    /**
+     * Constructor. Decode the header byte from the span. If the header byte is invalid, no bits may
+     * be read from the span.
+     *
+     * @param data The span to read binary data from.
+     */
+    explicit BitSpanReader(std::span<std::byte const> data) noexcept;
+
+    /**
+     * Read a multibyte word from the span.
+     *
+     * @param word The location to store the read word.
+     *
+     * @return True if the word was successfully read.
+     */
+    bool read_word(word_type &word);
+
+    /**
+     * Read a full byte from the span.
+     *
+     * @param byte The location to store the read byte.
+     *
+     * @return True if the byte was successfully read.
+     */
+    bool read_byte(byte_type &byte);
+
+    /**
+     * Read a number of bits from the span. There is no guarantee that the requested number of bits
+     * will actually be read, as there may be less than that number available. If any bits were
+     * read, the least-significant bits in the provided data type will be filled, starting from the
+     * position pointed to by the requested number of bits.
+     *
+     * @tparam DataType The data type of the location to store the read bits.
+     *
+     * @param bits The location to store the read bits.
+     * @param size The number of bits to read.
+     *
+     * @return The number of bits successfully read.
+     */
+    template <detail::BitStreamInteger DataType>
+    byte_type read_bits(DataType &bits, byte_type size);
+
+    /**
+     * Read a number of fixed-width fields from the span. Fields are only read if all of their bits
+     * are available, and the most-significant bits of each read value are zero-filled.
+     *
+     * @tparam DataType The data type of the locations to store the read fields.
+     *
+     * @param values The locations to store the read fields.
+     * @param size The number of bits in each field.
+     *
+     * @return The number of fields successfully read.
+     */
+    template <detail::BitStreamInteger DataType>
+    std::size_t read_bits(std::span<DataType> values, byte_type size);
+
+    /**
+     * Read a number of bits from the span without discarding those bits. There is no guarantee that
+     * the requested number of bits will actually be peeked, as there may be less than that number
+     * available. If any bits were peeked, the least-significant bits in the provided data type will
+     * be filled, starting from the position pointed to by the requested number of bits.
+     *
+     * @tparam DataType The data type of the location to store the peeked bits.
+     *
+     * @param bits The location to store the peeked bits.
+     * @param size The number of bits to peek.
+     *
+     * @return The number of bits successfully peeked.
+     */
+    template <detail::BitStreamInteger DataType>
+    byte_type peek_bits(DataType &bits, byte_type size) const;
+
+    /**
+     * Discard a number of bits from the span. Should only be used after a successful call to
+     * peek_bits.
+     *
+     * @param size The number of bits to discard.
+     */
+    void discard_bits(byte_type size);
+
+    /**
+     * @return True if the header byte decoded from the span was valid. A header which indicates
+     *         remainder bits is invalid if no bytes follow it.
+     */
+    bool is_valid() const;
+
+    /**
+     * @return True if every bit in the span has been read.
+     */
+    bool fully_consumed() const;
+
+    /**
+     * @return The number of bits that remain to be read from the span.
+     */
+    std::size_t remaining_bits() const;
+
+    /**
+     * @return The header byte decoded from the span.
+     */
+    byte_type header() const;
+
+private:
+    /**
+     * Extract a number of bits starting at a bit position in the span. Bits beyond the end of the
+     * span are extracted as zeroes.
+     *
+     * @tparam Bounded Whether the load of the bits must be bounded to the end of the span.
+     *
+     * @param position The bit position of the first bit to extract.
+     * @param size The number of bits to extract.
+     *
+     * @return The extracted bits.
+     */
+    template <bool Bounded>
+    buffer_type extract(std::size_t position, byte_type size) const;
+
+    /**
+     * Load the 8 bytes starting at a byte position in the span, in big endian byte order. Bytes
+     * beyond the end of the span are loaded as zeroes.
+     *
+     * @tparam Bounded Whether the load must be bounded to the end of the span.
+     *
+     * @param position The byte position of the first byte to load.
+     *
+     * @return The loaded bytes.
+     */
+    template <bool Bounded>
+    buffer_type load(std::size_t position) const;
+
+    // The number of bits which may always be extracted with a single load, regardless of the bit
+    // offset of the load within its first byte.
+    static constexpr byte_type s_max_load_bits = std::numeric_limits<buffer_type>::digits - 7;
+
+    std::span<std::byte const> m_data;
+
+    std::size_t m_position {0};
+    std::size_t m_size {0};
+
+    // Loads of bits which end before this bit position never reach the end of the span.
+    std::size_t m_unbounded_end {0};
+
+    byte_type m_header {0};
+    bool m_valid {false};
+};
+
+//==================================================================================================
+template <detail::BitStreamInteger DataType>
+byte_type BitSpanReader::read_bits(DataType &bits, byte_type size)
+{
+    byte_type const bits_read = peek_bits(bits, size);
+    discard_bits(bits_read);
+
+    return bits_read;
+}
+
+//==================================================================================================
+template <detail::BitStreamInteger DataType>
+std::size_t BitSpanReader::read_bits(std::span<DataType> values, byte_type size)
+{
+    size = std::min(size, static_cast<byte_type>(std::numeric_limits<DataType>::digits));
+
+    if (size == 0)
+    {
+        std::fill(values.begin(), values.end(), DataType(0));
+        return values.size();
+    }
+
+    std::size_t const count = std::min(values.size(), remaining_bits() / size);
+
+    std::size_t i = 0;
+
+    if constexpr (std::is_same_v<DataType, std::uint32_t>)
+    {
+        i = detail::unpack_bits(m_data, m_position, values.first(count), size);
+        m_position += i * size;
+    }
+
+    for (; (i < count) && ((m_position + size) <= m_unbounded_end); ++i, m_position += size)
+    {
+        values[i] = static_cast<DataType>(extract<false>(m_position, size));
+    }
+
+    for (; i < count; ++i, m_position += size)
+    {
+        values[i] = static_cast<DataType>(extract<true>(m_position, size));
+    }
+
+    return count;
+}
+
+//==================================================================================================
+template <detail::BitStreamInteger DataType>
+byte_type BitSpanReader::peek_bits(DataType &bits, byte_type size) const
+{
+    size = std::min(size, static_cast<byte_type>(std::numeric_limits<DataType>::digits));
+
+    auto const peeked = static_cast<byte_type>(std::min<std::size_t>(size, remaining_bits()));
+    byte_type const lshift = size - peeked;
+
+    // Bit-shifting by the size of the value being shifted is undefined behavior, which may occur if
+    // no bits were peeked. The shift is broken into two halves to avoid branching on that case.
+    bits = static_cast<DataType>(extract<true>(m_position, peeked));
+    bits = static_cast<DataType>((bits << (lshift >> 1)) << (lshift - (lshift >> 1)));
+
+    return peeked;
+}
+
+//==================================================================================================
+inline void BitSpanReader::discard_bits(byte_type size)
+{
+    m_position += size;
+}
+
+//==================================================================================================
+template <bool Bounded>
+inline buffer_type BitSpanReader::extract(std::size_t position, byte_type size) const
+{
+    if (size > s_max_load_bits)
+    {
+        byte_type const size_low = size / 2;
+        byte_type const size_high = size - size_low;
+
+        buffer_type const high = extract<Bounded>(position, size_high);
+        buffer_type const low = extract<Bounded>(position + size_high, size_low);
+
+        return (high << size_low) | low;
+    }
+
+    buffer_type const buffer = load<Bounded>(position / 8) << (position % 8);
+
+    // As above, the right shift is split to avoid shifting by 64 bits if no bits are extracted.
+    return (buffer >> 1) >> (std::numeric_limits<buffer_type>::digits - 1 - size);
+}
+
+//==================================================================================================
+template <bool Bounded>
+inline buffer_type BitSpanReader::load(std::size_t position) const
+{
+    buffer_type buffer = 0;
+
+    if (Bounded && ((position + sizeof(buffer)) > m_data.size()))
+    {
+        if (position < m_data.size())
+        {
+            std::memcpy(&buffer, m_data.data() + position, m_data.size() - position);
+        }
+    }
+    else
+    {
+        std::memcpy(&buffer, m_data.data() + position, sizeof(buffer));
+    }
+
+    return endian_swap_if_non_native<std::endian::big>(buffer);
+}
+
+} // namespace fly
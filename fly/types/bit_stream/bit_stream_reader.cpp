@@ -3,6 +3,8 @@
 #include "fly/types/bit_stream/detail/constants.hpp"
 #include "fly/types/numeric/literals.hpp"
 
+#include <cstring>
+
 namespace fly {
 
 //==================================================================================================
@@ -10,21 +12,17 @@ BitStreamReader::BitStreamReader(std::istream &stream) noexcept :
     BitStream(stream.rdbuf(), 0),
     m_stream(stream)
 {
-    byte_type magic = 0;
-
-    // Cannot use read_byte because the remainder bits are not known yet.
-    byte_type const bytes_read = fill(m_header, detail::s_byte_type_size);
-
-    if (bytes_read == 1_u8)
-    {
-        magic = (m_header >> detail::s_magic_shift) & detail::s_magic_mask;
-        m_remainder = (m_header >> detail::s_remainder_shift) & detail::s_remainder_mask;
-    }
+    read_header();
+}
 
-    if (magic != detail::s_magic)
-    {
-        m_stream.setstate(std::ios::failbit);
-    }
+//==================================================================================================
+BitStreamReader::BitStreamReader(std::istream &stream, std::size_t block_size) noexcept :
+    BitStream(stream.rdbuf(), 0),
+    m_stream(stream),
+    m_block(std::make_unique<byte_type[]>(block_size)),
+    m_block_capacity(block_size)
+{
+    read_header();
 }
 
 //==================================================================================================
@@ -42,12 +40,7 @@ bool BitStreamReader::read_byte(byte_type &byte)
 //==================================================================================================
 bool BitStreamReader::fully_consumed() const
 {
-    if (m_position == 0)
-    {
-        return m_stream_buffer->sgetc() == EOF;
-    }
-
-    return false;
+    return (m_position == 0) && at_end();
 }
 
 //==================================================================================================
@@ -56,6 +49,26 @@ byte_type BitStreamReader::header() const
     return m_header;
 }
 
+//==================================================================================================
+void BitStreamReader::read_header()
+{
+    byte_type magic = 0;
+
+    // Cannot use read_byte because the remainder bits are not known yet.
+    byte_type const bytes_read = fill(m_header, detail::s_byte_type_size);
+
+    if (bytes_read == 1_u8)
+    {
+        magic = (m_header >> detail::s_magic_shift) & detail::s_magic_mask;
+        m_remainder = (m_header >> detail::s_remainder_shift) & detail::s_remainder_mask;
+    }
+
+    if (magic != detail::s_magic)
+    {
+        m_stream.setstate(std::ios::failbit);
+    }
+}
+
 //==================================================================================================
 void BitStreamReader::refill_buffer()
 {
@@ -63,27 +76,71 @@ void BitStreamReader::refill_buffer()
     buffer_type buffer = 0;
 
     byte_type const bytes_read = fill(buffer, bits_to_fill / detail::s_bits_per_byte);
+    byte_type const bits_read = bytes_read * detail::s_bits_per_byte;
+    m_position += bits_read;
+
+    // It is undefined behavior to bit-shift by the size of the value being shifted, i.e. when
+    // bits_read is 0 or detail::s_most_significant_bit_position. Rather than branching on those
+    // cases, each shift is broken into two halves which are both less than the size of the value.
+    // A refill which reads nothing then leaves the byte buffer unchanged.
+    byte_type const lshift = bits_read;
+    byte_type const rshift = detail::s_most_significant_bit_position - bits_read;
+
+    m_buffer = (m_buffer << (lshift >> 1)) << (lshift - (lshift >> 1));
+    m_buffer |= (buffer >> (rshift >> 1)) >> (rshift - (rshift >> 1));
 
-    if (bytes_read > 0)
+    if ((bytes_read > 0) && at_end())
     {
-        byte_type const bits_read = bytes_read * detail::s_bits_per_byte;
-        m_position += bits_read;
+        // At end-of-file, discard any encoded zero-filled bits.
+        m_position -= m_remainder;
+        m_buffer >>= m_remainder;
+    }
+}
 
-        // It is undefined behavior to bit-shift by the size of the value being shifted, i.e. when
-        // bits_read == detail::s_most_significant_bit_position. Because bits_read is at least 1
-        // here, the left-shift can be broken into two operations in order to avoid that behavior.
-        m_buffer <<= bits_read - 1;
-        m_buffer <<= 1;
+//==================================================================================================
+std::size_t BitStreamReader::read(void *data, std::size_t bytes)
+{
+    if (!m_block)
+    {
+        return static_cast<std::size_t>(m_stream_buffer->sgetn(
+            static_cast<std::ios::char_type *>(data),
+            static_cast<std::streamsize>(bytes)));
+    }
 
-        m_buffer |= buffer >> (detail::s_most_significant_bit_position - bits_read);
+    auto *output = static_cast<byte_type *>(data);
+    std::size_t bytes_read = 0;
 
-        if (m_stream_buffer->sgetc() == EOF)
+    while (bytes_read < bytes)
+    {
+        if (m_block_position == m_block_size)
         {
-            // At end-of-file, discard any encoded zero-filled bits.
-            m_position -= m_remainder;
-            m_buffer >>= m_remainder;
+            m_block_size = static_cast<std::size_t>(m_stream_buffer->sgetn(
+                reinterpret_cast<std::ios::char_type *>(m_block.get()),
+                static_cast<std::streamsize>(m_block_capacity)));
+            m_block_position = 0;
+
+            if (m_block_size == 0)
+            {
+                break;
+            }
         }
+
+        std::size_t const size = std::min(bytes - bytes_read, m_block_size - m_block_position);
+        std::memcpy(output + bytes_read, m_block.get() + m_block_position, size);
+
+        m_block_position += size;
+        bytes_read += size;
     }
+
+    return bytes_read;
+}
+
+//==================================================================================================
+bool BitStreamReader::at_end() const
+{
+    // The block is only refilled once it has been entirely read, so the stream is only checked for
+    // end-of-file once per block.
+    return (m_block_position == m_block_size) && (m_stream_buffer->sgetc() == EOF);
 }
 
 } // namespace fly
@@ -7,8 +7,10 @@
 
 #include <algorithm>
 #include <bit>
+#include <cstddef>
 #include <cstdint>
 #include <istream>
+#include <memory>
 
 namespace fly {
 
@@ -20,6 +22,12 @@ namespace fly {
  * buffer is stored in-memory until it has been entirely consumed by the caller, at which point it
  * is refilled.
  *
+ * The reader may optionally be backed by a larger, contiguous block of bytes. In that mode, the
+ * block is filled from the stream with a single call, and the byte buffer is refilled from the
+ * block. This avoids the cost of a virtual stream buffer call for every 8 bytes read, but reads
+ * ahead of the bits that have been consumed by up to the size of the block. Thus, this mode should
+ * only be used if the reader has exclusive use of the stream until the reader is destroyed.
+ *
  * @author Timothy Flynn (trflynn89@pm.me)
  * @version July 7, 2019
  */
@@ -34,6 +42,15 @@ class BitStreamReader : public detail::BitStream
      */
     explicit BitStreamReader(std::istream &stream) noexcept;
 
+    /**
+     * Constructor. Decode the header byte from the stream, reading bytes from the stream into a
+     * block of bytes as needed. If the header byte is invalid, the stream's fail bit is set.
+     *
+     * @param stream The stream to read binary data from.
+     * @param block_size The size of the block of bytes (in bytes).
+     */
+    BitStreamReader(std::istream &stream, std::size_t block_size) noexcept;
+
     /**
      * Read a multibyte word from the byte buffer.
      *
@@ -119,11 +136,34 @@ class BitStreamReader : public detail::BitStream
     byte_type header() const;
 
 private:
+    /**
+     * Decode the header byte from the stream.
+     */
+    void read_header();
+
     /**
      * Read from the stream to fill the byte buffer.
      */
     void refill_buffer();
 
+    /**
+     * Read a sequence of bytes from the block of bytes, if the reader is backed by one, or
+     * otherwise from the stream. The block is refilled from the stream as needed.
+     *
+     * @param data The location to store the read bytes.
+     * @param bytes The number of bytes to read.
+     *
+     * @return The number of bytes actually read.
+     */
+    std::size_t read(void *data, std::size_t bytes);
+
+    /**
+     * Check if the block of bytes has been entirely read and the stream has reached end-of-file.
+     *
+     * @return True if there are no more bytes to read.
+     */
+    bool at_end() const;
+
     /**
      * Read from the stream to fill a byte buffer.
      *
@@ -139,6 +179,11 @@ class BitStreamReader : public detail::BitStream
 
     std::istream &m_stream;
 
+    std::unique_ptr<byte_type[]> m_block;
+    std::size_t m_block_capacity {0};
+    std::size_t m_block_size {0};
+    std::size_t m_block_position {0};
+
     byte_type m_header {0};
     byte_type m_remainder {0};
 };
@@ -238,9 +283,7 @@ byte_type BitStreamReader::fill(DataType &buffer, byte_type bytes)
 {
     if (m_stream)
     {
-        std::streamsize const bytes_read = m_stream_buffer->sgetn(
-            reinterpret_cast<std::ios::char_type *>(&buffer),
-            static_cast<std::streamsize>(bytes));
+        std::size_t const bytes_read = read(&buffer, bytes);
 
         buffer = endian_swap_if_non_native<std::endian::big>(buffer);
         return static_cast<byte_type>(bytes_read);
@@ -13,6 +13,16 @@ BitStreamWriter::BitStreamWriter(std::ostream &stream) noexcept :
     flush_header(0_u8);
 }
 
+//==================================================================================================
+BitStreamWriter::BitStreamWriter(std::ostream &stream, std::size_t block_size) noexcept :
+    BitStream(stream.rdbuf(), detail::s_most_significant_bit_position),
+    m_stream(stream),
+    m_block(std::make_unique<byte_type[]>(block_size)),
+    m_block_size(block_size)
+{
+    flush_header(0_u8);
+}
+
 //==================================================================================================
 void BitStreamWriter::write_word(word_type word)
 {
@@ -29,17 +39,27 @@ void BitStreamWriter::write_byte(byte_type byte)
 bool BitStreamWriter::finish()
 {
     byte_type const bits_in_buffer = detail::s_most_significant_bit_position - m_position;
+    byte_type remainder = 0;
 
     if (bits_in_buffer > 0)
     {
         byte_type const bits_to_flush = bits_in_buffer + (m_position % detail::s_bits_per_byte);
+        remainder = bits_to_flush - bits_in_buffer;
 
         flush(m_buffer, bits_to_flush / detail::s_bits_per_byte);
         m_position = detail::s_most_significant_bit_position;
         m_buffer = 0;
+    }
+
+    flush_block();
 
-        byte_type const remainder = (bits_to_flush - bits_in_buffer);
+    // The header was written without any zero-filled bits on construction, so it only needs to be
+    // rewritten if the final byte holds zero-filled bits. Thus, streams which end on a byte
+    // boundary never need to be repositioned.
+    if (remainder > 0)
+    {
         flush_header(remainder);
+        flush_block();
     }
 
     return m_stream.good();
@@ -64,4 +84,30 @@ void BitStreamWriter::flush_buffer()
     m_buffer = 0;
 }
 
+//==================================================================================================
+void BitStreamWriter::write(void const *data, std::size_t bytes)
+{
+    if (m_stream)
+    {
+        std::streamsize const bytes_written = m_stream_buffer->sputn(
+            static_cast<std::ios::char_type const *>(data),
+            static_cast<std::streamsize>(bytes));
+
+        if (bytes_written != static_cast<std::streamsize>(bytes))
+        {
+            m_stream.setstate(std::ios::badbit);
+        }
+    }
+}
+
+//==================================================================================================
+void BitStreamWriter::flush_block()
+{
+    if (m_block_position > 0)
+    {
+        write(m_block.get(), m_block_position);
+        m_block_position = 0;
+    }
+}
+
 } // namespace fly
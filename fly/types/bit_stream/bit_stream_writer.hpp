@@ -6,6 +6,9 @@
 #include "fly/types/numeric/endian.hpp"
 
 #include <bit>
+#include <cstddef>
+#include <cstring>
+#include <memory>
 #include <ostream>
 
 namespace fly {
@@ -17,6 +20,12 @@ namespace fly {
  * buffer is flushed to the stream. When done writing, callers should invoke the finish() method to
  * flush the BitStream header and any bytes remaining in the buffer.
  *
+ * The writer may optionally be backed by a larger, contiguous block of bytes. In that mode, full
+ * byte buffers are copied into the block rather than written through the stream's buffer, and the
+ * block is written to the stream with a single call once it is full (or once the writer is
+ * finished). This avoids the cost of a virtual stream buffer call for every 8 bytes written, but
+ * delays writing to the stream until a full block is available.
+ *
  * @author Timothy Flynn (trflynn89@pm.me)
  * @version July 7, 2019
  */
@@ -30,6 +39,16 @@ class BitStreamWriter : public detail::BitStream
      */
     explicit BitStreamWriter(std::ostream &stream) noexcept;
 
+    /**
+     * Constructor. Write the header byte into a block of bytes which is written onto the stream
+     * once it is full.
+     *
+     * @param stream The stream to write binary data into.
+     * @param block_size The size of the block of bytes (in bytes). Must be at least the size of
+     *        buffer_type, and should be a multiple of it.
+     */
+    BitStreamWriter(std::ostream &stream, std::size_t block_size) noexcept;
+
     /**
      * Write a multibyte word to the byte buffer.
      *
@@ -63,7 +82,8 @@ class BitStreamWriter : public detail::BitStream
     void write_bits(DataType bits, byte_type size);
 
     /**
-     * If needed, zero-fill the byte buffer, flush it to the stream, and update the header byte.
+     * If needed, zero-fill the byte buffer, flush it and the block of bytes to the stream, and
+     * update the header byte.
      *
      * @return True if the stream remains in a good state.
      */
@@ -83,7 +103,8 @@ class BitStreamWriter : public detail::BitStream
     void flush_buffer();
 
     /**
-     * Flush a byte buffer to the stream.
+     * Flush a byte buffer to the block of bytes, if the writer is backed by one, or otherwise to
+     * the stream.
      *
      * @tparam DataType The type of the byte buffer to flush.
      *
@@ -93,7 +114,24 @@ class BitStreamWriter : public detail::BitStream
     template <detail::BitStreamInteger DataType>
     void flush(DataType const &buffer, byte_type bytes);
 
+    /**
+     * Write a sequence of bytes to the stream.
+     *
+     * @param data The bytes to write.
+     * @param bytes The number of bytes to write.
+     */
+    void write(void const *data, std::size_t bytes);
+
+    /**
+     * Write the contents of the block of bytes to the stream and empty the block.
+     */
+    void flush_block();
+
     std::ostream &m_stream;
+
+    std::unique_ptr<byte_type[]> m_block;
+    std::size_t m_block_size {0};
+    std::size_t m_block_position {0};
 };
 
 //==================================================================================================
@@ -107,8 +145,9 @@ void BitStreamWriter::write_bits(DataType bits, byte_type size)
         byte_type const rshift = size - m_position;
 
         // Fill the remainder of the byte buffer with as many bits as are available, and flush it
-        // onto the stream.
-        m_buffer |= static_cast<buffer_type>(bits) >> rshift;
+        // onto the stream. The shift is split in two halves, as a full byte buffer would otherwise
+        // be shifted by its own size (undefined behavior) when the bits are buffer_type.
+        m_buffer |= (static_cast<buffer_type>(bits) >> (rshift >> 1)) >> (rshift - (rshift >> 1));
         flush_buffer();
 
         // Then update the input bits to retain only those bits that have not been written yet.
@@ -126,13 +165,21 @@ void BitStreamWriter::write_bits(DataType bits, byte_type size)
 template <detail::BitStreamInteger DataType>
 void BitStreamWriter::flush(DataType const &buffer, byte_type bytes)
 {
-    if (m_stream)
+    DataType const data = endian_swap_if_non_native<std::endian::big>(buffer);
+
+    if (m_block)
     {
-        DataType const data = endian_swap_if_non_native<std::endian::big>(buffer);
+        if ((m_block_size - m_block_position) < bytes)
+        {
+            flush_block();
+        }
 
-        m_stream_buffer->sputn(
-            reinterpret_cast<std::ios::char_type const *>(&data),
-            static_cast<std::streamsize>(bytes));
+        std::memcpy(m_block.get() + m_block_position, &data, bytes);
+        m_block_position += bytes;
+    }
+    else
+    {
+        write(&data, bytes);
     }
 }
 
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "fly/concepts/concepts.hpp"
+#include "fly/types/bit_stream/bit_span_reader.hpp"
+#include "fly/types/bit_stream/bit_stream_writer.hpp"
+#include "fly/types/bit_stream/types.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <span>
+
+namespace fly::detail {
+
+inline constexpr std::size_t s_bit_packing_block_size = 128;
+
+// The number of bits used to pack each block's bit width, which may be up to 64.
+inline constexpr byte_type s_bit_packing_width_bits = 7;
+
+/**
+ * Pack a single block of values with frame-of-reference packing.
+ *
+ * @tparam DataType The type of the values to pack.
+ *
+ * @param stream The stream to write the packed values onto.
+ * @param block The values to pack.
+ */
+template <typename DataType>
+void pack_block(BitStreamWriter &stream, std::span<DataType const> block)
+{
+    auto const [min, max] = std::minmax_element(block.begin(), block.end());
+
+    DataType const reference = *min;
+    auto const width = static_cast<byte_type>(std::bit_width<DataType>(*max - reference));
+
+    stream.write_bits(width, s_bit_packing_width_bits);
+    stream.write_bits(reference, std::numeric_limits<DataType>::digits);
+
+    if (width > 0)
+    {
+        for (DataType const value : block)
+        {
+            stream.write_bits(static_cast<DataType>(value - reference), width);
+        }
+    }
+}
+
+/**
+ * Unpack a single block of values which were packed with frame-of-reference packing. The offsets
+ * are read from a BitSpanReader with a single bulk read, and from other streams one at a time.
+ *
+ * @tparam Reader The type of the stream to read the packed values from.
+ * @tparam DataType The type of the values to unpack.
+ *
+ * @param stream The stream to read the packed values from.
+ * @param block The locations to store the unpacked values.
+ *
+ * @return True if the values were successfully unpacked.
+ */
+template <typename Reader, typename DataType>
+bool unpack_block(Reader &stream, std::span<DataType> block)
+{
+    static constexpr auto s_digits = static_cast<byte_type>(std::numeric_limits<DataType>::digits);
+
+    byte_type width = 0;
+    DataType reference = 0;
+
+    if ((stream.read_bits(width, s_bit_packing_width_bits) != s_bit_packing_width_bits) ||
+        (width > s_digits) || (stream.read_bits(reference, s_digits) != s_digits))
+    {
+        return false;
+    }
+
+    if (width == 0)
+    {
+        std::fill(block.begin(), block.end(), reference);
+        return true;
+    }
+
+    if constexpr (fly::SameAs<Reader, BitSpanReader>)
+    {
+        if (stream.read_bits(block, width) != block.size())
+        {
+            return false;
+        }
+    }
+    else
+    {
+        for (DataType &value : block)
+        {
+            if (stream.read_bits(value, width) != width)
+            {
+                return false;
+            }
+        }
+    }
+
+    for (DataType &value : block)
+    {
+        value = static_cast<DataType>(value + reference);
+    }
+
+    return true;
+}
+
+} // namespace fly::detail
@@ -0,0 +1,205 @@
+#include "fly/types/bit_stream/detail/bit_unpacking.hpp"
+
+#include "fly/system/cpu_features.hpp"
+
+#include <array>
+
+namespace fly::detail {
+
+namespace {
+
+    using unpack_kernel = std::size_t (*)(
+        std::byte const *,
+        std::size_t,
+        std::size_t,
+        std::uint32_t *,
+        std::size_t,
+        byte_type);
+
+    /**
+     * The shuffles and shifts to unpack 8 consecutive fields of a given width, the first of which
+     * begins at a given bit offset within its first byte. The first 4 fields are unpacked from a
+     * load beginning at the first field's byte, and the last 4 fields are unpacked from a load
+     * beginning at the fifth field's byte.
+     */
+    struct UnpackPattern
+    {
+        alignas(32) std::array<std::uint8_t, 32> m_shuffle {};
+        alignas(32) std::array<std::uint32_t, 8> m_shifts {};
+        alignas(16) std::array<std::uint32_t, 4> m_multipliers {};
+        std::size_t m_high_offset {0};
+    };
+
+    using UnpackPatterns = std::array<std::array<UnpackPattern, 8>, s_max_simd_unpack_bits>;
+
+    constexpr UnpackPatterns create_unpack_patterns()
+    {
+        UnpackPatterns patterns {};
+
+        for (std::size_t size = 1; size <= s_max_simd_unpack_bits; ++size)
+        {
+            for (std::size_t offset = 0; offset < 8; ++offset)
+            {
+                UnpackPattern &pattern = patterns[size - 1][offset];
+                pattern.m_high_offset = (offset + (4 * size)) / 8;
+
+                for (std::size_t lane = 0; lane < 8; ++lane)
+                {
+                    std::size_t position = offset + (lane * size);
+
+                    if (lane >= 4)
+                    {
+                        position -= pattern.m_high_offset * 8;
+                    }
+
+                    auto const byte = static_cast<std::uint8_t>(position / 8);
+                    auto const shift = static_cast<std::uint32_t>(position % 8);
+
+                    // Shuffle the 4 bytes holding the field into the lane in big endian order.
+                    for (std::size_t i = 0; i < 4; ++i)
+                    {
+                        pattern.m_shuffle[(lane * 4) + i] = static_cast<std::uint8_t>(byte + 3 - i);
+                    }
+
+                    pattern.m_shifts[lane] = shift;
+
+                    if (lane < 4)
+                    {
+                        pattern.m_multipliers[lane] = std::uint32_t(1) << shift;
+                    }
+                }
+            }
+        }
+
+        return patterns;
+    }
+
+    constexpr UnpackPatterns s_unpack_patterns = create_unpack_patterns();
+
+#if defined(FLY_X86)
+
+    /**
+     * Unpack fields 4 at a time with SSE4.1. Lanes are shifted left by multiplying each lane by a
+     * power of 2, as SSE has no per-lane shift.
+     */
+    FLY_TARGET("sse4.1") std::size_t unpack_sse41(
+        std::byte const *data,
+        std::size_t data_size,
+        std::size_t position,
+        std::uint32_t *values,
+        std::size_t count,
+        byte_type size)
+    {
+        auto const &patterns = s_unpack_patterns[size - 1];
+        __m128i const rshift = _mm_cvtsi32_si128(32 - size);
+
+        std::size_t i = 0;
+
+        for (; ((i + 4) <= count) && (((position / 8) + 16) <= data_size);
+             i += 4, position += 4 * size)
+        {
+            UnpackPattern const &pattern = patterns[position % 8];
+
+            __m128i const shuffle =
+                _mm_load_si128(reinterpret_cast<__m128i const *>(pattern.m_shuffle.data()));
+            __m128i const multipliers =
+                _mm_load_si128(reinterpret_cast<__m128i const *>(pattern.m_multipliers.data()));
+
+            __m128i fields =
+                _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + position / 8));
+            fields = _mm_shuffle_epi8(fields, shuffle);
+            fields = _mm_mullo_epi32(fields, multipliers);
+            fields = _mm_srl_epi32(fields, rshift);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(values + i), fields);
+        }
+
+        return i;
+    }
+
+    /**
+     * Unpack fields 8 at a time with AVX2. The byte shuffle cannot cross 128-bit lanes, so each
+     * half of the register is loaded from the bytes holding its own 4 fields.
+     */
+    FLY_TARGET("avx2") std::size_t unpack_avx2(
+        std::byte const *data,
+        std::size_t data_size,
+        std::size_t position,
+        std::uint32_t *values,
+        std::size_t count,
+        byte_type size)
+    {
+        auto const &patterns = s_unpack_patterns[size - 1];
+        __m128i const rshift = _mm_cvtsi32_si128(32 - size);
+
+        // The load of the last 4 fields begins at most (4 * size + 7) / 8 bytes after the first.
+        std::size_t const high_offset = ((4 * size) + 7) / 8;
+
+        std::size_t i = 0;
+
+        for (; ((i + 8) <= count) && (((position / 8) + high_offset + 16) <= data_size);
+             i += 8, position += 8 * size)
+        {
+            UnpackPattern const &pattern = patterns[position % 8];
+            std::byte const *bytes = data + position / 8;
+
+            __m256i const shuffle =
+                _mm256_load_si256(reinterpret_cast<__m256i const *>(pattern.m_shuffle.data()));
+            __m256i const shifts =
+                _mm256_load_si256(reinterpret_cast<__m256i const *>(pattern.m_shifts.data()));
+
+            __m256i fields = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(bytes))),
+                _mm_loadu_si128(reinterpret_cast<__m128i const *>(bytes + pattern.m_high_offset)),
+                1);
+
+            fields = _mm256_shuffle_epi8(fields, shuffle);
+            fields = _mm256_sllv_epi32(fields, shifts);
+            fields = _mm256_srl_epi32(fields, rshift);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(values + i), fields);
+        }
+
+        return i + unpack_sse41(data, data_size, position, values + i, count - i, size);
+    }
+
+#endif
+
+    unpack_kernel select_kernel()
+    {
+#if defined(FLY_X86)
+        auto const &features = fly::system::cpu_features();
+
+        if (features.m_avx2)
+        {
+            return unpack_avx2;
+        }
+        else if (features.m_sse41)
+        {
+            return unpack_sse41;
+        }
+#endif
+
+        return nullptr;
+    }
+
+} // namespace
+
+//==================================================================================================
+std::size_t unpack_bits(
+    std::span<std::byte const> data,
+    std::size_t position,
+    std::span<std::uint32_t> values,
+    byte_type size)
+{
+    static unpack_kernel const s_kernel = select_kernel();
+
+    if ((s_kernel == nullptr) || (size == 0) || (size > s_max_simd_unpack_bits))
+    {
+        return 0;
+    }
+
+    return s_kernel(data.data(), data.size(), position, values.data(), values.size(), size);
+}
+
+} // namespace fly::detail
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "fly/types/bit_stream/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace fly::detail {
+
+/**
+ * Unpack a number of fixed-width fields, written most-significant bit first by a BitStreamWriter,
+ * with the SIMD kernel supported by the running CPU. The kernel is chosen once at runtime.
+ *
+ * Fields are unpacked 4 (SSE4.1) or 8 (AVX2) at a time: the bytes holding each field are shuffled
+ * into their own 32-bit lane in big endian order, each lane is shifted left to discard the bits
+ * preceding its field, and all lanes are then shifted right to zero-fill the field.
+ *
+ * Only fields of up to s_max_simd_unpack_bits bits are unpacked, and only while whole 16-byte loads
+ * remain within the data. The caller is responsible for unpacking any remaining fields.
+ *
+ * @param data The bytes holding the fields.
+ * @param position The bit position of the first field within the data.
+ * @param values The locations to store the unpacked fields.
+ * @param size The number of bits in each field.
+ *
+ * @return The number of fields unpacked, which may be any number up to the number requested.
+ */
+std::size_t unpack_bits(
+    std::span<std::byte const> data,
+    std::size_t position,
+    std::span<std::uint32_t> values,
+    byte_type size);
+
+// The widest field which may be unpacked with SIMD kernels. A field of this width which begins at
+// the last bit of a byte spans exactly 4 bytes, and thus still fits within a 32-bit lane.
+inline constexpr byte_type s_max_simd_unpack_bits = 25;
+
+} // namespace fly::detail
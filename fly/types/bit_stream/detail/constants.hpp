@@ -2,6 +2,7 @@
 
 #include "fly/types/bit_stream/types.hpp"
 
+#include <cstddef>
 #include <limits>
 
 namespace fly::detail {
@@ -23,4 +24,7 @@ constexpr byte_type const s_bits_per_byte = std::numeric_limits<byte_type>::digi
 
 constexpr byte_type const s_most_significant_bit_position = s_buffer_type_size * s_bits_per_byte;
 
+// Size of the block of bytes backing BitStream readers and writers which are created with one.
+constexpr std::size_t const s_default_block_size = 64 << 10;
+
 } // namespace fly::detail
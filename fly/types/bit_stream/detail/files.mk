@@ -1,2 +1,3 @@
 SRC_$(d) := \
-    $(d)/bit_stream.cpp
+    $(d)/bit_stream.cpp \
+    $(d)/bit_unpacking.cpp
@@ -2,5 +2,6 @@ SRC_DIRS_$(d) := \
     $(d)/detail
 
 SRC_$(d) := \
+    $(d)/bit_span_reader.cpp \
     $(d)/bit_stream_reader.cpp \
     $(d)/bit_stream_writer.cpp
@@ -1,3 +1,7 @@
 SRC_$(d) := \
     $(d)/json.cpp \
-    $(d)/json_exception.cpp
+    $(d)/json_binder.cpp \
+    $(d)/json_cbor.cpp \
+    $(d)/json_exception.cpp \
+    $(d)/json_pointer.cpp \
+    $(d)/json_snapshot.cpp
@@ -255,6 +255,34 @@ Json::const_reference Json::at(size_type index) const
     return storage.at(index);
 }
 
+//==================================================================================================
+Json::pointer Json::try_at(size_type index) noexcept
+{
+    if (auto *storage = std::get_if<json_array_type>(&m_value); storage != nullptr)
+    {
+        if (index < storage->size())
+        {
+            return &(*storage)[index];
+        }
+    }
+
+    return nullptr;
+}
+
+//==================================================================================================
+Json::const_pointer Json::try_at(size_type index) const noexcept
+{
+    if (auto const *storage = std::get_if<json_array_type>(&m_value); storage != nullptr)
+    {
+        if (index < storage->size())
+        {
+            return &(*storage)[index];
+        }
+    }
+
+    return nullptr;
+}
+
 //==================================================================================================
 Json::reference Json::operator[](size_type index)
 {
@@ -851,6 +879,32 @@ json_string_type Json::validate_string(json_string_type &&value)
     return std::move(value);
 }
 
+//==================================================================================================
+bool Json::try_validate_string(json_string_type &value)
+{
+    auto const requires_validation = [](json_char_type ch) {
+        return (ch == '\\') || (ch == '"') || ((ch >= '\0') && (ch < ' '));
+    };
+
+    // Most strings (e.g. object keys) contain no escaped or invalid characters, and are valid
+    // as-is. Only fall back to full validation, which reports errors by exception, otherwise.
+    if (std::none_of(value.begin(), value.end(), requires_validation))
+    {
+        return true;
+    }
+
+    try
+    {
+        value = validate_string(std::move(value));
+    }
+    catch (JsonException const &)
+    {
+        return false;
+    }
+
+    return true;
+}
+
 //==================================================================================================
 void Json::read_escaped_character(json_string_type &value, json_string_type::iterator &it)
 {
@@ -21,6 +21,7 @@
 #include <optional>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -152,6 +153,19 @@ namespace fly {
  *         JSON numbers may be converted to any numeric type. For example, a floating-point JSON
  *         value may be converted to an integer.
  *
+ *     Where a missing value or an incompatible type is expected rather than exceptional (e.g. an
+ *     optional configuration value), the exception-free accessors may be used instead. These
+ *     follow the same conversion rules, but report failure with an empty value:
+ *
+ *         fly::Json json = {{"key1", 1}, {"key2", "abc"}};
+ *         std::optional<int> value = json.try_as<int>(); // value = std::nullopt
+ *
+ *         fly::Json const *value = json.try_at("key1"); // *value = 1
+ *         fly::Json const *value = json.try_at("key3"); // value = nullptr
+ *
+ *         std::optional<int> value = json.try_at("key2")->try_as<int>(); // value = std::nullopt
+ *         fly::json_string_type const *value = json["key2"].get_if<fly::json_string_type>();
+ *
  * Lastly, this class defines the canonical interfaces of STL container types. This includes element
  * accessor, iterator, modifier, and capacity/lookup operations.
  *
@@ -508,6 +522,41 @@ class Json
     template <JsonNumber T>
     explicit operator T() const noexcept(false);
 
+    /**
+     * Exception-free conversion. Converts the Json instance to any type to which it may be
+     * explicitly converted, following the same conversion rules as the conversion operators above.
+     * This may also be used to copy the Json instance itself.
+     *
+     * @tparam T The type to convert to.
+     *
+     * @return If the Json instance could be converted, the converted value. Otherwise, an
+     *         uninitialized value.
+     */
+    template <typename T>
+    std::optional<T> try_as() const;
+
+    /**
+     * Retrieve a pointer to the Json instance's underlying storage, without any conversion.
+     *
+     * @tparam T The storage type (e.g. fly::json_string_type, fly::json_signed_integer_type).
+     *
+     * @return If the Json instance holds the given type, a pointer to the stored value. Otherwise,
+     *         nullptr.
+     */
+    template <typename T>
+    T *get_if() noexcept;
+
+    /**
+     * Retrieve a pointer to the Json instance's underlying storage, without any conversion.
+     *
+     * @tparam T The storage type (e.g. fly::json_string_type, fly::json_signed_integer_type).
+     *
+     * @return If the Json instance holds the given type, a pointer to the stored value. Otherwise,
+     *         nullptr.
+     */
+    template <typename T>
+    T const *get_if() const noexcept;
+
     //==============================================================================================
     //
     // Element accessors
@@ -576,6 +625,54 @@ class Json
      */
     const_reference at(size_type index) const;
 
+    /**
+     * Exception-free object accessor. The SFINAE declaration allows lookups with any string-like
+     * type (e.g. std::string, char8_t[], std::u16string_view).
+     *
+     * @tparam T The string-like key type.
+     *
+     * @param key The key value to lookup.
+     *
+     * @return If the Json instance is an object containing the key value, a pointer to the Json
+     *         instance at the key value. Otherwise, nullptr.
+     */
+    template <JsonStringLike T>
+    pointer try_at(T key);
+
+    /**
+     * Exception-free object accessor. The SFINAE declaration allows lookups with any string-like
+     * type (e.g. std::string, char8_t[], std::u16string_view).
+     *
+     * @tparam T The string-like key type.
+     *
+     * @param key The key value to lookup.
+     *
+     * @return If the Json instance is an object containing the key value, a pointer to the Json
+     *         instance at the key value. Otherwise, nullptr.
+     */
+    template <JsonStringLike T>
+    const_pointer try_at(T key) const;
+
+    /**
+     * Exception-free array accessor.
+     *
+     * @param index The index to lookup.
+     *
+     * @return If the Json instance is an array containing the index, a pointer to the Json instance
+     *         at the index. Otherwise, nullptr.
+     */
+    pointer try_at(size_type index) noexcept;
+
+    /**
+     * Exception-free array accessor.
+     *
+     * @param index The index to lookup.
+     *
+     * @return If the Json instance is an array containing the index, a pointer to the Json instance
+     *         at the index. Otherwise, nullptr.
+     */
+    const_pointer try_at(size_type index) const noexcept;
+
     /**
      * Object access operator. The SFINAE declaration allows lookups with any string-like type
      * (e.g. std::string, char8_t[], std::u16string_view).
@@ -1436,6 +1533,9 @@ class Json
     friend const_iterator;
     friend struct std::hash<Json>;
 
+    // The binder decodes and encodes strings with the same validation and escaping as Json.
+    friend class JsonBinder;
+
     /**
      * Convert any string-like type to a JSON string and validate that string for compliance.
      *
@@ -1450,6 +1550,20 @@ class Json
     template <JsonStringLike T>
     static json_string_type convert_to_string(T value);
 
+    /**
+     * Convert any string-like type to a JSON string and validate that string for compliance,
+     * without raising an exception for invalid values.
+     *
+     * @tparam T The string-like type.
+     *
+     * @param value The string-like value.
+     *
+     * @return If valid, the converted input string value, with escaped and Unicode characters
+     *         handled. Otherwise, an uninitialized value.
+     */
+    template <JsonStringLike T>
+    static std::optional<json_string_type> try_convert_to_string(T value);
+
     /**
      * Validate the string for compliance according to https://www.json.org. Validation includes
      * replacing escaped control and Unicode characters.
@@ -1462,6 +1576,16 @@ class Json
      */
     static json_string_type validate_string(json_string_type &&value);
 
+    /**
+     * Validate the string for compliance according to https://www.json.org, without raising an
+     * exception for invalid values.
+     *
+     * @param value The string value to validate, modified in place to handle escaped characters.
+     *
+     * @return True if the string value is valid.
+     */
+    static bool try_validate_string(json_string_type &value);
+
     /**
      * After reading a reverse solidus character, read the escaped character(s) that follow. Replace
      * the reverse solidus and escaped character(s) with the interpreted control or Unicode
@@ -1776,6 +1900,149 @@ Json::operator T() const noexcept(false)
     return std::visit(std::move(visitor), m_value);
 }
 
+//==================================================================================================
+template <typename T>
+std::optional<T> Json::try_as() const
+{
+    auto visitor = [this](auto const &storage) -> std::optional<T> {
+        using S = decltype(storage);
+
+        if constexpr (fly::SameAs<T, Json>)
+        {
+            return *this;
+        }
+        else if constexpr (JsonNull<T>)
+        {
+            if constexpr (JsonNull<S>)
+            {
+                return storage;
+            }
+        }
+        else if constexpr (JsonString<T>)
+        {
+            if constexpr (JsonString<S>)
+            {
+                if constexpr (fly::SameAs<T, json_string_type>)
+                {
+                    return storage;
+                }
+                else
+                {
+                    return JsonStringType::convert<T>(storage);
+                }
+            }
+            else if constexpr (JsonNumber<S>)
+            {
+                using char_type = typename T::value_type;
+                return fly::string::format(FLY_ARR(char_type, "{}"), storage);
+            }
+        }
+        else if constexpr (JsonObject<T>)
+        {
+            if constexpr (JsonObject<S>)
+            {
+                T result;
+
+                for (auto const &it : storage)
+                {
+                    auto value = it.second.template try_as<typename T::mapped_type>();
+
+                    if (!value)
+                    {
+                        return std::nullopt;
+                    }
+
+                    // The JSON string will have been validated for Unicode compliance during
+                    // construction.
+                    auto key = *std::move(JsonStringType::convert<typename T::key_type>(it.first));
+                    result.emplace(std::move(key), *std::move(value));
+                }
+
+                return result;
+            }
+        }
+        else if constexpr (detail::SameAsFixedArray<T>)
+        {
+            if constexpr (JsonArray<S>)
+            {
+                T result {};
+
+                for (std::size_t i = 0; i < std::min(result.size(), storage.size()); ++i)
+                {
+                    auto value = storage[i].template try_as<typename T::value_type>();
+
+                    if (!value)
+                    {
+                        return std::nullopt;
+                    }
+
+                    result[i] = *std::move(value);
+                }
+
+                return result;
+            }
+        }
+        else if constexpr (JsonArray<T>)
+        {
+            if constexpr (JsonArray<S>)
+            {
+                T result {};
+
+                for (auto const &it : storage)
+                {
+                    auto value = it.template try_as<typename T::value_type>();
+
+                    if (!value)
+                    {
+                        return std::nullopt;
+                    }
+
+                    detail::json_array_append(result, *std::move(value));
+                }
+
+                return result;
+            }
+        }
+        else if constexpr (JsonBoolean<T>)
+        {
+            return static_cast<T>(*this);
+        }
+        else if constexpr (JsonNumber<T>)
+        {
+            if constexpr (JsonString<S>)
+            {
+                return JsonStringType::convert<T>(storage);
+            }
+            else if constexpr (JsonNumber<S>)
+            {
+                return static_cast<T>(storage);
+            }
+        }
+        else
+        {
+            static_assert(!sizeof(T), "Type is not convertible from fly::Json");
+        }
+
+        return std::nullopt;
+    };
+
+    return std::visit(std::move(visitor), m_value);
+}
+
+//==================================================================================================
+template <typename T>
+T *Json::get_if() noexcept
+{
+    return std::get_if<T>(&m_value);
+}
+
+//==================================================================================================
+template <typename T>
+T const *Json::get_if() const noexcept
+{
+    return std::get_if<T>(&m_value);
+}
+
 //==================================================================================================
 template <JsonStringLike T>
 Json::reference Json::at(T key)
@@ -1806,6 +2073,42 @@ Json::const_reference Json::at(T key) const
     return it->second;
 }
 
+//==================================================================================================
+template <JsonStringLike T>
+Json::pointer Json::try_at(T key)
+{
+    if (auto *storage = std::get_if<json_object_type>(&m_value); storage != nullptr)
+    {
+        if (auto converted = try_convert_to_string(std::move(key)); converted)
+        {
+            if (auto it = storage->find(*converted); it != storage->end())
+            {
+                return &it->second;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+//==================================================================================================
+template <JsonStringLike T>
+Json::const_pointer Json::try_at(T key) const
+{
+    if (auto const *storage = std::get_if<json_object_type>(&m_value); storage != nullptr)
+    {
+        if (auto converted = try_convert_to_string(std::move(key)); converted)
+        {
+            if (auto const it = storage->find(*converted); it != storage->end())
+            {
+                return &it->second;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
 //==================================================================================================
 template <JsonStringLike T>
 Json::reference Json::operator[](T key)
@@ -2011,7 +2314,7 @@ json_string_type Json::convert_to_string(T value)
     {
         if (StringType::validate(value))
         {
-            return validate_string(std::move(value));
+            return validate_string(json_string_type(std::move(value)));
         }
     }
     else
@@ -2025,6 +2328,33 @@ json_string_type Json::convert_to_string(T value)
     throw JsonException("Could not convert string-like type to a JSON string");
 }
 
+//==================================================================================================
+template <JsonStringLike T>
+std::optional<json_string_type> Json::try_convert_to_string(T value)
+{
+    using StringType = BasicString<fly::StandardCharacterType<T>>;
+    std::optional<json_string_type> result;
+
+    if constexpr (fly::SameAs<typename StringType::string_type, json_string_type>)
+    {
+        if (StringType::validate(value))
+        {
+            result = json_string_type(std::move(value));
+        }
+    }
+    else
+    {
+        result = StringType::template convert<json_string_type>(value);
+    }
+
+    if (result && try_validate_string(*result))
+    {
+        return result;
+    }
+
+    return std::nullopt;
+}
+
 //==================================================================================================
 template <typename... Args>
 Json::object_insertion_result<Args...> Json::object_inserter(Args &&...args)
@@ -0,0 +1,455 @@
+#include "fly/types/json/json_binder.hpp"
+
+#include "fly/types/json/json.hpp"
+#include "fly/types/json/json_exception.hpp"
+#include "fly/types/string/format.hpp"
+
+#include <array>
+#include <cerrno>
+#include <charconv>
+#include <cstdlib>
+#include <system_error>
+#include <utility>
+
+namespace fly {
+
+namespace {
+
+    // Maximum nesting depth of skipped values, to bound recursion on hostile input.
+    constexpr std::uint32_t const s_max_skip_depth = 1024;
+
+    constexpr bool is_digit(json_char_type ch)
+    {
+        return (ch >= '0') && (ch <= '9');
+    }
+
+} // namespace
+
+//==================================================================================================
+JsonBinder::Reader::Reader(std::string_view contents) noexcept :
+    m_contents(contents)
+{
+}
+
+//==================================================================================================
+bool JsonBinder::Reader::consume(json_char_type token)
+{
+    skip_whitespace();
+
+    if ((m_position < m_contents.size()) && (m_contents[m_position] == token))
+    {
+        ++m_position;
+        return true;
+    }
+
+    return false;
+}
+
+//==================================================================================================
+bool JsonBinder::Reader::consume_null()
+{
+    skip_whitespace();
+
+    if (m_contents.substr(m_position).starts_with("null"))
+    {
+        m_position += 4;
+        return true;
+    }
+
+    return false;
+}
+
+//==================================================================================================
+bool JsonBinder::Reader::at_end()
+{
+    skip_whitespace();
+    return m_position == m_contents.size();
+}
+
+//==================================================================================================
+bool JsonBinder::Reader::read_boolean(bool &value)
+{
+    skip_whitespace();
+    std::string_view const remaining = m_contents.substr(m_position);
+
+    if (remaining.starts_with("true"))
+    {
+        m_position += 4;
+        value = true;
+    }
+    else if (remaining.starts_with("false"))
+    {
+        m_position += 5;
+        value = false;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+//==================================================================================================
+bool JsonBinder::Reader::read_signed_integer(std::int64_t &value)
+{
+    std::string_view number;
+
+    if (!scan_number(number))
+    {
+        return false;
+    }
+
+    auto const *end = number.data() + number.size();
+    auto const result = std::from_chars(number.data(), end, value);
+
+    return (result.ec == std::errc()) && (result.ptr == end);
+}
+
+//==================================================================================================
+bool JsonBinder::Reader::read_unsigned_integer(std::uint64_t &value)
+{
+    std::string_view number;
+
+    if (!scan_number(number))
+    {
+        return false;
+    }
+
+    auto const *end = number.data() + number.size();
+    auto const result = std::from_chars(number.data(), end, value);
+
+    return (result.ec == std::errc()) && (result.ptr == end);
+}
+
+//==================================================================================================
+bool JsonBinder::Reader::read_floating_point(json_floating_point_type &value)
+{
+    std::string_view number;
+
+    if (!scan_number(number))
+    {
+        return false;
+    }
+
+    // Floating-point std::from_chars is not widely available, so the number is converted from a
+    // null-terminated copy. The buffer is re-used between numbers to avoid repeated allocations.
+    m_buffer.assign(number);
+
+    char *end = nullptr;
+    errno = 0;
+
+    value = std::strtold(m_buffer.c_str(), &end);
+    return (errno != ERANGE) && (end == m_buffer.c_str() + m_buffer.size());
+}
+
+//==================================================================================================
+bool JsonBinder::Reader::read_string(json_string_type &value)
+{
+    std::string_view raw;
+    bool has_escape = false;
+
+    if (!scan_string(raw, has_escape))
+    {
+        return false;
+    }
+
+    value.assign(raw);
+
+    if (!JsonStringType::validate(value))
+    {
+        return false;
+    }
+    else if (has_escape)
+    {
+        try
+        {
+            value = Json::validate_string(std::move(value));
+        }
+        catch (JsonException const &)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//==================================================================================================
+bool JsonBinder::Reader::read_key(std::string_view &key)
+{
+    bool has_escape = false;
+
+    if (!scan_string(key, has_escape))
+    {
+        return false;
+    }
+    else if (has_escape)
+    {
+        // Escaped keys are unescaped into the shared buffer, so the key is only valid until the
+        // next token is read.
+        try
+        {
+            m_buffer = Json::validate_string(json_string_type(key));
+        }
+        catch (JsonException const &)
+        {
+            return false;
+        }
+
+        key = m_buffer;
+    }
+
+    return true;
+}
+
+//==================================================================================================
+bool JsonBinder::Reader::skip_value(std::uint32_t depth)
+{
+    if (depth > s_max_skip_depth)
+    {
+        return false;
+    }
+
+    skip_whitespace();
+
+    if (m_position == m_contents.size())
+    {
+        return false;
+    }
+
+    std::string_view raw;
+    bool has_escape = false;
+    bool boolean = false;
+
+    switch (m_contents[m_position])
+    {
+        case '"':
+            return scan_string(raw, has_escape);
+
+        case '{':
+            ++m_position;
+
+            if (consume('}'))
+            {
+                return true;
+            }
+
+            do
+            {
+                if (!scan_string(raw, has_escape) || !consume(':') || !skip_value(depth + 1))
+                {
+                    return false;
+                }
+            } while (consume(','));
+
+            return consume('}');
+
+        case '[':
+            ++m_position;
+
+            if (consume(']'))
+            {
+                return true;
+            }
+
+            do
+            {
+                if (!skip_value(depth + 1))
+                {
+                    return false;
+                }
+            } while (consume(','));
+
+            return consume(']');
+
+        case 't':
+        case 'f':
+            return read_boolean(boolean);
+
+        case 'n':
+            return consume_null();
+
+        default:
+            return scan_number(raw);
+    }
+}
+
+//==================================================================================================
+void JsonBinder::Reader::skip_whitespace()
+{
+    for (; m_position < m_contents.size(); ++m_position)
+    {
+        switch (m_contents[m_position])
+        {
+            case ' ':
+            case '\t':
+            case '\n':
+            case '\r':
+                break;
+
+            default:
+                return;
+        }
+    }
+}
+
+//==================================================================================================
+bool JsonBinder::Reader::scan_string(std::string_view &raw, bool &has_escape)
+{
+    if (!consume('"'))
+    {
+        return false;
+    }
+
+    std::size_t const start = m_position;
+
+    for (; m_position < m_contents.size(); ++m_position)
+    {
+        json_char_type const ch = m_contents[m_position];
+
+        if (ch == '"')
+        {
+            raw = m_contents.substr(start, m_position++ - start);
+            return true;
+        }
+        else if (ch == '\\')
+        {
+            has_escape = true;
+            ++m_position;
+        }
+        else if (static_cast<unsigned char>(ch) < 0x20)
+        {
+            return false;
+        }
+    }
+
+    return false;
+}
+
+//==================================================================================================
+bool JsonBinder::Reader::scan_number(std::string_view &number)
+{
+    skip_whitespace();
+
+    std::size_t const start = m_position;
+    std::size_t const size = m_contents.size();
+
+    auto consume_digits = [this, size]() {
+        std::size_t const digits = m_position;
+
+        while ((m_position < size) && is_digit(m_contents[m_position]))
+        {
+            ++m_position;
+        }
+
+        return m_position != digits;
+    };
+
+    if ((m_position < size) && (m_contents[m_position] == '-'))
+    {
+        ++m_position;
+    }
+
+    if ((m_position < size) && (m_contents[m_position] == '0'))
+    {
+        ++m_position;
+    }
+    else if (!consume_digits())
+    {
+        return false;
+    }
+
+    if ((m_position < size) && (m_contents[m_position] == '.'))
+    {
+        ++m_position;
+
+        if (!consume_digits())
+        {
+            return false;
+        }
+    }
+
+    if ((m_position < size) && ((m_contents[m_position] == 'e') || (m_contents[m_position] == 'E')))
+    {
+        ++m_position;
+
+        if ((m_position < size) &&
+            ((m_contents[m_position] == '+') || (m_contents[m_position] == '-')))
+        {
+            ++m_position;
+        }
+
+        if (!consume_digits())
+        {
+            return false;
+        }
+    }
+
+    number = m_contents.substr(start, m_position - start);
+    return true;
+}
+
+//==================================================================================================
+void JsonBinder::Writer::write(json_char_type token)
+{
+    m_output.push_back(token);
+}
+
+//==================================================================================================
+void JsonBinder::Writer::write_raw(std::string_view value)
+{
+    m_output.append(value);
+}
+
+//==================================================================================================
+void JsonBinder::Writer::write_boolean(bool value)
+{
+    m_output.append(value ? "true" : "false");
+}
+
+//==================================================================================================
+void JsonBinder::Writer::write_signed_integer(std::int64_t value)
+{
+    std::array<char, 24> buffer;
+    auto const result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+
+    m_output.append(buffer.data(), result.ptr);
+}
+
+//==================================================================================================
+void JsonBinder::Writer::write_unsigned_integer(std::uint64_t value)
+{
+    std::array<char, 24> buffer;
+    auto const result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+
+    m_output.append(buffer.data(), result.ptr);
+}
+
+//==================================================================================================
+void JsonBinder::Writer::write_floating_point(json_floating_point_type value)
+{
+    // Formatted the same as Json::serialize, so that encoded values match serialized Json values.
+    m_output.append(fly::string::format("{}", value));
+}
+
+//==================================================================================================
+void JsonBinder::Writer::write_string(json_string_type const &value)
+{
+    m_output.push_back('"');
+
+    for (auto it = value.cbegin(); it != value.cend();)
+    {
+        Json::write_escaped_character(m_output, it, value.cend());
+    }
+
+    m_output.push_back('"');
+}
+
+//==================================================================================================
+json_string_type JsonBinder::Writer::take()
+{
+    return std::move(m_output);
+}
+
+} // namespace fly
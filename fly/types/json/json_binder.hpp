@@ -0,0 +1,482 @@
+#pragma once
+
+#include "fly/concepts/concepts.hpp"
+#include "fly/types/json/detail/concepts.hpp"
+#include "fly/types/json/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fly {
+
+/**
+ * Descriptor of a single member of a structure which is bound to a JSON object. Field descriptors
+ * should be created with fly::json_field.
+ *
+ * @tparam T The type of the structure.
+ * @tparam Member The type of the structure's member.
+ */
+template <typename T, typename Member>
+struct JsonField
+{
+    using member_type = Member;
+
+    std::string_view m_name;
+    Member T::*m_member;
+};
+
+/**
+ * Create a descriptor of a single member of a structure which is bound to a JSON object.
+ *
+ * @tparam T The type of the structure.
+ * @tparam Member The type of the structure's member.
+ *
+ * @param name The name of the member's key in the JSON object. Must not require escaping.
+ * @param member Pointer to the structure's member.
+ *
+ * @return The created field descriptor.
+ */
+template <typename T, typename Member>
+constexpr JsonField<T, Member> json_field(std::string_view name, Member T::*member)
+{
+    return {name, member};
+}
+
+/**
+ * Trait to define the list of fields of a structure which are bound to a JSON object. To bind a
+ * structure, specialize this trait with a static constexpr tuple of field descriptors named
+ * "fields". For example:
+ *
+ *     struct Person
+ *     {
+ *         std::string name;
+ *         std::uint32_t age;
+ *     };
+ *
+ *     template <>
+ *     struct fly::JsonFields<Person>
+ *     {
+ *         static constexpr auto fields = std::make_tuple(
+ *             fly::json_field("name", &Person::name),
+ *             fly::json_field("age", &Person::age));
+ *     };
+ */
+template <typename T>
+struct JsonFields;
+
+/**
+ * Concept that is satisfied when the given type has been bound to a JSON object.
+ */
+template <typename T>
+concept JsonBindable = requires
+{
+    JsonFields<std::remove_cvref_t<T>>::fields;
+};
+
+/**
+ * Class to decode JSON text directly into structures, and to encode structures directly into JSON
+ * text, without creating an intermediate Json instance.
+ *
+ * Structures are bound to JSON objects with a compile-time list of field descriptors (see
+ * fly::JsonFields). During decoding, the JSON text is tokenized in a single pass, and each value is
+ * converted directly into its bound member. Keys without a bound member are skipped, and members
+ * without a key in the JSON text retain their default value.
+ *
+ * Bound members may be any of the following types:
+ *
+ *     1. bool, integral types, and floating-point types.
+ *     2. fly::json_string_type.
+ *     3. std::vector of any supported type.
+ *     4. std::optional of any supported type, which is empty for JSON null values.
+ *     5. Any other bound structure.
+ *
+ * Decoding fails if a value does not match the type of its bound member, including integers which
+ * are out of range of their bound member.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+class JsonBinder
+{
+public:
+    /**
+     * Decode JSON text into a structure.
+     *
+     * @tparam T The type of the structure.
+     *
+     * @param contents The JSON text to decode.
+     *
+     * @return If successful, the decoded structure. Otherwise, an uninitialized value.
+     */
+    template <JsonBindable T>
+    static std::optional<T> decode(std::string_view contents);
+
+    /**
+     * Decode JSON text into an existing structure. If decoding fails, the structure may have been
+     * partially modified.
+     *
+     * @tparam T The type of the structure.
+     *
+     * @param contents The JSON text to decode.
+     * @param value The structure to decode into.
+     *
+     * @return True if the JSON text was successfully decoded.
+     */
+    template <JsonBindable T>
+    static bool decode(std::string_view contents, T &value);
+
+    /**
+     * Encode a structure into JSON text.
+     *
+     * @tparam T The type of the structure.
+     *
+     * @param value The structure to encode.
+     *
+     * @return The encoded JSON text.
+     */
+    template <JsonBindable T>
+    static json_string_type encode(T const &value);
+
+private:
+    /**
+     * Helper class to tokenize JSON text. Each method skips any leading whitespace before reading
+     * its token, and returns false if the expected token could not be read.
+     */
+    class Reader
+    {
+    public:
+        explicit Reader(std::string_view contents) noexcept;
+
+        bool consume(json_char_type token);
+        bool consume_null();
+        bool at_end();
+
+        bool read_boolean(bool &value);
+        bool read_signed_integer(std::int64_t &value);
+        bool read_unsigned_integer(std::uint64_t &value);
+        bool read_floating_point(json_floating_point_type &value);
+        bool read_string(json_string_type &value);
+        bool read_key(std::string_view &key);
+
+        bool skip_value(std::uint32_t depth = 0);
+
+    private:
+        void skip_whitespace();
+        bool scan_string(std::string_view &raw, bool &has_escape);
+        bool scan_number(std::string_view &number);
+
+        std::string_view m_contents;
+        std::size_t m_position {0};
+
+        json_string_type m_buffer;
+    };
+
+    /**
+     * Helper class to write JSON tokens.
+     */
+    class Writer
+    {
+    public:
+        void write(json_char_type token);
+        void write_raw(std::string_view value);
+        void write_boolean(bool value);
+        void write_signed_integer(std::int64_t value);
+        void write_unsigned_integer(std::uint64_t value);
+        void write_floating_point(json_floating_point_type value);
+        void write_string(json_string_type const &value);
+
+        json_string_type take();
+
+    private:
+        json_string_type m_output;
+    };
+
+    template <typename T>
+    static bool decode_value(Reader &reader, T &value);
+
+    template <JsonBindable T>
+    static bool decode_object(Reader &reader, T &value);
+
+    template <typename T>
+    static void encode_value(Writer &writer, T const &value);
+
+    template <JsonBindable T>
+    static void encode_object(Writer &writer, T const &value);
+};
+
+//==================================================================================================
+template <JsonBindable T>
+std::optional<T> JsonBinder::decode(std::string_view contents)
+{
+    T value {};
+
+    if (decode(contents, value))
+    {
+        return value;
+    }
+
+    return std::nullopt;
+}
+
+//==================================================================================================
+template <JsonBindable T>
+bool JsonBinder::decode(std::string_view contents, T &value)
+{
+    Reader reader(contents);
+    return decode_object(reader, value) && reader.at_end();
+}
+
+//==================================================================================================
+template <JsonBindable T>
+json_string_type JsonBinder::encode(T const &value)
+{
+    Writer writer;
+    encode_object(writer, value);
+
+    return writer.take();
+}
+
+//==================================================================================================
+template <typename T>
+bool JsonBinder::decode_value(Reader &reader, T &value)
+{
+    if constexpr (JsonBindable<T>)
+    {
+        return decode_object(reader, value);
+    }
+    else if constexpr (fly::SameAs<T, bool>)
+    {
+        return reader.read_boolean(value);
+    }
+    else if constexpr (fly::SignedIntegral<T>)
+    {
+        std::int64_t result = 0;
+
+        if (!reader.read_signed_integer(result) || !std::in_range<T>(result))
+        {
+            return false;
+        }
+
+        value = static_cast<T>(result);
+        return true;
+    }
+    else if constexpr (fly::UnsignedIntegral<T>)
+    {
+        std::uint64_t result = 0;
+
+        if (!reader.read_unsigned_integer(result) || !std::in_range<T>(result))
+        {
+            return false;
+        }
+
+        value = static_cast<T>(result);
+        return true;
+    }
+    else if constexpr (fly::FloatingPoint<T>)
+    {
+        json_floating_point_type result = 0;
+
+        if (!reader.read_floating_point(result) ||
+            (result > static_cast<json_floating_point_type>(std::numeric_limits<T>::max())) ||
+            (result < static_cast<json_floating_point_type>(std::numeric_limits<T>::lowest())))
+        {
+            return false;
+        }
+
+        value = static_cast<T>(result);
+        return true;
+    }
+    else if constexpr (fly::SameAs<T, json_string_type>)
+    {
+        return reader.read_string(value);
+    }
+    else if constexpr (detail::SameAsContainerType<T, std::optional>)
+    {
+        if (reader.consume_null())
+        {
+            value.reset();
+            return true;
+        }
+
+        return decode_value(reader, value.emplace());
+    }
+    else if constexpr (detail::SameAsContainerType<T, std::vector>)
+    {
+        value.clear();
+
+        if (!reader.consume('['))
+        {
+            return false;
+        }
+        else if (reader.consume(']'))
+        {
+            return true;
+        }
+
+        do
+        {
+            typename T::value_type element {};
+
+            if (!decode_value(reader, element))
+            {
+                return false;
+            }
+
+            value.push_back(std::move(element));
+        } while (reader.consume(','));
+
+        return reader.consume(']');
+    }
+    else
+    {
+        static_assert(!sizeof(T), "Type is not supported by fly::JsonBinder");
+    }
+}
+
+//==================================================================================================
+template <JsonBindable T>
+bool JsonBinder::decode_object(Reader &reader, T &value)
+{
+    static constexpr auto const &s_fields = JsonFields<T>::fields;
+
+    if (!reader.consume('{'))
+    {
+        return false;
+    }
+    else if (reader.consume('}'))
+    {
+        return true;
+    }
+
+    do
+    {
+        std::string_view key;
+
+        if (!reader.read_key(key) || !reader.consume(':'))
+        {
+            return false;
+        }
+
+        bool decoded = false;
+
+        auto decode_field = [&reader, &value, &key, &decoded](auto const &field) {
+            if (key == field.m_name)
+            {
+                decoded = decode_value(reader, value.*field.m_member);
+                return true;
+            }
+
+            return false;
+        };
+
+        // Linearly search the fields for the key. Structures typically have few enough fields that
+        // this is cheaper than hashing the key.
+        bool const found = std::apply(
+            [&decode_field](auto const &...fields) { return (decode_field(fields) || ...); },
+            s_fields);
+
+        if (found ? !decoded : !reader.skip_value())
+        {
+            return false;
+        }
+    } while (reader.consume(','));
+
+    return reader.consume('}');
+}
+
+//==================================================================================================
+template <typename T>
+void JsonBinder::encode_value(Writer &writer, T const &value)
+{
+    if constexpr (JsonBindable<T>)
+    {
+        encode_object(writer, value);
+    }
+    else if constexpr (fly::SameAs<T, bool>)
+    {
+        writer.write_boolean(value);
+    }
+    else if constexpr (fly::SignedIntegral<T>)
+    {
+        writer.write_signed_integer(static_cast<std::int64_t>(value));
+    }
+    else if constexpr (fly::UnsignedIntegral<T>)
+    {
+        writer.write_unsigned_integer(static_cast<std::uint64_t>(value));
+    }
+    else if constexpr (fly::FloatingPoint<T>)
+    {
+        writer.write_floating_point(static_cast<json_floating_point_type>(value));
+    }
+    else if constexpr (fly::SameAs<T, json_string_type>)
+    {
+        writer.write_string(value);
+    }
+    else if constexpr (detail::SameAsContainerType<T, std::optional>)
+    {
+        if (value)
+        {
+            encode_value(writer, *value);
+        }
+        else
+        {
+            writer.write_raw("null");
+        }
+    }
+    else if constexpr (detail::SameAsContainerType<T, std::vector>)
+    {
+        writer.write('[');
+
+        for (std::size_t i = 0; i < value.size(); ++i)
+        {
+            if (i != 0)
+            {
+                writer.write(',');
+            }
+
+            encode_value(writer, value[i]);
+        }
+
+        writer.write(']');
+    }
+    else
+    {
+        static_assert(!sizeof(T), "Type is not supported by fly::JsonBinder");
+    }
+}
+
+//==================================================================================================
+template <JsonBindable T>
+void JsonBinder::encode_object(Writer &writer, T const &value)
+{
+    static constexpr auto const &s_fields = JsonFields<T>::fields;
+    bool first = true;
+
+    auto encode_field = [&writer, &value, &first](auto const &field) {
+        if (!first)
+        {
+            writer.write(',');
+        }
+
+        writer.write('"');
+        writer.write_raw(field.m_name);
+        writer.write('"');
+        writer.write(':');
+
+        encode_value(writer, value.*field.m_member);
+        first = false;
+    };
+
+    writer.write('{');
+    std::apply([&encode_field](auto const &...fields) { (encode_field(fields), ...); }, s_fields);
+    writer.write('}');
+}
+
+} // namespace fly
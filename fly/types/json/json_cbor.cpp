@@ -0,0 +1,807 @@
+#include "fly/types/json/json_cbor.hpp"
+
+#include "fly/fly.hpp"
+#include "fly/types/json/json_exception.hpp"
+#include "fly/types/string/format.hpp"
+#include "fly/types/string/string.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace fly {
+
+namespace {
+
+    /**
+     * Enumerated list of CBOR major types, stored in the high 3 bits of a data item's initial byte.
+     */
+    enum class MajorType : std::uint8_t
+    {
+        UnsignedInteger = 0,
+        NegativeInteger = 1,
+        ByteString = 2,
+        TextString = 3,
+        Array = 4,
+        Map = 5,
+        Tag = 6,
+        Simple = 7,
+    };
+
+    // Additional information values of a data item's initial byte.
+    constexpr std::uint8_t const s_one_byte_argument = 24;
+    constexpr std::uint8_t const s_eight_byte_argument = 27;
+    constexpr std::uint8_t const s_indefinite_length = 31;
+
+    // Additional information values of the simple major type.
+    constexpr std::uint8_t const s_false = 20;
+    constexpr std::uint8_t const s_true = 21;
+    constexpr std::uint8_t const s_null = 22;
+    constexpr std::uint8_t const s_undefined = 23;
+    constexpr std::uint8_t const s_half_precision = 25;
+    constexpr std::uint8_t const s_single_precision = 26;
+    constexpr std::uint8_t const s_double_precision = 27;
+
+    // The initial byte which terminates an indefinite-length data item.
+    constexpr std::uint8_t const s_break = 0xff;
+
+    // Maximum nesting depth of decoded arrays, maps, and tags, to bound recursion on hostile input.
+    constexpr std::uint32_t const s_max_depth = 1024;
+
+    // Size of encoded data buffered before being written to an output stream.
+    constexpr std::size_t const s_flush_threshold = 64 << 10;
+
+    constexpr std::uint8_t initial_byte(MajorType type, std::uint8_t info)
+    {
+        return static_cast<std::uint8_t>((static_cast<std::uint8_t>(type) << 5) | info);
+    }
+
+    json_floating_point_type decode_half_precision(std::uint16_t half)
+    {
+        int const exponent = (half >> 10) & 0x1f;
+        int const mantissa = half & 0x3ff;
+
+        double value = 0.0;
+
+        if (exponent == 0)
+        {
+            value = std::ldexp(mantissa, -24);
+        }
+        else if (exponent != 0x1f)
+        {
+            value = std::ldexp(mantissa + 0x400, exponent - 25);
+        }
+        else
+        {
+            value = (mantissa == 0) ? std::numeric_limits<double>::infinity() :
+                                      std::numeric_limits<double>::quiet_NaN();
+        }
+
+        return (half & 0x8000) ? -value : value;
+    }
+
+    /**
+     * Invoke a visitor with the underlying storage of a Json value, whatever its type.
+     */
+    template <typename Visitor>
+    void visit_storage(Json const &json, Visitor &&visitor)
+    {
+        auto try_visit = [&json, &visitor]<typename T>(std::type_identity<T>) {
+            if (auto const *storage = json.get_if<T>(); storage != nullptr)
+            {
+                visitor(*storage);
+                return true;
+            }
+
+            return false;
+        };
+
+        [&try_visit]<typename... Types>(std::type_identity<std::variant<Types...>>) {
+            FLY_UNUSED((try_visit(std::type_identity<Types>()) || ...));
+        }(std::type_identity<json_type>());
+    }
+
+    /**
+     * Create a Json value holding the given storage as-is. The Json constructors of strings and
+     * objects unescape and validate their contents as JSON text, which does not apply to CBOR.
+     */
+    template <typename T>
+    Json make_json(T &&storage)
+    {
+        using S = std::remove_cvref_t<T>;
+
+        Json json = S();
+        *json.get_if<S>() = std::forward<T>(storage);
+
+        return json;
+    }
+
+} // namespace
+
+/**
+ * Helper class to buffer encoded bytes, flushing them to an output stream (if any) as the buffer
+ * fills up.
+ */
+class JsonCbor::Writer
+{
+public:
+    explicit Writer(std::ostream *stream) noexcept :
+        m_stream(stream)
+    {
+    }
+
+    void write_head(MajorType type, std::uint64_t argument)
+    {
+        if (argument < s_one_byte_argument)
+        {
+            write_byte(initial_byte(type, static_cast<std::uint8_t>(argument)));
+        }
+        else if (argument <= std::numeric_limits<std::uint8_t>::max())
+        {
+            write_byte(initial_byte(type, s_one_byte_argument));
+            write_big_endian<std::uint8_t>(argument);
+        }
+        else if (argument <= std::numeric_limits<std::uint16_t>::max())
+        {
+            write_byte(initial_byte(type, s_one_byte_argument + 1));
+            write_big_endian<std::uint16_t>(argument);
+        }
+        else if (argument <= std::numeric_limits<std::uint32_t>::max())
+        {
+            write_byte(initial_byte(type, s_one_byte_argument + 2));
+            write_big_endian<std::uint32_t>(argument);
+        }
+        else
+        {
+            write_byte(initial_byte(type, s_eight_byte_argument));
+            write_big_endian<std::uint64_t>(argument);
+        }
+    }
+
+    template <typename T>
+    void write_big_endian(std::uint64_t value)
+    {
+        for (std::size_t i = sizeof(T); i > 0; --i)
+        {
+            write_byte(static_cast<std::uint8_t>(value >> ((i - 1) * 8)));
+        }
+    }
+
+    void write_byte(std::uint8_t byte)
+    {
+        m_buffer.push_back(static_cast<char>(byte));
+    }
+
+    void write_bytes(std::string_view bytes)
+    {
+        if ((m_stream != nullptr) && (bytes.size() >= s_flush_threshold))
+        {
+            flush();
+            m_stream->write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        }
+        else
+        {
+            m_buffer.append(bytes);
+            maybe_flush();
+        }
+    }
+
+    void maybe_flush()
+    {
+        if ((m_stream != nullptr) && (m_buffer.size() >= s_flush_threshold))
+        {
+            flush();
+        }
+    }
+
+    void flush()
+    {
+        if ((m_stream != nullptr) && !m_buffer.empty())
+        {
+            m_stream->write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+            m_buffer.clear();
+        }
+    }
+
+    std::string take_buffer()
+    {
+        return std::move(m_buffer);
+    }
+
+private:
+    std::ostream *m_stream;
+    std::string m_buffer;
+};
+
+/**
+ * Helper class to read data items from a string of encoded bytes.
+ */
+class JsonCbor::Reader
+{
+public:
+    /**
+     * The decoded initial byte and argument of a data item.
+     */
+    struct Head
+    {
+        MajorType m_type;
+        std::uint8_t m_info;
+        std::uint64_t m_argument;
+
+        bool is_indefinite() const
+        {
+            return m_info == s_indefinite_length;
+        }
+    };
+
+    explicit Reader(std::string_view bytes) noexcept :
+        m_bytes(bytes)
+    {
+    }
+
+    bool at_end() const
+    {
+        return m_position == m_bytes.size();
+    }
+
+    std::size_t remaining() const
+    {
+        return m_bytes.size() - m_position;
+    }
+
+    std::uint8_t read_byte()
+    {
+        if (at_end())
+        {
+            throw JsonException("Unexpected end of CBOR data");
+        }
+
+        return static_cast<std::uint8_t>(m_bytes[m_position++]);
+    }
+
+    std::string_view read_bytes(std::uint64_t size)
+    {
+        if (size > remaining())
+        {
+            throw JsonException("Unexpected end of CBOR data");
+        }
+
+        auto const bytes = m_bytes.substr(m_position, static_cast<std::size_t>(size));
+        m_position += bytes.size();
+
+        return bytes;
+    }
+
+    bool consume_break()
+    {
+        if (!at_end() && (static_cast<std::uint8_t>(m_bytes[m_position]) == s_break))
+        {
+            ++m_position;
+            return true;
+        }
+
+        return false;
+    }
+
+    Head read_head()
+    {
+        std::uint8_t const byte = read_byte();
+
+        Head head {static_cast<MajorType>(byte >> 5), static_cast<std::uint8_t>(byte & 0x1f), 0};
+
+        if (head.m_info < s_one_byte_argument)
+        {
+            head.m_argument = head.m_info;
+        }
+        else if (head.m_info <= s_eight_byte_argument)
+        {
+            std::size_t const size = std::size_t(1) << (head.m_info - s_one_byte_argument);
+
+            for (char const ch : read_bytes(size))
+            {
+                head.m_argument = (head.m_argument << 8) | static_cast<std::uint8_t>(ch);
+            }
+        }
+        else if (head.m_info != s_indefinite_length)
+        {
+            throw JsonException(fly::string::format("Reserved CBOR argument {}", head.m_info));
+        }
+        else
+        {
+            switch (head.m_type)
+            {
+                case MajorType::ByteString:
+                case MajorType::TextString:
+                case MajorType::Array:
+                case MajorType::Map:
+                    break;
+
+                default:
+                    throw JsonException("Invalid indefinite-length CBOR data item");
+            }
+        }
+
+        return head;
+    }
+
+    /**
+     * Read the contents of a text string. Definite-length strings are returned as a view into the
+     * encoded bytes. Indefinite-length strings are concatenated into the provided buffer.
+     */
+    std::string_view read_text(Head const &head, json_string_type &buffer)
+    {
+        std::string_view text;
+
+        if (head.m_type != MajorType::TextString)
+        {
+            throw JsonException("Expected CBOR text string");
+        }
+        else if (head.is_indefinite())
+        {
+            while (!consume_break())
+            {
+                Head const chunk = read_head();
+
+                if ((chunk.m_type != MajorType::TextString) || chunk.is_indefinite())
+                {
+                    throw JsonException("Invalid chunk in indefinite-length CBOR text string");
+                }
+
+                buffer.append(read_bytes(chunk.m_argument));
+            }
+
+            text = buffer;
+        }
+        else
+        {
+            text = read_bytes(head.m_argument);
+        }
+
+        if (!JsonStringType::validate(text))
+        {
+            throw JsonException("CBOR text string is not valid UTF-8");
+        }
+
+        return text;
+    }
+
+    /**
+     * Read the value of a negative integer. CBOR encodes negative integers as (-1 - argument).
+     */
+    json_signed_integer_type read_negative_integer(Head const &head) const
+    {
+        if (head.m_argument >
+            static_cast<std::uint64_t>(std::numeric_limits<json_signed_integer_type>::max()))
+        {
+            throw JsonException("CBOR negative integer is out of range");
+        }
+
+        return static_cast<json_signed_integer_type>(~head.m_argument);
+    }
+
+    /**
+     * Read the value of a floating-point simple value.
+     */
+    json_floating_point_type read_floating_point(Head const &head) const
+    {
+        switch (head.m_info)
+        {
+            case s_half_precision:
+                return decode_half_precision(static_cast<std::uint16_t>(head.m_argument));
+
+            case s_single_precision:
+                return std::bit_cast<float>(static_cast<std::uint32_t>(head.m_argument));
+
+            default:
+                return std::bit_cast<double>(head.m_argument);
+        }
+    }
+
+    /**
+     * Limit the number of elements to reserve for a definite-length container to the number of
+     * remaining bytes, as each element is encoded with at least one byte.
+     */
+    std::size_t reservable_size(std::uint64_t size) const
+    {
+        return static_cast<std::size_t>(std::min<std::uint64_t>(size, remaining()));
+    }
+
+private:
+    std::string_view m_bytes;
+    std::size_t m_position {0};
+};
+
+//==================================================================================================
+bool JsonCbor::encode(Json const &json, std::ostream &stream)
+{
+    Writer writer(&stream);
+
+    encode_value(json, writer);
+    writer.flush();
+
+    return static_cast<bool>(stream);
+}
+
+//==================================================================================================
+std::string JsonCbor::encode(Json const &json)
+{
+    Writer writer(nullptr);
+    encode_value(json, writer);
+
+    return writer.take_buffer();
+}
+
+//==================================================================================================
+std::optional<Json> JsonCbor::decode(std::string_view bytes)
+{
+    try
+    {
+        Reader reader(bytes);
+        Json json = decode_value(reader, 0);
+
+        if (reader.at_end())
+        {
+            return json;
+        }
+    }
+    catch (JsonException const &)
+    {
+    }
+
+    return std::nullopt;
+}
+
+//==================================================================================================
+std::optional<Json> JsonCbor::decode(std::istream &stream)
+{
+    std::string const bytes(
+        (std::istreambuf_iterator<char>(stream)),
+        std::istreambuf_iterator<char>());
+    return decode(bytes);
+}
+
+//==================================================================================================
+bool JsonCbor::visit(std::string_view bytes, Visitor &visitor)
+{
+    try
+    {
+        Reader reader(bytes);
+        visit_value(reader, visitor, 0);
+
+        return reader.at_end();
+    }
+    catch (JsonException const &)
+    {
+    }
+
+    return false;
+}
+
+//==================================================================================================
+void JsonCbor::encode_value(Json const &json, Writer &writer)
+{
+    auto visitor = [&writer](auto const &storage) {
+        using S = std::decay_t<decltype(storage)>;
+
+        if constexpr (std::is_same_v<S, json_null_type>)
+        {
+            writer.write_byte(initial_byte(MajorType::Simple, s_null));
+        }
+        else if constexpr (std::is_same_v<S, json_string_type>)
+        {
+            writer.write_head(MajorType::TextString, storage.size());
+            writer.write_bytes(storage);
+        }
+        else if constexpr (std::is_same_v<S, json_object_type>)
+        {
+            writer.write_head(MajorType::Map, storage.size());
+
+            for (auto const &[key, value] : storage)
+            {
+                writer.write_head(MajorType::TextString, key.size());
+                writer.write_bytes(key);
+                encode_value(value, writer);
+            }
+        }
+        else if constexpr (std::is_same_v<S, json_array_type>)
+        {
+            writer.write_head(MajorType::Array, storage.size());
+
+            for (auto const &value : storage)
+            {
+                encode_value(value, writer);
+            }
+        }
+        else if constexpr (std::is_same_v<S, json_boolean_type>)
+        {
+            writer.write_byte(initial_byte(MajorType::Simple, storage ? s_true : s_false));
+        }
+        else if constexpr (std::is_same_v<S, json_signed_integer_type>)
+        {
+            if (storage < 0)
+            {
+                // CBOR encodes negative integers as (-1 - value), which is the bitwise complement.
+                writer.write_head(MajorType::NegativeInteger, ~static_cast<std::uint64_t>(storage));
+            }
+            else
+            {
+                writer.write_head(MajorType::UnsignedInteger, static_cast<std::uint64_t>(storage));
+            }
+        }
+        else if constexpr (std::is_same_v<S, json_unsigned_integer_type>)
+        {
+            writer.write_head(MajorType::UnsignedInteger, storage);
+        }
+        else
+        {
+            auto const value = static_cast<double>(storage);
+
+            bool const fits_single = !std::isnan(value) &&
+                (std::isinf(value) || (std::abs(value) <= std::numeric_limits<float>::max())) &&
+                (static_cast<double>(static_cast<float>(value)) == value);
+
+            if (fits_single)
+            {
+                writer.write_byte(initial_byte(MajorType::Simple, s_single_precision));
+                writer.write_big_endian<std::uint32_t>(
+                    std::bit_cast<std::uint32_t>(static_cast<float>(value)));
+            }
+            else
+            {
+                writer.write_byte(initial_byte(MajorType::Simple, s_double_precision));
+                writer.write_big_endian<std::uint64_t>(std::bit_cast<std::uint64_t>(value));
+            }
+        }
+
+        writer.maybe_flush();
+    };
+
+    visit_storage(json, std::move(visitor));
+}
+
+//==================================================================================================
+Json JsonCbor::decode_value(Reader &reader, std::uint32_t depth)
+{
+    if (depth > s_max_depth)
+    {
+        throw JsonException("Maximum CBOR nesting depth exceeded");
+    }
+
+    Reader::Head const head = reader.read_head();
+    Json json;
+
+    switch (head.m_type)
+    {
+        case MajorType::UnsignedInteger:
+            json = make_json(static_cast<json_unsigned_integer_type>(head.m_argument));
+            break;
+
+        case MajorType::NegativeInteger:
+            json = make_json(reader.read_negative_integer(head));
+            break;
+
+        case MajorType::TextString:
+        {
+            json_string_type buffer;
+            std::string_view const text = reader.read_text(head, buffer);
+
+            json = make_json(head.is_indefinite() ? std::move(buffer) : json_string_type(text));
+            break;
+        }
+
+        case MajorType::Array:
+        {
+            json_array_type array;
+
+            if (head.is_indefinite())
+            {
+                while (!reader.consume_break())
+                {
+                    array.push_back(decode_value(reader, depth + 1));
+                }
+            }
+            else
+            {
+                array.reserve(reader.reservable_size(head.m_argument));
+
+                for (std::uint64_t i = 0; i < head.m_argument; ++i)
+                {
+                    array.push_back(decode_value(reader, depth + 1));
+                }
+            }
+
+            json = make_json(std::move(array));
+            break;
+        }
+
+        case MajorType::Map:
+        {
+            json_object_type object;
+            json_string_type buffer;
+
+            auto decode_entry = [&]() {
+                buffer.clear();
+
+                std::string_view const key = reader.read_text(reader.read_head(), buffer);
+                object.insert_or_assign(json_string_type(key), decode_value(reader, depth + 1));
+            };
+
+            if (head.is_indefinite())
+            {
+                while (!reader.consume_break())
+                {
+                    decode_entry();
+                }
+            }
+            else
+            {
+                for (std::uint64_t i = 0; i < head.m_argument; ++i)
+                {
+                    decode_entry();
+                }
+            }
+
+            json = make_json(std::move(object));
+            break;
+        }
+
+        case MajorType::Tag:
+            return decode_value(reader, depth + 1);
+
+        case MajorType::Simple:
+            switch (head.m_info)
+            {
+                case s_false:
+                case s_true:
+                    json = make_json(head.m_info == s_true);
+                    break;
+
+                case s_null:
+                case s_undefined:
+                    break;
+
+                case s_half_precision:
+                case s_single_precision:
+                case s_double_precision:
+                    json = make_json(reader.read_floating_point(head));
+                    break;
+
+                default:
+                    throw JsonException(
+                        fly::string::format("Unsupported CBOR simple value {}", head.m_info));
+            }
+
+            break;
+
+        default:
+            throw JsonException("CBOR byte strings are not supported");
+    }
+
+    return json;
+}
+
+//==================================================================================================
+void JsonCbor::visit_value(Reader &reader, Visitor &visitor, std::uint32_t depth)
+{
+    if (depth > s_max_depth)
+    {
+        throw JsonException("Maximum CBOR nesting depth exceeded");
+    }
+
+    Reader::Head const head = reader.read_head();
+
+    switch (head.m_type)
+    {
+        case MajorType::UnsignedInteger:
+            visitor.on_unsigned_integer(static_cast<json_unsigned_integer_type>(head.m_argument));
+            break;
+
+        case MajorType::NegativeInteger:
+            visitor.on_signed_integer(reader.read_negative_integer(head));
+            break;
+
+        case MajorType::TextString:
+        {
+            json_string_type buffer;
+            visitor.on_string(reader.read_text(head, buffer));
+            break;
+        }
+
+        case MajorType::Array:
+            if (head.is_indefinite())
+            {
+                visitor.on_array_start(std::nullopt);
+
+                while (!reader.consume_break())
+                {
+                    visit_value(reader, visitor, depth + 1);
+                }
+            }
+            else
+            {
+                visitor.on_array_start(static_cast<std::size_t>(head.m_argument));
+
+                for (std::uint64_t i = 0; i < head.m_argument; ++i)
+                {
+                    visit_value(reader, visitor, depth + 1);
+                }
+            }
+
+            visitor.on_array_end();
+            break;
+
+        case MajorType::Map:
+        {
+            json_string_type buffer;
+
+            auto visit_entry = [&]() {
+                buffer.clear();
+
+                visitor.on_object_key(reader.read_text(reader.read_head(), buffer));
+                visit_value(reader, visitor, depth + 1);
+            };
+
+            if (head.is_indefinite())
+            {
+                visitor.on_object_start(std::nullopt);
+
+                while (!reader.consume_break())
+                {
+                    visit_entry();
+                }
+            }
+            else
+            {
+                visitor.on_object_start(static_cast<std::size_t>(head.m_argument));
+
+                for (std::uint64_t i = 0; i < head.m_argument; ++i)
+                {
+                    visit_entry();
+                }
+            }
+
+            visitor.on_object_end();
+            break;
+        }
+
+        case MajorType::Tag:
+            visit_value(reader, visitor, depth + 1);
+            break;
+
+        case MajorType::Simple:
+            switch (head.m_info)
+            {
+                case s_false:
+                case s_true:
+                    visitor.on_boolean(head.m_info == s_true);
+                    break;
+
+                case s_null:
+                case s_undefined:
+                    visitor.on_null();
+                    break;
+
+                case s_half_precision:
+                case s_single_precision:
+                case s_double_precision:
+                    visitor.on_floating_point(reader.read_floating_point(head));
+                    break;
+
+                default:
+                    throw JsonException(
+                        fly::string::format("Unsupported CBOR simple value {}", head.m_info));
+            }
+
+            break;
+
+        default:
+            throw JsonException("CBOR byte strings are not supported");
+    }
+}
+
+} // namespace fly
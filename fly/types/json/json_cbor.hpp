@@ -0,0 +1,210 @@
+#pragma once
+
+#include "fly/types/json/json.hpp"
+#include "fly/types/json/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace fly {
+
+/**
+ * Class to encode and decode Json instances with the Concise Binary Object Representation (CBOR),
+ * as defined by https://www.rfc-editor.org/rfc/rfc8949.html.
+ *
+ * Encoding always uses the shortest form of each data item's argument. JSON strings are encoded as
+ * text strings, and JSON objects are encoded as maps with text string keys. Because CBOR does not
+ * define a floating-point type wider than double precision, floating-point values are encoded as
+ * single-precision if that is lossless, and as double-precision otherwise.
+ *
+ * Decoding supports every CBOR data item which has an equivalent JSON representation, including
+ * indefinite-length strings, arrays, and maps. Semantic tags are ignored, and the undefined simple
+ * value is decoded as null. Byte strings, non-text map keys, and other simple values are rejected.
+ *
+ * Decoded strings may also be visited in place, without copying them out of the encoded bytes, by
+ * providing a JsonCbor::Visitor.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+class JsonCbor
+{
+public:
+    /**
+     * Interface to receive each decoded data item in document order. String views provided to the
+     * visitor refer directly to the encoded bytes (unless the string was encoded with indefinite
+     * length), and are only valid for the lifetime of those bytes.
+     */
+    class Visitor
+    {
+    public:
+        /**
+         * Destructor.
+         */
+        virtual ~Visitor() = default;
+
+        /**
+         * Visit a decoded null (or undefined) value.
+         */
+        virtual void on_null() = 0;
+
+        /**
+         * Visit a decoded boolean value.
+         *
+         * @param value The decoded value.
+         */
+        virtual void on_boolean(json_boolean_type value) = 0;
+
+        /**
+         * Visit a decoded negative integer value.
+         *
+         * @param value The decoded value.
+         */
+        virtual void on_signed_integer(json_signed_integer_type value) = 0;
+
+        /**
+         * Visit a decoded non-negative integer value.
+         *
+         * @param value The decoded value.
+         */
+        virtual void on_unsigned_integer(json_unsigned_integer_type value) = 0;
+
+        /**
+         * Visit a decoded floating-point value.
+         *
+         * @param value The decoded value.
+         */
+        virtual void on_floating_point(json_floating_point_type value) = 0;
+
+        /**
+         * Visit a decoded string value.
+         *
+         * @param value The decoded value.
+         */
+        virtual void on_string(std::string_view value) = 0;
+
+        /**
+         * Visit the start of a decoded array. Each element is visited before on_array_end.
+         *
+         * @param size The number of elements in the array, if it was encoded with definite length.
+         */
+        virtual void on_array_start(std::optional<std::size_t> size) = 0;
+
+        /**
+         * Visit the end of a decoded array.
+         */
+        virtual void on_array_end() = 0;
+
+        /**
+         * Visit the start of a decoded object. Each entry's key is visited with on_object_key, and
+         * is followed by a visit of the entry's value, before on_object_end.
+         *
+         * @param size The number of entries in the object, if it was encoded with definite length.
+         */
+        virtual void on_object_start(std::optional<std::size_t> size) = 0;
+
+        /**
+         * Visit the key of a decoded object entry.
+         *
+         * @param key The decoded key.
+         */
+        virtual void on_object_key(std::string_view key) = 0;
+
+        /**
+         * Visit the end of a decoded object.
+         */
+        virtual void on_object_end() = 0;
+    };
+
+    /**
+     * Encode a Json instance, streaming the encoded bytes onto an output stream.
+     *
+     * @param json The Json instance to encode.
+     * @param stream The stream to write the encoded bytes onto.
+     *
+     * @return True if the Json instance was successfully written to the stream.
+     */
+    static bool encode(Json const &json, std::ostream &stream);
+
+    /**
+     * Encode a Json instance into a string of bytes.
+     *
+     * @param json The Json instance to encode.
+     *
+     * @return The encoded bytes.
+     */
+    static std::string encode(Json const &json);
+
+    /**
+     * Decode a single Json instance from a string of bytes. The bytes must contain exactly one
+     * encoded data item.
+     *
+     * @param bytes The encoded bytes.
+     *
+     * @return If successful, the decoded Json instance. Otherwise, an uninitialized value.
+     */
+    static std::optional<Json> decode(std::string_view bytes);
+
+    /**
+     * Decode a single Json instance from the remaining contents of an input stream.
+     *
+     * @param stream The stream to read the encoded bytes from.
+     *
+     * @return If successful, the decoded Json instance. Otherwise, an uninitialized value.
+     */
+    static std::optional<Json> decode(std::istream &stream);
+
+    /**
+     * Decode a single data item from a string of bytes, providing each decoded value to a visitor
+     * rather than creating a Json instance. The bytes must contain exactly one encoded data item.
+     *
+     * @param bytes The encoded bytes.
+     * @param visitor The visitor to receive each decoded value.
+     *
+     * @return True if the bytes were successfully decoded.
+     */
+    static bool visit(std::string_view bytes, Visitor &visitor);
+
+private:
+    class Writer;
+    class Reader;
+
+    /**
+     * Encode a Json instance with a writer. May be called recursively for nested values.
+     *
+     * @param json The Json instance to encode.
+     * @param writer The writer to store the encoded bytes.
+     */
+    static void encode_value(Json const &json, Writer &writer);
+
+    /**
+     * Decode a Json instance with a reader. May be called recursively for nested values.
+     *
+     * @param reader The reader holding the encoded bytes.
+     * @param depth The current nesting depth of the decoded value.
+     *
+     * @return The decoded Json instance.
+     *
+     * @throws JsonException If the encoded bytes are invalid or are not representable as JSON.
+     */
+    static Json decode_value(Reader &reader, std::uint32_t depth);
+
+    /**
+     * Decode a data item with a reader, providing each decoded value to a visitor. May be called
+     * recursively for nested values.
+     *
+     * @param reader The reader holding the encoded bytes.
+     * @param visitor The visitor to receive each decoded value.
+     * @param depth The current nesting depth of the decoded value.
+     *
+     * @throws JsonException If the encoded bytes are invalid or are not representable as JSON.
+     */
+    static void visit_value(Reader &reader, Visitor &visitor, std::uint32_t depth);
+};
+
+} // namespace fly
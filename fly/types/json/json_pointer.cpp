@@ -0,0 +1,293 @@
+#include "fly/types/json/json_pointer.hpp"
+
+#include "fly/types/json/json.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <string>
+#include <system_error>
+
+namespace fly {
+
+namespace {
+
+    constexpr json_char_type const s_pointer_separator = '/';
+    constexpr json_char_type const s_pointer_escape = '~';
+
+    constexpr json_char_type const s_path_root = '$';
+    constexpr json_char_type const s_path_child = '.';
+    constexpr json_char_type const s_path_open_bracket = '[';
+    constexpr json_char_type const s_path_close_bracket = ']';
+    constexpr json_char_type const s_path_escape = '\\';
+    constexpr std::string_view s_path_name_terminators = ".[";
+
+} // namespace
+
+//==================================================================================================
+std::optional<JsonPointer> JsonPointer::from_string(std::string_view pointer)
+{
+    JsonPointer result;
+
+    if (pointer.empty())
+    {
+        return result;
+    }
+    else if (pointer.front() != s_pointer_separator)
+    {
+        return std::nullopt;
+    }
+
+    while (!pointer.empty())
+    {
+        pointer.remove_prefix(1);
+
+        std::size_t const end = std::min(pointer.find(s_pointer_separator), pointer.size());
+        std::string_view const token = pointer.substr(0, end);
+        pointer.remove_prefix(end);
+
+        json_string_type key;
+        key.reserve(token.size());
+
+        for (std::size_t i = 0; i < token.size(); ++i)
+        {
+            if (token[i] != s_pointer_escape)
+            {
+                key.push_back(token[i]);
+            }
+            else if (++i == token.size())
+            {
+                return std::nullopt;
+            }
+            else if (token[i] == '0')
+            {
+                key.push_back(s_pointer_escape);
+            }
+            else if (token[i] == '1')
+            {
+                key.push_back(s_pointer_separator);
+            }
+            else
+            {
+                return std::nullopt;
+            }
+        }
+
+        result.m_steps.push_back({std::move(key), parse_index(token)});
+    }
+
+    return result;
+}
+
+//==================================================================================================
+std::optional<JsonPointer> JsonPointer::from_path(std::string_view path)
+{
+    JsonPointer result;
+
+    if (path.empty() || (path.front() != s_path_root))
+    {
+        return std::nullopt;
+    }
+
+    path.remove_prefix(1);
+
+    while (!path.empty())
+    {
+        json_char_type const segment = path.front();
+        path.remove_prefix(1);
+
+        if (segment == s_path_child)
+        {
+            std::size_t const end =
+                std::min(path.find_first_of(s_path_name_terminators), path.size());
+
+            if (end == 0)
+            {
+                return std::nullopt;
+            }
+
+            result.m_steps.push_back({json_string_type(path.substr(0, end)), std::nullopt});
+            path.remove_prefix(end);
+        }
+        else if ((segment == s_path_open_bracket) && !path.empty())
+        {
+            json_char_type const quote = path.front();
+
+            if ((quote == '\'') || (quote == '"'))
+            {
+                json_string_type key;
+                path.remove_prefix(1);
+
+                while (!path.empty() && (path.front() != quote))
+                {
+                    if ((path.front() == s_path_escape) && (path.size() > 1))
+                    {
+                        path.remove_prefix(1);
+                    }
+
+                    key.push_back(path.front());
+                    path.remove_prefix(1);
+                }
+
+                if (path.empty())
+                {
+                    return std::nullopt;
+                }
+
+                result.m_steps.push_back({std::move(key), std::nullopt});
+                path.remove_prefix(1);
+            }
+            else
+            {
+                std::size_t const end = std::min(path.find(s_path_close_bracket), path.size());
+
+                if (auto index = parse_index(path.substr(0, end)); index)
+                {
+                    result.m_steps.push_back({std::nullopt, *index});
+                    path.remove_prefix(end);
+                }
+                else
+                {
+                    return std::nullopt;
+                }
+            }
+
+            if (path.empty() || (path.front() != s_path_close_bracket))
+            {
+                return std::nullopt;
+            }
+
+            path.remove_prefix(1);
+        }
+        else
+        {
+            return std::nullopt;
+        }
+    }
+
+    return result;
+}
+
+//==================================================================================================
+Json *JsonPointer::find(Json &json) const
+{
+    return const_cast<Json *>(find(static_cast<Json const &>(json)));
+}
+
+//==================================================================================================
+Json const *JsonPointer::find(Json const &json) const
+{
+    Json const *current = &json;
+
+    for (Step const &step : m_steps)
+    {
+        if (auto const *object = current->get_if<json_object_type>(); object)
+        {
+            if (!step.m_key)
+            {
+                return nullptr;
+            }
+
+            auto const it = object->find(*step.m_key);
+
+            if (it == object->end())
+            {
+                return nullptr;
+            }
+
+            current = &it->second;
+        }
+        else if (auto const *array = current->get_if<json_array_type>(); array)
+        {
+            if (!step.m_index || (*step.m_index >= array->size()))
+            {
+                return nullptr;
+            }
+
+            current = &(*array)[*step.m_index];
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+
+    return current;
+}
+
+//==================================================================================================
+bool JsonPointer::contains(Json const &json) const
+{
+    return find(json) != nullptr;
+}
+
+//==================================================================================================
+std::size_t JsonPointer::size() const
+{
+    return m_steps.size();
+}
+
+//==================================================================================================
+bool JsonPointer::empty() const
+{
+    return m_steps.empty();
+}
+
+//==================================================================================================
+json_string_type JsonPointer::to_string() const
+{
+    json_string_type result;
+
+    for (Step const &step : m_steps)
+    {
+        result.push_back(s_pointer_separator);
+
+        if (!step.m_key)
+        {
+            result.append(std::to_string(*step.m_index));
+            continue;
+        }
+
+        for (json_char_type const ch : *step.m_key)
+        {
+            if (ch == s_pointer_escape)
+            {
+                result.append("~0");
+            }
+            else if (ch == s_pointer_separator)
+            {
+                result.append("~1");
+            }
+            else
+            {
+                result.push_back(ch);
+            }
+        }
+    }
+
+    return result;
+}
+
+//==================================================================================================
+std::optional<std::size_t> JsonPointer::parse_index(std::string_view token)
+{
+    // Per RFC 6901, array indices are either zero or a decimal number without leading zeros.
+    if (token.empty() || ((token.size() > 1) && (token.front() == '0')))
+    {
+        return std::nullopt;
+    }
+
+    std::size_t index = 0;
+
+    auto const *begin = token.data();
+    auto const *end = begin + token.size();
+    auto const result = std::from_chars(begin, end, index);
+
+    if ((result.ec != std::errc()) || (result.ptr != end))
+    {
+        return std::nullopt;
+    }
+
+    return index;
+}
+
+} // namespace fly
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "fly/types/json/types.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace fly {
+
+class Json;
+
+/**
+ * Class to represent a precompiled path to a value within a Json instance. A path is parsed once
+ * into a sequence of object key and array index steps, and may then be evaluated against any number
+ * of Json instances. Evaluation performs no allocations, and so is considerably cheaper than chains
+ * of Json::operator[] or Json::at, which create a temporary string for each object key.
+ *
+ * Paths may be created from either of two syntaxes:
+ *
+ * 1. A JSON Pointer, as defined by https://www.rfc-editor.org/rfc/rfc6901.html. For example,
+ *    "/store/book/0/title". Each reference token is used as an object key when evaluated against a
+ *    JSON object, and as an array index when evaluated against a JSON array (if the token is a
+ *    valid array index).
+ *
+ * 2. A subset of JSONPath, which allows only the root and child segments which select a single
+ *    value. For example, "$.store.book[0]['title']". Object keys may be given with dot notation or
+ *    as a quoted name within brackets, in which a backslash escapes the following character. Array
+ *    indices are given as a non-negative integer within brackets. Wildcards, slices, filters, and
+ *    recursive descent are not supported.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+class JsonPointer
+{
+public:
+    /**
+     * Default constructor. The default path refers to the whole Json instance.
+     */
+    JsonPointer() = default;
+
+    /**
+     * Compile a JSON Pointer string.
+     *
+     * @param pointer The JSON Pointer string to compile.
+     *
+     * @return If successful, the compiled path. Otherwise, an uninitialized value.
+     */
+    static std::optional<JsonPointer> from_string(std::string_view pointer);
+
+    /**
+     * Compile a JSONPath expression.
+     *
+     * @param path The JSONPath expression to compile.
+     *
+     * @return If successful, the compiled path. Otherwise, an uninitialized value.
+     */
+    static std::optional<JsonPointer> from_path(std::string_view path);
+
+    /**
+     * Find the value referred to by this path within a Json instance.
+     *
+     * @param json The Json instance to search.
+     *
+     * @return A pointer to the found value, or nullptr if the value does not exist.
+     */
+    Json *find(Json &json) const;
+
+    /**
+     * Find the value referred to by this path within a Json instance.
+     *
+     * @param json The Json instance to search.
+     *
+     * @return A pointer to the found value, or nullptr if the value does not exist.
+     */
+    Json const *find(Json const &json) const;
+
+    /**
+     * Check if a value referred to by this path exists within a Json instance.
+     *
+     * @param json The Json instance to search.
+     *
+     * @return True if the value exists.
+     */
+    bool contains(Json const &json) const;
+
+    /**
+     * @return The number of steps in this path.
+     */
+    std::size_t size() const;
+
+    /**
+     * @return True if this path refers to the whole Json instance.
+     */
+    bool empty() const;
+
+    /**
+     * Serialize this path as a JSON Pointer string.
+     *
+     * @return The JSON Pointer string.
+     */
+    json_string_type to_string() const;
+
+private:
+    /**
+     * A single step of a path. A step may be evaluated against a JSON object if it has a key, and
+     * against a JSON array if it has an index.
+     */
+    struct Step
+    {
+        std::optional<json_string_type> m_key;
+        std::optional<std::size_t> m_index;
+    };
+
+    /**
+     * Parse a JSON Pointer reference token or a JSONPath array index as an array index.
+     *
+     * @param token The token to parse.
+     *
+     * @return If the token is a valid array index, the parsed index. Otherwise, an uninitialized
+     *         value.
+     */
+    static std::optional<std::size_t> parse_index(std::string_view token);
+
+    std::vector<Step> m_steps;
+};
+
+} // namespace fly
@@ -0,0 +1,69 @@
+#include "fly/types/json/json_snapshot.hpp"
+
+#include <utility>
+
+namespace fly {
+
+namespace {
+
+    // All default and missing-value snapshots share a single null instance, so that creating them
+    // does not allocate.
+    std::shared_ptr<Json const> const &null_json()
+    {
+        static std::shared_ptr<Json const> const s_null_json = std::make_shared<Json>();
+        return s_null_json;
+    }
+
+} // namespace
+
+//==================================================================================================
+JsonSnapshot::JsonSnapshot() :
+    m_json(null_json())
+{
+}
+
+//==================================================================================================
+JsonSnapshot::JsonSnapshot(Json json) :
+    m_json(std::make_shared<Json>(std::move(json)))
+{
+}
+
+//==================================================================================================
+JsonSnapshot::JsonSnapshot(std::shared_ptr<Json const> owner, Json const *json) noexcept :
+    m_json(std::move(owner), json)
+{
+}
+
+//==================================================================================================
+Json const &JsonSnapshot::get() const
+{
+    return *m_json;
+}
+
+//==================================================================================================
+Json const &JsonSnapshot::operator*() const
+{
+    return *m_json;
+}
+
+//==================================================================================================
+Json const *JsonSnapshot::operator->() const
+{
+    return m_json.get();
+}
+
+//==================================================================================================
+JsonSnapshot JsonSnapshot::child(json_string_type const &key) const
+{
+    if (auto const *object = m_json->get_if<json_object_type>(); object)
+    {
+        if (auto it = object->find(key); it != object->end())
+        {
+            return JsonSnapshot(m_json, &it->second);
+        }
+    }
+
+    return JsonSnapshot();
+}
+
+} // namespace fly
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "fly/types/json/json.hpp"
+#include "fly/types/json/types.hpp"
+
+#include <memory>
+
+namespace fly {
+
+/**
+ * Class to hold an immutable, reference-counted Json instance.
+ *
+ * Copying a snapshot is O(1), as copies share ownership of the same underlying Json instance rather
+ * than duplicating it. Because the shared instance is never modified in place, any number of
+ * threads may read from their own copies of a snapshot concurrently without locking.
+ *
+ * Snapshots of nested values share ownership of the snapshot they were created from, so a subtree
+ * may be handed out without copying it and remains valid for as long as the subtree snapshot lives.
+ *
+ * Snapshots cannot be modified. To change a value, copy the held Json instance, modify the copy,
+ * and create a new snapshot from it.
+ *
+ * @author Timothy Flynn (trflynn89@pm.me)
+ * @version October 18, 2026
+ */
+class JsonSnapshot
+{
+public:
+    /**
+     * Default constructor. The snapshot holds a null Json instance.
+     */
+    JsonSnapshot();
+
+    /**
+     * Constructor. Take ownership of a Json instance.
+     *
+     * @param json The Json instance to hold.
+     */
+    explicit JsonSnapshot(Json json);
+
+    /**
+     * @return The held Json instance.
+     */
+    Json const &get() const;
+
+    /**
+     * @return The held Json instance.
+     */
+    Json const &operator*() const;
+
+    /**
+     * @return A pointer to the held Json instance.
+     */
+    Json const *operator->() const;
+
+    /**
+     * Create a snapshot of a value of the held JSON object, sharing ownership of this snapshot.
+     *
+     * @param key The key of the value.
+     *
+     * @return If the held Json instance is an object containing the key, a snapshot of the key's
+     *         value. Otherwise, a snapshot holding a null Json instance.
+     */
+    JsonSnapshot child(json_string_type const &key) const;
+
+private:
+    /**
+     * Constructor. Share ownership of another snapshot's Json instance, but refer to a nested value
+     * within that instance.
+     *
+     * @param owner The owner of the outermost Json instance.
+     * @param json The nested value within the owned Json instance.
+     */
+    JsonSnapshot(std::shared_ptr<Json const> owner, Json const *json) noexcept;
+
+    std::shared_ptr<Json const> m_json;
+};
+
+} // namespace fly
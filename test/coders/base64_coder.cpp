@@ -5,13 +5,78 @@
 #include "catch2/catch_test_macros.hpp"
 
 #include <cctype>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <sstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace {
 
 // This must match the size of fly::coders::Base64Coder::m_encoded
 constexpr std::size_t s_large_string_size = 256 << 10;
 
+// A straightforward Base64 encoder to validate the results of the block-based encoder.
+std::string reference_encode(std::string_view decoded)
+{
+    static constexpr std::string_view s_symbols =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::string encoded;
+
+    for (std::size_t i = 0; i < decoded.size(); i += 3)
+    {
+        std::uint32_t chunk = static_cast<std::uint8_t>(decoded[i]) << 16;
+
+        if ((i + 1) < decoded.size())
+        {
+            chunk |= static_cast<std::uint8_t>(decoded[i + 1]) << 8;
+        }
+        if ((i + 2) < decoded.size())
+        {
+            chunk |= static_cast<std::uint8_t>(decoded[i + 2]);
+        }
+
+        encoded += s_symbols[(chunk >> 18) & 0x3f];
+        encoded += s_symbols[(chunk >> 12) & 0x3f];
+        encoded += ((i + 1) < decoded.size()) ? s_symbols[(chunk >> 6) & 0x3f] : '=';
+        encoded += ((i + 2) < decoded.size()) ? s_symbols[chunk & 0x3f] : '=';
+    }
+
+    return encoded;
+}
+
+// Create a sequence of bytes covering every byte value.
+std::string create_bytes(std::size_t size)
+{
+    std::string bytes(size, '\0');
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        bytes[i] = static_cast<char>((i * 131 + (i >> 8)) & 0xff);
+    }
+
+    return bytes;
+}
+
+// Update a coder session with a sequence split into pieces of the given size.
+template <typename Session>
+bool update_in_pieces(Session &session, std::string_view contents, std::size_t piece_size)
+{
+    for (std::size_t i = 0; i < contents.size(); i += piece_size)
+    {
+        if (!session.update(std::as_bytes(std::span(contents.substr(i, piece_size)))))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 } // namespace
 
 CATCH_TEST_CASE("Base64", "[coders]")
@@ -152,6 +217,227 @@ CATCH_TEST_CASE("Base64", "[coders]")
         CATCH_CHECK(raw == dec);
     }
 
+    CATCH_SECTION("Encode and decode sequences of every size into buffers")
+    {
+        for (std::size_t size = 0; size <= 256; ++size)
+        {
+            CATCH_CAPTURE(size);
+
+            std::string const raw = create_bytes(size);
+            std::string const expected = reference_encode(raw);
+
+            std::string enc(fly::coders::Base64Coder::encoded_length(raw.size()), '\0');
+            enc.resize(fly::coders::Base64Coder::encode_into(raw, enc.data()));
+            CATCH_CHECK(enc == expected);
+
+            std::string dec(fly::coders::Base64Coder::max_decoded_length(enc.size()), '\0');
+            auto const decoded_size = fly::coders::Base64Coder::decode_into(enc, dec.data());
+            CATCH_REQUIRE(decoded_size);
+
+            dec.resize(*decoded_size);
+            CATCH_CHECK(raw == dec);
+
+            std::string stream_enc, stream_dec;
+            CATCH_REQUIRE(coder.encode_string(raw, stream_enc));
+            CATCH_REQUIRE(coder.decode_string(stream_enc, stream_dec));
+
+            CATCH_CHECK(stream_enc == expected);
+            CATCH_CHECK(raw == stream_dec);
+        }
+    }
+
+    CATCH_SECTION("Encode and decode a large sequence into buffers")
+    {
+        std::string const raw = create_bytes((1 << 20) + 7);
+
+        std::string enc(fly::coders::Base64Coder::encoded_length(raw.size()), '\0');
+        enc.resize(fly::coders::Base64Coder::encode_into(raw, enc.data()));
+        CATCH_CHECK(enc == reference_encode(raw));
+
+        std::string dec(fly::coders::Base64Coder::max_decoded_length(enc.size()), '\0');
+        auto const decoded_size = fly::coders::Base64Coder::decode_into(enc, dec.data());
+        CATCH_REQUIRE(decoded_size);
+
+        dec.resize(*decoded_size);
+        CATCH_CHECK(raw == dec);
+    }
+
+    CATCH_SECTION("Encoded and decoded sizes are computed")
+    {
+        CATCH_CHECK(fly::coders::Base64Coder::encoded_length(0) == 0);
+        CATCH_CHECK(fly::coders::Base64Coder::encoded_length(1) == 4);
+        CATCH_CHECK(fly::coders::Base64Coder::encoded_length(2) == 4);
+        CATCH_CHECK(fly::coders::Base64Coder::encoded_length(3) == 4);
+        CATCH_CHECK(fly::coders::Base64Coder::encoded_length(4) == 8);
+
+        CATCH_CHECK(fly::coders::Base64Coder::max_decoded_length(0) == 0);
+        CATCH_CHECK(fly::coders::Base64Coder::max_decoded_length(4) == 3);
+        CATCH_CHECK(fly::coders::Base64Coder::max_decoded_length(8) == 6);
+    }
+
+    CATCH_SECTION("Cannot decode buffers with invalid symbols at any position")
+    {
+        std::string const raw = create_bytes(96);
+        std::string const enc = reference_encode(raw);
+        std::string dec(fly::coders::Base64Coder::max_decoded_length(enc.size()), '\0');
+
+        for (char const invalid : {'^', '\0', '\x80', '\xff', '=', '-', '_'})
+        {
+            for (std::size_t position = 0; position < enc.size(); ++position)
+            {
+                // A padding symbol in the final position is valid.
+                if ((invalid == '=') && (position == (enc.size() - 1)))
+                {
+                    continue;
+                }
+
+                CATCH_CAPTURE(static_cast<int>(invalid), position);
+
+                std::string test = enc;
+                test[position] = invalid;
+
+                CATCH_CHECK_FALSE(fly::coders::Base64Coder::decode_into(test, dec.data()));
+                CATCH_CHECK_FALSE(coder.decode_string(test, dec));
+            }
+        }
+    }
+
+    CATCH_SECTION("Cannot decode buffers with invalid sizes")
+    {
+        std::string dec(64, '\0');
+
+        CATCH_CHECK_FALSE(fly::coders::Base64Coder::decode_into("abc", dec.data()));
+        CATCH_CHECK_FALSE(fly::coders::Base64Coder::decode_into("abcde", dec.data()));
+        CATCH_CHECK_FALSE(
+            fly::coders::Base64Coder::decode_into(std::string(45, 'a'), dec.data()));
+    }
+
+    CATCH_SECTION("Encode and decode byte buffers identically to strings")
+    {
+        for (std::size_t size = 0; size <= 64; ++size)
+        {
+            CATCH_CAPTURE(size);
+
+            std::string const raw = create_bytes(size);
+            std::string const expected = reference_encode(raw);
+
+            std::vector<std::byte> enc;
+            CATCH_REQUIRE(coder.encode_buffer(std::as_bytes(std::span(raw)), enc));
+            CATCH_CHECK(
+                std::string(reinterpret_cast<char const *>(enc.data()), enc.size()) == expected);
+            CATCH_CHECK(enc.size() == coder.max_encoded_size(raw.size()));
+
+            std::vector<std::byte> dec;
+            CATCH_REQUIRE(coder.decode_buffer(enc, dec));
+            CATCH_CHECK(std::string(reinterpret_cast<char const *>(dec.data()), dec.size()) == raw);
+
+            // Buffers which exactly fit the decoded contents are large enough, even if they are
+            // smaller than the maximum decoded size due to padding.
+            std::vector<std::byte> exact(raw.size());
+            auto const decoded_size = coder.decode_buffer(enc, std::span(exact));
+            CATCH_REQUIRE(decoded_size);
+            CATCH_CHECK(*decoded_size == raw.size());
+            CATCH_CHECK(exact == dec);
+        }
+    }
+
+    CATCH_SECTION("Cannot encode or decode into byte buffers which are too small")
+    {
+        std::string const raw = create_bytes(100);
+        std::string const enc = reference_encode(raw);
+
+        std::vector<std::byte> small(enc.size() - 1);
+        CATCH_CHECK_FALSE(coder.encode_buffer(std::as_bytes(std::span(raw)), std::span(small)));
+
+        small.resize(raw.size() - 1);
+        CATCH_CHECK_FALSE(coder.decode_buffer(std::as_bytes(std::span(enc)), std::span(small)));
+
+        small.resize(raw.size() - 4);
+        CATCH_CHECK_FALSE(coder.decode_buffer(std::as_bytes(std::span(enc)), std::span(small)));
+    }
+
+    CATCH_SECTION("Decode a padded stream which exactly fills the decoding buffer")
+    {
+        std::string const raw = create_bytes(s_large_string_size / 4 * 3 - 1);
+        std::string dec;
+
+        std::string const enc = reference_encode(raw);
+        CATCH_REQUIRE(enc.size() == s_large_string_size);
+
+        CATCH_REQUIRE(coder.decode_string(enc, dec));
+        CATCH_CHECK(raw == dec);
+    }
+
+    CATCH_SECTION("Encode and decode sequences provided in pieces with sessions")
+    {
+        for (std::size_t size : {0, 1, 2, 3, 4, 5, 6, 7, 100, 1000, 200 << 10})
+        {
+            std::string const raw = create_bytes(size);
+            std::string const expected = reference_encode(raw);
+
+            for (std::size_t piece_size : {1, 2, 3, 4, 5, 7, 64, 1000, 100 << 10})
+            {
+                CATCH_CAPTURE(size, piece_size);
+
+                std::ostringstream enc;
+                auto encoder_session = coder.create_encoder_session(enc);
+
+                CATCH_REQUIRE(update_in_pieces(*encoder_session, raw, piece_size));
+                CATCH_REQUIRE(encoder_session->finish());
+                CATCH_CHECK(enc.str() == expected);
+
+                std::ostringstream dec;
+                auto decoder_session = coder.create_decoder_session(dec);
+
+                CATCH_REQUIRE(update_in_pieces(*decoder_session, expected, piece_size));
+                CATCH_REQUIRE(decoder_session->finish());
+                CATCH_CHECK(dec.str() == raw);
+            }
+        }
+    }
+
+    CATCH_SECTION("Cannot decode sequences with padding before the final chunk with sessions")
+    {
+        std::string const enc = reference_encode("ab") + reference_encode("cde");
+
+        for (std::size_t piece_size : {1, 3, 4, 5, 8})
+        {
+            CATCH_CAPTURE(piece_size);
+
+            std::ostringstream dec;
+            auto session = coder.create_decoder_session(dec);
+
+            bool const updated = update_in_pieces(*session, enc, piece_size);
+            CATCH_CHECK_FALSE((updated && session->finish()));
+        }
+    }
+
+    CATCH_SECTION("Cannot decode incomplete sequences with sessions")
+    {
+        std::string const enc = reference_encode("abcdef").substr(0, 7);
+
+        std::ostringstream dec;
+        auto session = coder.create_decoder_session(dec);
+
+        CATCH_REQUIRE(session->update(std::as_bytes(std::span(enc))));
+        CATCH_CHECK_FALSE(session->finish());
+    }
+
+    CATCH_SECTION("Cannot update or finish sessions which have been finished")
+    {
+        std::ostringstream enc, dec;
+
+        auto encoder_session = coder.create_encoder_session(enc);
+        CATCH_REQUIRE(encoder_session->finish());
+        CATCH_CHECK_FALSE(encoder_session->update(std::as_bytes(std::span("abc", 3))));
+        CATCH_CHECK_FALSE(encoder_session->finish());
+
+        auto decoder_session = coder.create_decoder_session(dec);
+        CATCH_REQUIRE(decoder_session->finish());
+        CATCH_CHECK_FALSE(decoder_session->update(std::as_bytes(std::span("YWJj", 4))));
+        CATCH_CHECK_FALSE(decoder_session->finish());
+    }
+
     CATCH_SECTION("File tests")
     {
         fly::test::PathUtil::ScopedTempDirectory path;
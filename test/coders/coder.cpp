@@ -0,0 +1,143 @@
+#include "fly/coders/coder.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+/**
+ * A coder which only implements the stream interface, to validate the default implementations of
+ * the Encoder and Decoder interfaces. Each byte is encoded as its complement.
+ */
+class ComplementCoder : public fly::coders::Encoder, public fly::coders::Decoder
+{
+protected:
+    bool encode_internal(std::istream &decoded, std::ostream &encoded) override
+    {
+        return complement(decoded, encoded);
+    }
+
+    bool decode_internal(std::istream &encoded, std::ostream &decoded) override
+    {
+        return complement(encoded, decoded);
+    }
+
+private:
+    static bool complement(std::istream &input, std::ostream &output)
+    {
+        std::string contents(std::istreambuf_iterator<char>(input), {});
+
+        for (char &ch : contents)
+        {
+            ch = static_cast<char>(~ch);
+        }
+
+        output.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+        return output.good();
+    }
+};
+
+// Update a coder session with a sequence split into pieces of the given size.
+template <typename Session>
+bool update_in_pieces(Session &session, std::string_view contents, std::size_t piece_size)
+{
+    for (std::size_t i = 0; i < contents.size(); i += piece_size)
+    {
+        if (!session.update(std::as_bytes(std::span(contents.substr(i, piece_size)))))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+CATCH_TEST_CASE("Coder", "[coders]")
+{
+    ComplementCoder coder;
+
+    fly::coders::Encoder &encoder = coder;
+    fly::coders::Decoder &decoder = coder;
+
+    CATCH_SECTION("Default maximum encoded size is a conservative bound")
+    {
+        CATCH_CHECK(encoder.max_encoded_size(0) > 0);
+        CATCH_CHECK(encoder.max_encoded_size(100) >= 200);
+    }
+
+    CATCH_SECTION("Default maximum decoded size is unbounded")
+    {
+        CATCH_CHECK(decoder.max_decoded_size(100) == std::numeric_limits<std::size_t>::max());
+    }
+
+    CATCH_SECTION("Buffers may be coded with the default size bounds")
+    {
+        std::string const raw = "abcdefghijklmnopqrstuvwxyz";
+        std::string enc, dec;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, enc));
+        CATCH_REQUIRE(decoder.decode_string(enc, dec));
+
+        CATCH_CHECK(enc.size() == raw.size());
+        CATCH_CHECK(dec == raw);
+    }
+
+    CATCH_SECTION("Default sessions code sequences provided in pieces")
+    {
+        std::string raw;
+
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            raw += static_cast<char>(i);
+        }
+
+        std::string expected;
+        CATCH_REQUIRE(encoder.encode_string(raw, expected));
+
+        for (std::size_t piece_size : {1, 7, 64, 1000})
+        {
+            std::ostringstream encoded;
+            auto encoder_session = encoder.create_encoder_session(encoded);
+
+            CATCH_REQUIRE(update_in_pieces(*encoder_session, raw, piece_size));
+            CATCH_REQUIRE(encoder_session->finish());
+            CATCH_CHECK(encoded.str() == expected);
+
+            std::ostringstream decoded;
+            auto decoder_session = decoder.create_decoder_session(decoded);
+
+            CATCH_REQUIRE(update_in_pieces(*decoder_session, expected, piece_size));
+            CATCH_REQUIRE(decoder_session->finish());
+            CATCH_CHECK(decoded.str() == raw);
+        }
+    }
+
+    CATCH_SECTION("Default sessions cannot be used after they are finished")
+    {
+        std::string const raw = "abc";
+
+        std::ostringstream encoded;
+        auto encoder_session = encoder.create_encoder_session(encoded);
+        CATCH_REQUIRE(encoder_session->finish());
+
+        CATCH_CHECK_FALSE(encoder_session->update(std::as_bytes(std::span(raw))));
+        CATCH_CHECK_FALSE(encoder_session->finish());
+
+        std::ostringstream decoded;
+        auto decoder_session = decoder.create_decoder_session(decoded);
+        CATCH_REQUIRE(decoder_session->finish());
+
+        CATCH_CHECK_FALSE(decoder_session->update(std::as_bytes(std::span(raw))));
+        CATCH_CHECK_FALSE(decoder_session->finish());
+    }
+}
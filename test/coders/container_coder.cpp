@@ -0,0 +1,523 @@
+#include "test/util/path_util.hpp"
+#include "test/util/task_manager.hpp"
+
+#include "fly/coders/base64/base64_coder.hpp"
+#include "fly/coders/coder_config.hpp"
+#include "fly/coders/container/container_decoder.hpp"
+#include "fly/coders/container/container_encoder.hpp"
+#include "fly/coders/container/container_index.hpp"
+#include "fly/coders/detail/crc32c.hpp"
+#include "fly/coders/huffman/huffman_decoder.hpp"
+#include "fly/coders/huffman/huffman_encoder.hpp"
+#include "fly/task/task_runner.hpp"
+#include "fly/types/numeric/literals.hpp"
+#include "fly/types/string/string.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace fly::literals::numeric_literals;
+
+namespace {
+
+/**
+ * Subclass of the coder config to contain invalid values.
+ */
+class BadCoderConfig : public fly::coders::CoderConfig
+{
+public:
+    BadCoderConfig() noexcept :
+        fly::coders::CoderConfig()
+    {
+        m_default_container_encoder_frame_size_kb = 0;
+    }
+};
+
+/**
+ * Subclass of the coder config to reduce the frame size.
+ */
+class SmallFrameSizeConfig : public fly::coders::CoderConfig
+{
+public:
+    SmallFrameSizeConfig() noexcept :
+        fly::coders::CoderConfig()
+    {
+        m_default_container_encoder_frame_size_kb = 1;
+    }
+};
+
+/**
+ * Create a container encoder which Huffman encodes each frame.
+ */
+fly::coders::ContainerEncoder
+create_encoder(std::shared_ptr<fly::coders::CoderConfig> const &config)
+{
+    return fly::coders::ContainerEncoder(
+        config,
+        std::make_unique<fly::coders::HuffmanEncoder>(config));
+}
+
+/**
+ * Update a coder session with a sequence split into pieces of the given size.
+ */
+template <typename Session>
+bool update_in_pieces(Session &session, std::string_view contents, std::size_t piece_size)
+{
+    for (std::size_t i = 0; i < contents.size(); i += piece_size)
+    {
+        if (!session.update(std::as_bytes(std::span(contents.substr(i, piece_size)))))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Create an index from a container held in a string.
+ */
+std::optional<fly::coders::ContainerIndex> create_index(std::string const &encoded)
+{
+    return fly::coders::ContainerIndex::create(std::as_bytes(std::span(encoded)));
+}
+
+/**
+ * Flip the bits of a byte of a container held in a string.
+ */
+std::string corrupt(std::string encoded, std::size_t position)
+{
+    encoded[position] = static_cast<char>(~encoded[position]);
+    return encoded;
+}
+
+} // namespace
+
+CATCH_TEST_CASE("CRC32C", "[coders]")
+{
+    auto checksum = [](std::string_view data, std::uint32_t crc = 0) {
+        return fly::detail::crc32c(std::as_bytes(std::span(data)), crc);
+    };
+
+    CATCH_SECTION("Compute the checksum of known sequences")
+    {
+        CATCH_CHECK(checksum("") == 0x0000'0000_u32);
+        CATCH_CHECK(checksum("123456789") == 0xe306'9283_u32);
+        CATCH_CHECK(checksum(std::string(32, '\x00')) == 0x8a91'36aa_u32);
+        CATCH_CHECK(checksum(std::string(32, '\xff')) == 0x62a8'ab43_u32);
+
+        // Large enough to be checksummed as independent parts.
+        std::string sequence(40'000, '\0');
+
+        for (std::size_t i = 0; i < sequence.size(); ++i)
+        {
+            sequence[i] = static_cast<char>(i % 251);
+        }
+
+        CATCH_CHECK(checksum(sequence) == 0x6860'8d15_u32);
+    }
+
+    CATCH_SECTION("Compute the checksum of sequences provided in pieces")
+    {
+        std::string const sequence = fly::String::generate_random_string(100 << 10);
+        std::uint32_t const expected = checksum(sequence);
+
+        for (std::size_t split : {1, 7, 8, 4095, 4096, 12287, 12288, 12289, 50'001})
+        {
+            CATCH_CAPTURE(split);
+
+            std::string_view const view(sequence);
+            std::uint32_t const first = checksum(view.substr(0, split));
+
+            CATCH_CHECK(checksum(view.substr(split), first) == expected);
+        }
+
+        // Checksum the sequence starting at every alignment.
+        for (std::size_t offset = 1; offset < 8; ++offset)
+        {
+            CATCH_CAPTURE(offset);
+
+            std::string_view const view(sequence);
+            std::uint32_t crc = checksum(view.substr(0, offset));
+
+            for (std::size_t i = offset; i < view.size(); i += 3'001)
+            {
+                crc = checksum(view.substr(i, 3'001), crc);
+            }
+
+            CATCH_CHECK(crc == expected);
+        }
+    }
+}
+
+CATCH_TEST_CASE("Container", "[coders]")
+{
+    auto config = std::make_shared<SmallFrameSizeConfig>();
+
+    auto encoder = create_encoder(config);
+    fly::coders::ContainerDecoder decoder(std::make_unique<fly::coders::HuffmanDecoder>());
+
+    CATCH_SECTION("Cannot encode stream using an invalid configuration")
+    {
+        auto bad_encoder = create_encoder(std::make_shared<BadCoderConfig>());
+
+        std::string const raw = "abc";
+        std::string enc;
+
+        CATCH_CHECK_FALSE(bad_encoder.encode_string(raw, enc));
+    }
+
+    CATCH_SECTION("Cannot encode with sessions using an invalid configuration")
+    {
+        auto bad_encoder = create_encoder(std::make_shared<BadCoderConfig>());
+
+        std::ostringstream enc;
+        auto session = bad_encoder.create_encoder_session(enc);
+
+        CATCH_CHECK_FALSE(session->update(std::as_bytes(std::span("abc", 3))));
+        CATCH_CHECK_FALSE(session->finish());
+    }
+
+    CATCH_SECTION("Encode and decode empty stream")
+    {
+        std::string const raw;
+        std::string enc, dec;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, enc));
+        CATCH_CHECK(enc.size() == fly::coders::s_container_header_size + 20);
+
+        auto const index = create_index(enc);
+        CATCH_REQUIRE(index);
+        CATCH_CHECK(index->frames().empty());
+        CATCH_CHECK(index->decoded_size() == 0);
+
+        CATCH_REQUIRE(decoder.decode_string(enc, dec));
+        CATCH_CHECK(dec.empty());
+    }
+
+    CATCH_SECTION("Encode and decode streams spanning many frames")
+    {
+        for (std::size_t size : {1, 2, 1023, 1024, 1025, 4096, (10 << 10) + 7})
+        {
+            CATCH_CAPTURE(size);
+
+            std::string const raw = fly::String::generate_random_string(size);
+            std::string enc, dec;
+
+            CATCH_REQUIRE(encoder.encode_string(raw, enc));
+            CATCH_REQUIRE(decoder.decode_string(enc, dec));
+            CATCH_CHECK(dec == raw);
+
+            auto const index = create_index(enc);
+            CATCH_REQUIRE(index);
+            CATCH_CHECK(index->frames().size() == ((size + 1023) / 1024));
+            CATCH_CHECK(index->decoded_size() == size);
+        }
+    }
+
+    CATCH_SECTION("Encode and decode frames with other coders")
+    {
+        fly::coders::ContainerEncoder base64_encoder(
+            config,
+            std::make_unique<fly::coders::Base64Coder>());
+        fly::coders::ContainerDecoder base64_decoder(std::make_unique<fly::coders::Base64Coder>());
+
+        std::string const raw = fly::String::generate_random_string((10 << 10) + 7);
+        std::string enc, dec;
+
+        CATCH_REQUIRE(base64_encoder.encode_string(raw, enc));
+        CATCH_REQUIRE(base64_decoder.decode_string(enc, dec));
+        CATCH_CHECK(dec == raw);
+    }
+
+    CATCH_SECTION("Encode and decode buffers identically to strings")
+    {
+        std::string const raw = fly::String::generate_random_string((10 << 10) + 7);
+        std::string expected;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, expected));
+
+        std::vector<std::byte> enc;
+        CATCH_REQUIRE(encoder.encode_buffer(std::as_bytes(std::span(raw)), enc));
+        CATCH_CHECK(enc == std::vector<std::byte>(
+                               reinterpret_cast<std::byte const *>(expected.data()),
+                               reinterpret_cast<std::byte const *>(expected.data()) +
+                                   expected.size()));
+
+        std::vector<std::byte> dec(raw.size());
+        auto const size = decoder.decode_buffer(enc, std::span(dec));
+
+        CATCH_REQUIRE(size);
+        CATCH_CHECK(*size == raw.size());
+        CATCH_CHECK(std::equal(dec.begin(), dec.end(), std::as_bytes(std::span(raw)).begin()));
+    }
+
+    CATCH_SECTION("Encoded buffers do not exceed the maximum encoded size")
+    {
+        for (std::size_t size : {0, 1, 1024, 1025, 10 << 10})
+        {
+            CATCH_CAPTURE(size);
+
+            std::string const raw = fly::String::generate_random_string(size);
+            std::vector<std::byte> enc(encoder.max_encoded_size(size));
+
+            auto const encoded_size =
+                encoder.encode_buffer(std::as_bytes(std::span(raw)), std::span(enc));
+            CATCH_REQUIRE(encoded_size);
+            CATCH_CHECK(*encoded_size <= enc.size());
+        }
+    }
+
+    CATCH_SECTION("Encoder sessions produce streams identical to encoding the whole stream")
+    {
+        for (std::size_t size : {0, 1, 1023, 1024, 1025, 10 << 10})
+        {
+            std::string const raw = fly::String::generate_random_string(size);
+            std::string expected;
+
+            CATCH_REQUIRE(encoder.encode_string(raw, expected));
+
+            for (std::size_t piece_size : {1, 7, 1000, 1024, 5000})
+            {
+                CATCH_CAPTURE(size, piece_size);
+
+                std::ostringstream enc;
+                auto session = encoder.create_encoder_session(enc);
+
+                CATCH_REQUIRE(update_in_pieces(*session, raw, piece_size));
+                CATCH_REQUIRE(session->finish());
+                CATCH_CHECK(enc.str() == expected);
+            }
+        }
+    }
+
+    CATCH_SECTION("Decoder sessions decode streams provided in pieces")
+    {
+        for (std::size_t size : {0, 1, 1023, 1024, 1025, 10 << 10})
+        {
+            std::string const raw = fly::String::generate_random_string(size);
+            std::string enc;
+
+            CATCH_REQUIRE(encoder.encode_string(raw, enc));
+
+            for (std::size_t piece_size : {1, 7, 100, 1024, 5000})
+            {
+                CATCH_CAPTURE(size, piece_size);
+
+                std::ostringstream dec;
+                auto session = decoder.create_decoder_session(dec);
+
+                CATCH_REQUIRE(update_in_pieces(*session, enc, piece_size));
+                CATCH_REQUIRE(session->finish());
+                CATCH_CHECK(dec.str() == raw);
+            }
+        }
+    }
+
+    CATCH_SECTION("Decode ranges of the decoded sequence")
+    {
+        std::string const raw = fly::String::generate_random_string((10 << 10) + 7);
+        std::string enc;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, enc));
+        auto const encoded = std::as_bytes(std::span(enc));
+
+        auto const index = create_index(enc);
+        CATCH_REQUIRE(index);
+
+        for (std::size_t offset : {0, 1, 1023, 1024, 1025, 5000, 10 << 10})
+        {
+            for (std::size_t size : {1, 2, 1024, 2049, 20 << 10})
+            {
+                CATCH_CAPTURE(offset, size);
+
+                std::string dec(size, '\0');
+                auto const decoded_size = decoder.decode_range(
+                    encoded,
+                    *index,
+                    offset,
+                    std::as_writable_bytes(std::span(dec)));
+
+                CATCH_REQUIRE(decoded_size);
+                CATCH_CHECK(*decoded_size == std::min(size, raw.size() - offset));
+                CATCH_CHECK(dec.substr(0, *decoded_size) == raw.substr(offset, size));
+            }
+        }
+
+        std::string dec(1, '\0');
+        auto const beyond_end = decoder.decode_range(
+            encoded,
+            *index,
+            raw.size(),
+            std::as_writable_bytes(std::span(dec)));
+
+        CATCH_REQUIRE(beyond_end);
+        CATCH_CHECK(*beyond_end == 0);
+    }
+
+    CATCH_SECTION("Find the frame holding each byte of the decoded sequence")
+    {
+        std::string const raw = fly::String::generate_random_string((3 << 10) + 7);
+        std::string enc;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, enc));
+
+        auto const index = create_index(enc);
+        CATCH_REQUIRE(index);
+
+        CATCH_CHECK(index->find(0) == 0);
+        CATCH_CHECK(index->find(1023) == 0);
+        CATCH_CHECK(index->find(1024) == 1);
+        CATCH_CHECK(index->find(3 << 10) == 3);
+        CATCH_CHECK(index->find(raw.size() - 1) == 3);
+        CATCH_CHECK(index->find(raw.size()) == 4);
+    }
+
+    CATCH_SECTION("Verify frames of a container")
+    {
+        auto task_runner = fly::task::ParallelTaskRunner::create(fly::test::task_manager());
+
+        fly::coders::ContainerDecoder concurrent_decoder(
+            std::make_unique<fly::coders::HuffmanDecoder>(),
+            task_runner);
+
+        std::string const raw = fly::String::generate_random_string((10 << 10) + 7);
+        std::string enc;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, enc));
+
+        auto const index = create_index(enc);
+        CATCH_REQUIRE(index);
+
+        CATCH_CHECK(decoder.verify(std::as_bytes(std::span(enc)), *index));
+        CATCH_CHECK(concurrent_decoder.verify(std::as_bytes(std::span(enc)), *index));
+
+        // Corrupt a byte of the encoded data of a frame.
+        auto const &frame = index->frames()[3];
+        std::string const corrupted = corrupt(enc, frame.m_encoded_offset + 10);
+        auto const encoded = std::as_bytes(std::span(corrupted));
+
+        CATCH_CHECK_FALSE(decoder.verify(encoded, *index));
+        CATCH_CHECK_FALSE(concurrent_decoder.verify(encoded, *index));
+
+        // Only ranges held by the corrupted frame fail to decode.
+        std::string dec(100, '\0');
+        auto const output = std::as_writable_bytes(std::span(dec));
+
+        CATCH_CHECK(decoder.decode_range(encoded, *index, 0, output));
+        CATCH_CHECK_FALSE(decoder.decode_range(encoded, *index, frame.m_decoded_offset, output));
+        CATCH_CHECK_FALSE(decoder.decode_string(corrupted, dec));
+
+        // Corrupt a byte of the header of a frame.
+        std::string const corrupted_header = corrupt(enc, frame.m_encoded_offset - 1);
+
+        CATCH_CHECK_FALSE(decoder.verify(std::as_bytes(std::span(corrupted_header)), *index));
+        CATCH_CHECK_FALSE(decoder.decode_string(corrupted_header, dec));
+    }
+
+    CATCH_SECTION("Cannot create an index for truncated or corrupted containers")
+    {
+        std::string const raw = fly::String::generate_random_string((3 << 10) + 7);
+        std::string enc;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, enc));
+        CATCH_REQUIRE(create_index(enc));
+
+        // Too small to hold a header and trailer.
+        CATCH_CHECK_FALSE(create_index(enc.substr(0, 24)));
+
+        // Invalid header magic and version.
+        CATCH_CHECK_FALSE(create_index(corrupt(enc, 0)));
+        CATCH_CHECK_FALSE(create_index(corrupt(enc, 4)));
+
+        // Invalid footer magic and frame count.
+        CATCH_CHECK_FALSE(create_index(corrupt(enc, enc.size() - 1)));
+        CATCH_CHECK_FALSE(create_index(corrupt(enc, enc.size() - 5)));
+        CATCH_CHECK_FALSE(create_index(corrupt(enc, enc.size() - 8)));
+
+        // Corrupted index entries, which no longer match the index checksum.
+        CATCH_CHECK_FALSE(create_index(corrupt(enc, enc.size() - 9)));
+        CATCH_CHECK_FALSE(create_index(corrupt(enc, enc.size() - 20)));
+
+        // Truncated and extended containers.
+        CATCH_CHECK_FALSE(create_index(enc.substr(1)));
+        CATCH_CHECK_FALSE(create_index(enc.substr(0, enc.size() - 1)));
+        CATCH_CHECK_FALSE(create_index(enc + '\0'));
+    }
+
+    CATCH_SECTION("Cannot decode truncated or corrupted containers")
+    {
+        std::string const raw = fly::String::generate_random_string((3 << 10) + 7);
+        std::string enc, dec;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, enc));
+
+        CATCH_CHECK_FALSE(decoder.decode_string(enc.substr(0, enc.size() - 1), dec));
+        CATCH_CHECK_FALSE(decoder.decode_string(enc + '\0', dec));
+        CATCH_CHECK_FALSE(decoder.decode_string(corrupt(enc, 0), dec));
+        CATCH_CHECK_FALSE(decoder.decode_string(corrupt(enc, enc.size() - 20), dec));
+
+        std::ostringstream truncated_dec;
+        auto truncated_session = decoder.create_decoder_session(truncated_dec);
+
+        std::string const truncated = enc.substr(0, enc.size() - 1);
+        CATCH_REQUIRE(update_in_pieces(*truncated_session, truncated, 100));
+        CATCH_CHECK_FALSE(truncated_session->finish());
+
+        std::ostringstream corrupted_dec;
+        auto corrupted_session = decoder.create_decoder_session(corrupted_dec);
+
+        std::string const corrupted = corrupt(enc, 0);
+        CATCH_CHECK_FALSE(corrupted_session->update(std::as_bytes(std::span(corrupted))));
+        CATCH_CHECK_FALSE(corrupted_session->finish());
+    }
+
+    CATCH_SECTION("File tests")
+    {
+        fly::test::PathUtil::ScopedTempDirectory path;
+        std::filesystem::path encoded_file = path.file();
+        std::filesystem::path decoded_file = path.file();
+
+        CATCH_SECTION("Encode and decode a large file, and decode ranges of the file")
+        {
+            auto const here = std::filesystem::path(__FILE__).parent_path();
+            auto const raw = here / "data" / "test.txt";
+
+            auto default_encoder = create_encoder(std::make_shared<fly::coders::CoderConfig>());
+
+            CATCH_REQUIRE(default_encoder.encode_file(raw, encoded_file));
+            CATCH_REQUIRE(decoder.decode_file(encoded_file, decoded_file));
+            CATCH_CHECK(fly::test::PathUtil::compare_files(raw, decoded_file));
+
+            std::string const contents = fly::test::PathUtil::read_file(raw);
+            std::string const encoded = fly::test::PathUtil::read_file(encoded_file);
+
+            auto const index = create_index(encoded);
+            CATCH_REQUIRE(index);
+            CATCH_CHECK(index->decoded_size() == contents.size());
+            CATCH_CHECK(decoder.verify(std::as_bytes(std::span(encoded)), *index));
+
+            std::size_t const offset = contents.size() / 2;
+            std::string dec(4 << 10, '\0');
+
+            auto const size = decoder.decode_range(
+                std::as_bytes(std::span(encoded)),
+                *index,
+                offset,
+                std::as_writable_bytes(std::span(dec)));
+
+            CATCH_REQUIRE(size);
+            CATCH_CHECK(dec.substr(0, *size) == contents.substr(offset, dec.size()));
+        }
+    }
+}
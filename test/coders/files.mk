@@ -1,3 +1,6 @@
 SRC_$(d) := \
     $(d)/base64_coder.cpp \
-    $(d)/huffman_coder.cpp
+    $(d)/coder.cpp \
+    $(d)/container_coder.cpp \
+    $(d)/huffman_coder.cpp \
+    $(d)/lz77_coder.cpp
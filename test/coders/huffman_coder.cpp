@@ -1,18 +1,27 @@
 #include "test/util/path_util.hpp"
+#include "test/util/task_manager.hpp"
 
 #include "fly/coders/coder_config.hpp"
 #include "fly/coders/huffman/huffman_decoder.hpp"
 #include "fly/coders/huffman/huffman_encoder.hpp"
+#include "fly/task/task_runner.hpp"
 #include "fly/types/bit_stream/bit_stream_writer.hpp"
 #include "fly/types/numeric/literals.hpp"
 #include "fly/types/string/string.hpp"
 
 #include "catch2/catch_test_macros.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <limits>
+#include <span>
+#include <sstream>
+#include <streambuf>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 using namespace fly::literals::numeric_literals;
@@ -46,6 +55,115 @@ class SmallCodeLengthConfig : public fly::coders::CoderConfig
     }
 };
 
+/**
+ * Subclass of the Huffman coder config to reduce the chunk size.
+ */
+class SmallChunkSizeConfig : public fly::coders::CoderConfig
+{
+public:
+    SmallChunkSizeConfig() noexcept :
+        fly::coders::CoderConfig()
+    {
+        m_default_huffman_encoder_chunk_size_kb = 1;
+    }
+};
+
+/**
+ * Subclass of the Huffman coder config to encode chunks as interleaved bit streams.
+ */
+class InterleavedStreamsConfig : public fly::coders::CoderConfig
+{
+public:
+    InterleavedStreamsConfig() noexcept :
+        fly::coders::CoderConfig()
+    {
+        m_default_huffman_encoder_chunk_size_kb = 1;
+        m_default_huffman_encoder_interleaved_streams = true;
+    }
+};
+
+/**
+ * Subclass of the Huffman coder config to adapt the size and maximum code length of each chunk.
+ */
+class AdaptiveChunksConfig : public fly::coders::CoderConfig
+{
+public:
+    AdaptiveChunksConfig() noexcept :
+        fly::coders::CoderConfig()
+    {
+        m_default_huffman_encoder_adaptive_chunks = true;
+    }
+};
+
+/**
+ * Stream buffer which appends to a string and cannot be repositioned, as is the case for streams
+ * such as network connections.
+ */
+class AppendOnlyStreamBuffer : public std::streambuf
+{
+public:
+    std::string const &str() const
+    {
+        return m_contents;
+    }
+
+protected:
+    std::streamsize xsputn(char_type const *data, std::streamsize size) override
+    {
+        m_contents.append(data, static_cast<std::size_t>(size));
+        return size;
+    }
+
+    int_type overflow(int_type ch) override
+    {
+        if (!traits_type::eq_int_type(ch, traits_type::eof()))
+        {
+            m_contents.push_back(traits_type::to_char_type(ch));
+        }
+
+        return traits_type::not_eof(ch);
+    }
+
+private:
+    std::string m_contents;
+};
+
+/**
+ * Update a coder session with a sequence split into pieces of the given size.
+ */
+template <typename Session>
+bool update_in_pieces(Session &session, std::string_view contents, std::size_t piece_size)
+{
+    for (std::size_t i = 0; i < contents.size(); i += piece_size)
+    {
+        if (!session.update(std::as_bytes(std::span(contents.substr(i, piece_size)))))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Create a sequence whose symbol statistics shift after every period of the given size, alternating
+ * between a few skewed symbols and random alphanumeric symbols.
+ */
+std::string create_shifting_string(std::size_t size, std::size_t period)
+{
+    std::string raw = fly::String::generate_random_string(size);
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        if (((i / period) % 2) == 0)
+        {
+            raw[i] = (i % 7) == 0 ? static_cast<char>('b' + (i % 3)) : 'a';
+        }
+    }
+
+    return raw;
+}
+
 /**
  * Create a bitstream with the given bytes and number of remainder bits.
  */
@@ -334,6 +452,34 @@ CATCH_TEST_CASE("Huffman", "[coders]")
         CATCH_CHECK_FALSE(decoder.decode_string(enc, dec));
     }
 
+    CATCH_SECTION("Cannot decode stream with bits which do not begin with any code")
+    {
+        std::vector<fly::byte_type> bytes = {
+            1_u8, // Version
+            0_u8, // Chunk size KB (high)
+            1_u8, // Chunk size KB (low)
+            4_u8, // Maximum Huffman code length
+            2_u8, // Number of code length counts
+            0_u8, // Code length count 1 (high)
+            0_u8, // Code length count 1 (low)
+            0_u8, // Code length count 2 (high)
+            1_u8, // Code length count 2 (low)
+            0x41, // Single symbol (A), with the 1-bit code 0
+        };
+
+        // Symbols encoded with the code 0 may be decoded.
+        bytes.resize(bytes.size() + 4, 0x00_u8);
+        std::string dec;
+
+        CATCH_CHECK(decoder.decode_string(create_stream(bytes), dec));
+        CATCH_CHECK(dec == std::string(32, 'A'));
+
+        // Bits set to 1 do not begin with any code, and must not be decoded.
+        std::fill(bytes.end() - 4, bytes.end(), 0xff_u8);
+
+        CATCH_CHECK_FALSE(decoder.decode_string(create_stream(std::move(bytes)), dec));
+    }
+
     CATCH_SECTION("Encode and decode empty stream")
     {
         std::string const raw;
@@ -407,6 +553,32 @@ CATCH_TEST_CASE("Huffman", "[coders]")
         CATCH_CHECK(decoder.compute_kraft_mcmillan_constant() <= max_allowed_kraft);
     }
 
+    CATCH_SECTION("Limit code lengths of symbols with Fibonacci frequencies")
+    {
+        // Symbols whose frequencies follow the Fibonacci sequence form the most unbalanced Huffman
+        // codes possible, with the least common symbols having codes longer than the default
+        // maximum code length.
+        std::string raw;
+        std::size_t previous = 1, current = 1;
+
+        for (char symbol = 'a'; symbol <= 'w'; ++symbol)
+        {
+            raw.append(current, symbol);
+            current = std::exchange(previous, current) + current;
+        }
+
+        std::string enc, dec;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, enc));
+        CATCH_REQUIRE(decoder.decode_string(enc, dec));
+
+        CATCH_CHECK(raw.size() > enc.size());
+        CATCH_CHECK(raw == dec);
+
+        auto const max_allowed_kraft = (1_u16 << config->huffman_encoder_max_code_length()) - 1;
+        CATCH_CHECK(decoder.compute_kraft_mcmillan_constant() <= max_allowed_kraft);
+    }
+
     CATCH_SECTION("Encode and decode a stream with non-ASCII Unicode characters")
     {
         std::string raw = "🍕א😅😅🍕❤️א🍕";
@@ -424,12 +596,676 @@ CATCH_TEST_CASE("Huffman", "[coders]")
         CATCH_CHECK(raw == dec);
     }
 
+    CATCH_SECTION("Encode and decode streams with skewed symbol frequencies")
+    {
+        // Skewed frequencies result in short Huffman codes, which are decoded several at a time.
+        // Chunks of every size relative to the chunk size ensure multi-symbol decoding does not
+        // cross the end of a chunk or of the stream.
+        config = std::make_shared<SmallChunkSizeConfig>();
+        fly::coders::HuffmanEncoder small_chunk_encoder(config);
+
+        for (std::size_t size : {1, 2, 3, 4, 5, 1023, 1024, 1025, 1026, 1027, 1028, 4099})
+        {
+            CATCH_CAPTURE(size);
+
+            std::string raw;
+            raw.reserve(size);
+
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                raw.push_back((i % 7) == 0 ? static_cast<char>('b' + (i % 3)) : 'a');
+            }
+
+            std::string enc, dec;
+
+            CATCH_REQUIRE(small_chunk_encoder.encode_string(raw, enc));
+            CATCH_REQUIRE(decoder.decode_string(enc, dec));
+
+            CATCH_CHECK(raw == dec);
+        }
+    }
+
+    CATCH_SECTION("Concurrently encoded streams are identical to serially encoded streams")
+    {
+        auto task_runner = fly::task::ParallelTaskRunner::create(fly::test::task_manager());
+
+        config = std::make_shared<SmallChunkSizeConfig>();
+        fly::coders::HuffmanEncoder serial_encoder(config);
+        fly::coders::HuffmanEncoder concurrent_encoder(config, task_runner);
+
+        for (std::size_t size : {0, 1, 1023, 1024, 1025, 4096, 100 << 10})
+        {
+            CATCH_CAPTURE(size);
+
+            std::string const raw = fly::String::generate_random_string(size);
+            std::string serial_enc, concurrent_enc, dec;
+
+            CATCH_REQUIRE(serial_encoder.encode_string(raw, serial_enc));
+            CATCH_REQUIRE(concurrent_encoder.encode_string(raw, concurrent_enc));
+            CATCH_CHECK(serial_enc == concurrent_enc);
+
+            CATCH_REQUIRE(decoder.decode_string(concurrent_enc, dec));
+            CATCH_CHECK(raw == dec);
+        }
+    }
+
+    CATCH_SECTION("Encode and decode streams as interleaved bit streams")
+    {
+        config = std::make_shared<InterleavedStreamsConfig>();
+        fly::coders::HuffmanEncoder interleaved_encoder(config);
+
+        // Include sizes which do not split evenly into the interleaved bit streams, and sizes which
+        // result in bit streams with no symbols.
+        for (std::size_t size : {0, 1, 2, 3, 4, 5, 6, 7, 13, 1023, 1024, 1025, 1027, 100 << 10})
+        {
+            CATCH_CAPTURE(size);
+
+            std::string const raw = fly::String::generate_random_string(size);
+            std::string enc, dec;
+
+            CATCH_REQUIRE(interleaved_encoder.encode_string(raw, enc));
+            CATCH_REQUIRE(decoder.decode_string(enc, dec));
+
+            CATCH_CHECK(raw == dec);
+        }
+    }
+
+    CATCH_SECTION("Concurrently and serially encoded interleaved streams are identical")
+    {
+        auto task_runner = fly::task::ParallelTaskRunner::create(fly::test::task_manager());
+
+        config = std::make_shared<InterleavedStreamsConfig>();
+        fly::coders::HuffmanEncoder serial_encoder(config);
+        fly::coders::HuffmanEncoder concurrent_encoder(config, task_runner);
+
+        std::string const raw = fly::String::generate_random_string(100 << 10);
+        std::string serial_enc, concurrent_enc, dec;
+
+        CATCH_REQUIRE(serial_encoder.encode_string(raw, serial_enc));
+        CATCH_REQUIRE(concurrent_encoder.encode_string(raw, concurrent_enc));
+        CATCH_CHECK(serial_enc == concurrent_enc);
+
+        CATCH_REQUIRE(decoder.decode_string(concurrent_enc, dec));
+        CATCH_CHECK(raw == dec);
+    }
+
+    CATCH_SECTION("Cannot decode interleaved bit streams that have been truncated or corrupted")
+    {
+        config = std::make_shared<InterleavedStreamsConfig>();
+        fly::coders::HuffmanEncoder interleaved_encoder(config);
+
+        std::string const raw = fly::String::generate_random_string(1000);
+        std::string enc, dec;
+
+        CATCH_REQUIRE(interleaved_encoder.encode_string(raw, enc));
+
+        // Truncating the bit streams results in too few bits to read.
+        std::string const truncated = enc.substr(0, enc.size() / 2);
+        CATCH_CHECK_FALSE(decoder.decode_string(truncated, dec));
+
+        // Removing a byte from the end of the bit streams results in a stream which cannot contain
+        // every symbol.
+        std::string const shortened = enc.substr(0, enc.size() - 1);
+        CATCH_CHECK_FALSE(decoder.decode_string(shortened, dec));
+    }
+
+    CATCH_SECTION("Cannot decode interleaved bit streams larger than their symbols could encode")
+    {
+        // Two symbols with 1-bit codes, in 4 bit streams which each hold 8 symbols.
+        auto create_interleaved_stream = [](fly::byte_type stream_size) {
+            std::vector<fly::byte_type> bytes = {
+                2_u8, // Version
+                0_u8, // Chunk size KB (high)
+                1_u8, // Chunk size KB (low)
+                4_u8, // Maximum Huffman code length
+                2_u8, // Number of code length counts
+                0_u8, // Code length count 1 (high)
+                0_u8, // Code length count 1 (low)
+                0_u8, // Code length count 2 (high)
+                2_u8, // Code length count 2 (low)
+                0x41, // Symbol (A), with the 1-bit code 0
+                0x42, // Symbol (B), with the 1-bit code 1
+                0_u8, // Symbol count
+                0_u8, // Symbol count
+                0_u8, // Symbol count
+                32_u8, // Symbol count
+            };
+
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                bytes.insert(bytes.end(), {0_u8, 0_u8, 0_u8, stream_size}); // Bit stream size
+            }
+
+            bytes.resize(bytes.size() + (4 * stream_size), 0x0f_u8);
+            return create_stream(std::move(bytes));
+        };
+
+        std::string dec;
+
+        CATCH_CHECK(decoder.decode_string(create_interleaved_stream(1_u8), dec));
+        CATCH_CHECK(dec == "AAAABBBBAAAABBBBAAAABBBBAAAABBBB");
+
+        // Each bit stream could hold 8 symbols with codes of up to 16 bits, but the 32 symbols of
+        // the chunk cannot need more than 4 bytes with its 1-bit codes, plus zero-fill.
+        CATCH_CHECK_FALSE(decoder.decode_string(create_interleaved_stream(3_u8), dec));
+    }
+
+    CATCH_SECTION("Encode and decode buffers identically to strings")
+    {
+        auto task_runner = fly::task::ParallelTaskRunner::create(fly::test::task_manager());
+
+        config = std::make_shared<SmallChunkSizeConfig>();
+        fly::coders::HuffmanEncoder small_chunk_encoder(config);
+        fly::coders::HuffmanEncoder concurrent_encoder(config, task_runner);
+
+        config = std::make_shared<InterleavedStreamsConfig>();
+        fly::coders::HuffmanEncoder interleaved_encoder(config);
+
+        for (auto *buffer_encoder :
+             {&encoder, &small_chunk_encoder, &concurrent_encoder, &interleaved_encoder})
+        {
+            for (std::size_t size : {0, 1, 2, 1023, 1024, 1025, 4096, 100 << 10})
+            {
+                CATCH_CAPTURE(size);
+
+                std::string const raw = fly::String::generate_random_string(size);
+                auto const raw_bytes = std::as_bytes(std::span(raw));
+
+                std::string enc;
+                CATCH_REQUIRE(buffer_encoder->encode_string(raw, enc));
+
+                std::vector<std::byte> growable_enc;
+                CATCH_REQUIRE(buffer_encoder->encode_buffer(raw_bytes, growable_enc));
+                CATCH_CHECK(enc.size() == growable_enc.size());
+                CATCH_CHECK(std::equal(
+                    growable_enc.begin(),
+                    growable_enc.end(),
+                    std::as_bytes(std::span(enc)).begin()));
+
+                std::vector<std::byte> fixed_enc(buffer_encoder->max_encoded_size(raw.size()));
+                auto const encoded_size =
+                    buffer_encoder->encode_buffer(raw_bytes, std::span(fixed_enc));
+                CATCH_REQUIRE(encoded_size);
+                CATCH_CHECK(*encoded_size == enc.size());
+
+                std::vector<std::byte> growable_dec;
+                CATCH_REQUIRE(decoder.decode_buffer(growable_enc, growable_dec));
+                CATCH_CHECK(growable_dec.size() == raw.size());
+                CATCH_CHECK(
+                    std::equal(growable_dec.begin(), growable_dec.end(), raw_bytes.begin()));
+
+                std::vector<std::byte> fixed_dec(raw.size());
+                auto const decoded_size = decoder.decode_buffer(growable_enc, std::span(fixed_dec));
+                CATCH_REQUIRE(decoded_size);
+                CATCH_CHECK(*decoded_size == raw.size());
+                CATCH_CHECK(std::equal(fixed_dec.begin(), fixed_dec.end(), raw_bytes.begin()));
+            }
+        }
+    }
+
+    CATCH_SECTION("Encoded buffers do not exceed the maximum encoded size")
+    {
+        config = std::make_shared<InterleavedStreamsConfig>();
+        fly::coders::HuffmanEncoder interleaved_encoder(config);
+
+        std::vector<std::byte> uniform(5000);
+
+        for (std::size_t i = 0; i < uniform.size(); ++i)
+        {
+            uniform[i] = static_cast<std::byte>(i);
+        }
+
+        std::vector<std::vector<std::byte>> const inputs {
+            {},
+            {std::byte('a')},
+            std::vector<std::byte>(5000, std::byte('a')),
+            uniform,
+        };
+
+        for (auto *buffer_encoder : {&encoder, &interleaved_encoder})
+        {
+            for (auto const &raw : inputs)
+            {
+                CATCH_CAPTURE(raw.size());
+
+                std::vector<std::byte> enc;
+                CATCH_REQUIRE(buffer_encoder->encode_buffer(raw, enc));
+                CATCH_CHECK(enc.size() <= buffer_encoder->max_encoded_size(raw.size()));
+                CATCH_CHECK(raw.size() <= decoder.max_decoded_size(enc.size()));
+            }
+        }
+    }
+
+    CATCH_SECTION("Cannot encode or decode into buffers which are too small")
+    {
+        std::string const raw = fly::String::generate_random_string(1000);
+        auto const raw_bytes = std::as_bytes(std::span(raw));
+
+        std::vector<std::byte> enc;
+        CATCH_REQUIRE(encoder.encode_buffer(raw_bytes, enc));
+
+        std::vector<std::byte> small(enc.size() - 1);
+        CATCH_CHECK_FALSE(encoder.encode_buffer(raw_bytes, std::span(small)));
+
+        small.resize(raw.size() - 1);
+        CATCH_CHECK_FALSE(decoder.decode_buffer(enc, std::span(small)));
+    }
+
+    CATCH_SECTION("Encoder sessions produce streams identical to interleaved encoding")
+    {
+        config = std::make_shared<InterleavedStreamsConfig>();
+        fly::coders::HuffmanEncoder interleaved_encoder(config);
+
+        config = std::make_shared<SmallChunkSizeConfig>();
+        fly::coders::HuffmanEncoder small_chunk_encoder(config);
+
+        for (std::size_t size : {0, 1, 2, 1023, 1024, 1025, 4096, 10 << 10})
+        {
+            std::string const raw = fly::String::generate_random_string(size);
+            std::string expected;
+
+            CATCH_REQUIRE(interleaved_encoder.encode_string(raw, expected));
+
+            for (std::size_t piece_size : {1, 7, 1000, 1024, 5000})
+            {
+                CATCH_CAPTURE(size, piece_size);
+
+                // Sessions always encode interleaved bit streams, regardless of configuration.
+                std::ostringstream enc;
+                auto session = small_chunk_encoder.create_encoder_session(enc);
+
+                CATCH_REQUIRE(update_in_pieces(*session, raw, piece_size));
+                CATCH_REQUIRE(session->finish());
+                CATCH_CHECK(enc.str() == expected);
+            }
+        }
+    }
+
+    CATCH_SECTION("Encoder sessions write to streams which cannot be repositioned")
+    {
+        config = std::make_shared<InterleavedStreamsConfig>();
+        fly::coders::HuffmanEncoder interleaved_encoder(config);
+
+        config = std::make_shared<SmallChunkSizeConfig>();
+        fly::coders::HuffmanEncoder small_chunk_encoder(config);
+
+        std::string const raw = fly::String::generate_random_string(10 << 10);
+        std::string expected, dec;
+
+        CATCH_REQUIRE(interleaved_encoder.encode_string(raw, expected));
+
+        AppendOnlyStreamBuffer buffer;
+        std::ostream enc(&buffer);
+
+        auto session = small_chunk_encoder.create_encoder_session(enc);
+        CATCH_REQUIRE(update_in_pieces(*session, raw, 100));
+        CATCH_REQUIRE(session->finish());
+
+        CATCH_CHECK(buffer.str() == expected);
+        CATCH_REQUIRE(decoder.decode_string(buffer.str(), dec));
+        CATCH_CHECK(raw == dec);
+    }
+
+    CATCH_SECTION("Decoder sessions decode streams provided in pieces")
+    {
+        config = std::make_shared<SmallChunkSizeConfig>();
+        fly::coders::HuffmanEncoder small_chunk_encoder(config);
+
+        config = std::make_shared<InterleavedStreamsConfig>();
+        fly::coders::HuffmanEncoder interleaved_encoder(config);
+
+        for (auto *session_encoder : {&encoder, &small_chunk_encoder, &interleaved_encoder})
+        {
+            for (std::size_t size : {1, 2, 1023, 1024, 1025, 10 << 10})
+            {
+                std::string const raw = fly::String::generate_random_string(size);
+                std::string enc;
+
+                CATCH_REQUIRE(session_encoder->encode_string(raw, enc));
+
+                for (std::size_t piece_size : {1, 7, 100, 1024, 5000})
+                {
+                    CATCH_CAPTURE(size, piece_size);
+
+                    std::ostringstream dec;
+                    auto session = decoder.create_decoder_session(dec);
+
+                    CATCH_REQUIRE(update_in_pieces(*session, enc, piece_size));
+                    CATCH_REQUIRE(session->finish());
+                    CATCH_CHECK(dec.str() == raw);
+                }
+            }
+        }
+    }
+
+    CATCH_SECTION("Decoder sessions decode chunks before the session is finished")
+    {
+        config = std::make_shared<SmallChunkSizeConfig>();
+        fly::coders::HuffmanEncoder small_chunk_encoder(config);
+
+        std::string const raw = fly::String::generate_random_string(100 << 10);
+        std::string enc;
+
+        CATCH_REQUIRE(small_chunk_encoder.encode_string(raw, enc));
+
+        std::ostringstream dec;
+        auto session = decoder.create_decoder_session(dec);
+
+        CATCH_REQUIRE(session->update(std::as_bytes(std::span(enc))));
+        CATCH_CHECK(dec.str().size() > 0);
+        CATCH_CHECK(dec.str().size() < raw.size());
+
+        CATCH_REQUIRE(session->finish());
+        CATCH_CHECK(dec.str() == raw);
+    }
+
+    CATCH_SECTION("Cannot decode truncated or corrupted streams with sessions")
+    {
+        config = std::make_shared<InterleavedStreamsConfig>();
+        fly::coders::HuffmanEncoder interleaved_encoder(config);
+
+        std::string const raw = fly::String::generate_random_string(10 << 10);
+        std::string enc;
+
+        CATCH_REQUIRE(interleaved_encoder.encode_string(raw, enc));
+
+        std::ostringstream truncated_dec;
+        auto truncated_session = decoder.create_decoder_session(truncated_dec);
+
+        std::string const truncated = enc.substr(0, enc.size() - 1);
+        CATCH_REQUIRE(update_in_pieces(*truncated_session, truncated, 100));
+        CATCH_CHECK_FALSE(truncated_session->finish());
+
+        std::ostringstream corrupted_dec;
+        auto corrupted_session = decoder.create_decoder_session(corrupted_dec);
+
+        std::string const corrupted = create_stream({3});
+        CATCH_REQUIRE(corrupted_session->update(std::as_bytes(std::span(corrupted))));
+        CATCH_CHECK_FALSE(corrupted_session->finish());
+        CATCH_CHECK_FALSE(corrupted_session->update(std::as_bytes(std::span(enc))));
+    }
+
+    CATCH_SECTION("Cannot encode with sessions using an invalid configuration")
+    {
+        config = std::make_shared<BadCoderConfig>();
+        fly::coders::HuffmanEncoder bad_encoder(config);
+
+        std::ostringstream enc;
+        auto session = bad_encoder.create_encoder_session(enc);
+
+        CATCH_CHECK_FALSE(session->update(std::as_bytes(std::span("abc", 3))));
+        CATCH_CHECK_FALSE(session->finish());
+    }
+
+    CATCH_SECTION("Encode and decode streams with adaptive chunks")
+    {
+        config = std::make_shared<AdaptiveChunksConfig>();
+        fly::coders::HuffmanEncoder adaptive_encoder(config);
+
+        // Include sizes around the size of the regions which adaptive chunks are formed from.
+        for (std::size_t size : {0, 1, 2, 16383, 16384, 16385, 100 << 10, 600 << 10})
+        {
+            CATCH_CAPTURE(size);
+
+            for (std::string const &raw :
+                 {fly::String::generate_random_string(size), create_shifting_string(size, 20000)})
+            {
+                std::string enc, dec;
+
+                CATCH_REQUIRE(adaptive_encoder.encode_string(raw, enc));
+                CATCH_REQUIRE(decoder.decode_string(enc, dec));
+
+                CATCH_CHECK(raw == dec);
+            }
+        }
+    }
+
+    CATCH_SECTION("Adaptive chunks are split where the symbol statistics of a stream shift")
+    {
+        config = std::make_shared<AdaptiveChunksConfig>();
+        fly::coders::HuffmanEncoder adaptive_encoder(config);
+
+        // Every 32 KB period fits within a single fixed chunk, which must share codes between the
+        // skewed and random symbols.
+        std::string const raw = create_shifting_string(256 << 10, 32 << 10);
+        std::string fixed_enc, adaptive_enc, dec;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, fixed_enc));
+        CATCH_REQUIRE(adaptive_encoder.encode_string(raw, adaptive_enc));
+        CATCH_CHECK(adaptive_enc.size() < fixed_enc.size());
+
+        CATCH_REQUIRE(decoder.decode_string(adaptive_enc, dec));
+        CATCH_CHECK(raw == dec);
+
+        // Streams with stable statistics are not split, so only differ by the interleaved format.
+        std::string const stable = fly::String::generate_random_string(256 << 10);
+
+        CATCH_REQUIRE(encoder.encode_string(stable, fixed_enc));
+        CATCH_REQUIRE(adaptive_encoder.encode_string(stable, adaptive_enc));
+        CATCH_CHECK(adaptive_enc.size() <= (fixed_enc.size() + 32));
+    }
+
+    CATCH_SECTION("Adaptive chunks limit code lengths to the shortest length with a similar size")
+    {
+        config = std::make_shared<AdaptiveChunksConfig>();
+        fly::coders::HuffmanEncoder adaptive_encoder(config);
+
+        // A few common symbols, some uncommon symbols, and symbols which occur only once. The rare
+        // symbols have optimal Huffman codes longer than the default maximum code length, but
+        // limiting their codes to a shorter length only lengthens the codes of uncommon symbols.
+        std::string raw(100 << 10, '\0');
+
+        for (std::size_t i = 0; i < raw.size(); ++i)
+        {
+            raw[i] = static_cast<char>('a' + (i % 4));
+        }
+
+        for (std::size_t i = 0; i < 400; ++i)
+        {
+            raw[i * 200 + 1] = static_cast<char>('e' + (i % 20));
+        }
+
+        for (std::size_t i = 0; i < 40; ++i)
+        {
+            raw[i * 2000] = static_cast<char>(0x80 + i);
+        }
+
+        std::string fixed_enc, adaptive_enc, dec;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, fixed_enc));
+        CATCH_REQUIRE(adaptive_encoder.encode_string(raw, adaptive_enc));
+
+        // Following the BitStream header and the Huffman header, the first byte of the chunk is the
+        // number of code length counts, which is one more than the chunk's maximum code length.
+        static constexpr std::size_t s_counts_size_position = 5;
+
+        auto const fixed_max_code_length =
+            static_cast<std::uint8_t>(fixed_enc[s_counts_size_position]) - 1;
+        auto const adaptive_max_code_length =
+            static_cast<std::uint8_t>(adaptive_enc[s_counts_size_position]) - 1;
+
+        CATCH_CHECK(fixed_max_code_length == config->huffman_encoder_max_code_length());
+        CATCH_CHECK(adaptive_max_code_length < fixed_max_code_length);
+
+        // The shorter codes cost at most 1/512 of the encoded size, plus the interleaved format.
+        CATCH_CHECK((adaptive_enc.size() * 512) <= ((fixed_enc.size() + 32) * 513));
+
+        CATCH_REQUIRE(decoder.decode_string(adaptive_enc, dec));
+        CATCH_CHECK(raw == dec);
+    }
+
+    CATCH_SECTION("Adaptive chunks may limit a power-of-two number of symbols to equal lengths")
+    {
+        config = std::make_shared<AdaptiveChunksConfig>();
+        fly::coders::HuffmanEncoder adaptive_encoder(config);
+
+        // Four nearly uniform symbols have optimal Huffman codes of lengths 1, 2, 3, and 3, but
+        // codes which are all 2 bits long cost less than 1/512 of the encoded size.
+        std::string raw(100000, '\0');
+
+        for (std::size_t i = 0; i < raw.size(); ++i)
+        {
+            std::size_t const position = (i * 7919) % 10000;
+
+            if (position < 3334)
+            {
+                raw[i] = 'a';
+            }
+            else if (position < 6668)
+            {
+                raw[i] = 'b';
+            }
+            else if (position < 8334)
+            {
+                raw[i] = 'c';
+            }
+            else
+            {
+                raw[i] = 'd';
+            }
+        }
+
+        std::string fixed_enc, adaptive_enc, dec;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, fixed_enc));
+        CATCH_REQUIRE(adaptive_encoder.encode_string(raw, adaptive_enc));
+
+        static constexpr std::size_t s_counts_size_position = 5;
+
+        auto const fixed_max_code_length =
+            static_cast<std::uint8_t>(fixed_enc[s_counts_size_position]) - 1;
+        auto const adaptive_max_code_length =
+            static_cast<std::uint8_t>(adaptive_enc[s_counts_size_position]) - 1;
+
+        CATCH_CHECK(fixed_max_code_length == 3);
+        CATCH_CHECK(adaptive_max_code_length == 2);
+
+        CATCH_REQUIRE(decoder.decode_string(adaptive_enc, dec));
+        CATCH_CHECK(raw == dec);
+    }
+
+    CATCH_SECTION("Adaptive chunks are encoded identically concurrently, serially, and by sessions")
+    {
+        auto task_runner = fly::task::ParallelTaskRunner::create(fly::test::task_manager());
+
+        config = std::make_shared<AdaptiveChunksConfig>();
+        fly::coders::HuffmanEncoder serial_encoder(config);
+        fly::coders::HuffmanEncoder concurrent_encoder(config, task_runner);
+
+        std::string const raw = create_shifting_string(600 << 10, 20000);
+        std::string serial_enc, concurrent_enc, dec;
+
+        CATCH_REQUIRE(serial_encoder.encode_string(raw, serial_enc));
+        CATCH_REQUIRE(concurrent_encoder.encode_string(raw, concurrent_enc));
+        CATCH_CHECK(serial_enc == concurrent_enc);
+
+        std::ostringstream session_enc;
+        auto session = serial_encoder.create_encoder_session(session_enc);
+
+        CATCH_REQUIRE(update_in_pieces(*session, raw, 5000));
+        CATCH_REQUIRE(session->finish());
+        CATCH_CHECK(session_enc.str() == serial_enc);
+
+        std::vector<std::byte> enc(serial_encoder.max_encoded_size(raw.size()));
+        auto const encoded_size =
+            serial_encoder.encode_buffer(std::as_bytes(std::span(raw)), std::span(enc));
+        CATCH_REQUIRE(encoded_size);
+        CATCH_CHECK(*encoded_size == serial_enc.size());
+
+        CATCH_REQUIRE(decoder.decode_string(serial_enc, dec));
+        CATCH_CHECK(raw == dec);
+    }
+
+    CATCH_SECTION("Stages of encoding are only timed while stage timing is enabled")
+    {
+        auto task_runner = fly::task::ParallelTaskRunner::create(fly::test::task_manager());
+        fly::coders::HuffmanEncoder concurrent_encoder(config, task_runner);
+
+        std::string const raw = fly::String::generate_random_string(1 << 20);
+        std::string enc, timed_enc;
+
+        auto time_stages = [&](fly::coders::HuffmanEncoder &timed_encoder) {
+            CATCH_REQUIRE(timed_encoder.encode_string(raw, enc));
+
+            fly::coders::HuffmanEncoderStages const &stages = timed_encoder.stage_durations();
+            CATCH_CHECK(stages.m_histogram.count() == 0);
+            CATCH_CHECK(stages.m_tree.count() == 0);
+            CATCH_CHECK(stages.m_emission.count() == 0);
+            CATCH_CHECK(stages.m_bit_io.count() == 0);
+
+            timed_encoder.set_stage_timing(true);
+            CATCH_REQUIRE(timed_encoder.encode_string(raw, timed_enc));
+            CATCH_CHECK(timed_enc == enc);
+
+            CATCH_CHECK(stages.m_histogram.count() > 0);
+            CATCH_CHECK(stages.m_tree.count() > 0);
+            CATCH_CHECK(stages.m_emission.count() > 0);
+            CATCH_CHECK(stages.m_bit_io.count() > 0);
+
+            // Re-enabling stage timing resets the time spent in each stage.
+            timed_encoder.set_stage_timing(true);
+            CATCH_CHECK(stages.m_emission.count() == 0);
+
+            timed_encoder.set_stage_timing(false);
+            CATCH_REQUIRE(timed_encoder.encode_string(raw, timed_enc));
+            CATCH_CHECK(stages.m_emission.count() == 0);
+        };
+
+        time_stages(encoder);
+        time_stages(concurrent_encoder);
+    }
+
     CATCH_SECTION("File tests")
     {
         fly::test::PathUtil::ScopedTempDirectory path;
         std::filesystem::path encoded_file = path.file();
         std::filesystem::path decoded_file = path.file();
 
+        CATCH_SECTION("Encode and decode an empty file")
+        {
+            std::filesystem::path const raw = path.file();
+            CATCH_REQUIRE(fly::test::PathUtil::write_file(raw, std::string()));
+
+            CATCH_REQUIRE(encoder.encode_file(raw, encoded_file));
+            CATCH_REQUIRE(decoder.decode_file(encoded_file, decoded_file));
+
+            CATCH_CHECK(std::filesystem::file_size(decoded_file) == 0);
+        }
+
+        CATCH_SECTION("Encoding and decoding files truncates existing output files")
+        {
+            std::string const contents = fly::String::generate_random_string(1 << 10);
+            std::string const existing = fly::String::generate_random_string(100 << 10);
+
+            std::filesystem::path const raw = path.file();
+            CATCH_REQUIRE(fly::test::PathUtil::write_file(raw, contents));
+            CATCH_REQUIRE(fly::test::PathUtil::write_file(encoded_file, existing));
+            CATCH_REQUIRE(fly::test::PathUtil::write_file(decoded_file, existing));
+
+            std::string expected;
+            CATCH_REQUIRE(encoder.encode_string(contents, expected));
+
+            CATCH_REQUIRE(encoder.encode_file(raw, encoded_file));
+            CATCH_CHECK(fly::test::PathUtil::read_file(encoded_file) == expected);
+
+            CATCH_REQUIRE(decoder.decode_file(encoded_file, decoded_file));
+            CATCH_CHECK(fly::test::PathUtil::read_file(decoded_file) == contents);
+        }
+
+        CATCH_SECTION("Cannot encode or decode files which do not exist")
+        {
+            std::filesystem::path const missing = path.file();
+
+            CATCH_CHECK_FALSE(encoder.encode_file(missing, encoded_file));
+            CATCH_CHECK_FALSE(decoder.decode_file(missing, decoded_file));
+        }
+
+        CATCH_SECTION("Cannot decode a corrupted file")
+        {
+            CATCH_REQUIRE(fly::test::PathUtil::write_file(encoded_file, create_stream({3})));
+            CATCH_CHECK_FALSE(decoder.decode_file(encoded_file, decoded_file));
+        }
+
         CATCH_SECTION("Encode and decode a large file containing only ASCII symbols")
         {
             // Generated with:
@@ -442,6 +1278,16 @@ CATCH_TEST_CASE("Huffman", "[coders]")
 
             CATCH_CHECK(std::filesystem::file_size(raw) > std::filesystem::file_size(encoded_file));
             CATCH_CHECK(fly::test::PathUtil::compare_files(raw, decoded_file));
+
+            // Encoding the file's contents as a buffer should be identical to encoding the file.
+            std::string const contents = fly::test::PathUtil::read_file(raw);
+            std::string const expected = fly::test::PathUtil::read_file(encoded_file);
+
+            std::vector<std::byte> enc;
+            CATCH_REQUIRE(encoder.encode_buffer(std::as_bytes(std::span(contents)), enc));
+            CATCH_CHECK(enc.size() == expected.size());
+            CATCH_CHECK(
+                std::equal(enc.begin(), enc.end(), std::as_bytes(std::span(expected)).begin()));
         }
 
         CATCH_SECTION("Encode and decode a large file containing ASCII and non-ASCII symbols")
@@ -456,5 +1302,52 @@ CATCH_TEST_CASE("Huffman", "[coders]")
 
             CATCH_CHECK(fly::test::PathUtil::compare_files(raw, decoded_file));
         }
+
+        CATCH_SECTION("Concurrently encode and decode a large file")
+        {
+            auto const here = std::filesystem::path(__FILE__).parent_path();
+            auto const raw = here / "data" / "test.txt";
+
+            auto task_runner = fly::task::ParallelTaskRunner::create(fly::test::task_manager());
+            fly::coders::HuffmanEncoder concurrent_encoder(config, task_runner);
+
+            CATCH_REQUIRE(concurrent_encoder.encode_file(raw, encoded_file));
+            CATCH_REQUIRE(decoder.decode_file(encoded_file, decoded_file));
+
+            CATCH_CHECK(fly::test::PathUtil::compare_files(raw, decoded_file));
+
+            CATCH_REQUIRE(encoder.encode_file(raw, decoded_file));
+            CATCH_CHECK(fly::test::PathUtil::compare_files(encoded_file, decoded_file));
+        }
+
+        CATCH_SECTION("Encode and decode a large file as interleaved bit streams")
+        {
+            auto const here = std::filesystem::path(__FILE__).parent_path();
+            auto const raw = here / "data" / "test.txt";
+
+            config = std::make_shared<InterleavedStreamsConfig>();
+            fly::coders::HuffmanEncoder interleaved_encoder(config);
+
+            CATCH_REQUIRE(interleaved_encoder.encode_file(raw, encoded_file));
+            CATCH_REQUIRE(decoder.decode_file(encoded_file, decoded_file));
+
+            CATCH_CHECK(std::filesystem::file_size(raw) > std::filesystem::file_size(encoded_file));
+            CATCH_CHECK(fly::test::PathUtil::compare_files(raw, decoded_file));
+        }
+
+        CATCH_SECTION("Encode and decode a large file with adaptive chunks")
+        {
+            auto const here = std::filesystem::path(__FILE__).parent_path();
+            auto const raw = here / "data" / "test.txt";
+
+            config = std::make_shared<AdaptiveChunksConfig>();
+            fly::coders::HuffmanEncoder adaptive_encoder(config);
+
+            CATCH_REQUIRE(adaptive_encoder.encode_file(raw, encoded_file));
+            CATCH_REQUIRE(decoder.decode_file(encoded_file, decoded_file));
+
+            CATCH_CHECK(std::filesystem::file_size(raw) > std::filesystem::file_size(encoded_file));
+            CATCH_CHECK(fly::test::PathUtil::compare_files(raw, decoded_file));
+        }
     }
 }
@@ -0,0 +1,766 @@
+#include "test/util/path_util.hpp"
+
+#include "fly/coders/coder_config.hpp"
+#include "fly/coders/lz77/lz77_decoder.hpp"
+#include "fly/coders/lz77/lz77_encoder.hpp"
+#include "fly/types/bit_stream/bit_stream_writer.hpp"
+#include "fly/types/numeric/literals.hpp"
+#include "fly/types/string/string.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace fly::literals::numeric_literals;
+
+namespace {
+
+/**
+ * Subclass of the coder config to contain invalid values.
+ */
+class BadCoderConfig : public fly::coders::CoderConfig
+{
+public:
+    BadCoderConfig() noexcept :
+        fly::coders::CoderConfig()
+    {
+        m_default_lz77_encoder_block_size_kb = 0;
+    }
+};
+
+/**
+ * Subclass of the coder config to reduce the block size.
+ */
+class SmallBlockSizeConfig : public fly::coders::CoderConfig
+{
+public:
+    SmallBlockSizeConfig() noexcept :
+        fly::coders::CoderConfig()
+    {
+        m_default_lz77_encoder_block_size_kb = 1;
+    }
+};
+
+/**
+ * Subclass of the coder config to Huffman encode the literals and sequences of each block.
+ */
+class HuffmanStreamsConfig : public fly::coders::CoderConfig
+{
+public:
+    HuffmanStreamsConfig() noexcept :
+        fly::coders::CoderConfig()
+    {
+        m_default_lz77_encoder_huffman_streams = true;
+    }
+};
+
+/**
+ * Subclass of the coder config to disable searching the hash chains for matches, so that only the
+ * most recent occurrence of each hash is considered.
+ */
+class NoChainConfig : public fly::coders::CoderConfig
+{
+public:
+    NoChainConfig() noexcept :
+        fly::coders::CoderConfig()
+    {
+        m_default_lz77_encoder_max_chain_length = 0;
+    }
+};
+
+/**
+ * Update a coder session with a sequence split into pieces of the given size.
+ */
+template <typename Session>
+bool update_in_pieces(Session &session, std::string_view contents, std::size_t piece_size)
+{
+    for (std::size_t i = 0; i < contents.size(); i += piece_size)
+    {
+        if (!session.update(std::as_bytes(std::span(contents.substr(i, piece_size)))))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Create a bitstream with the given bytes.
+ */
+std::string create_stream(std::vector<fly::byte_type> bytes)
+{
+    std::ostringstream stream(std::ios::out | std::ios::binary);
+    fly::BitStreamWriter output(stream);
+
+    for (fly::byte_type const &byte : bytes)
+    {
+        output.write_byte(byte);
+    }
+
+    CATCH_REQUIRE(output.finish());
+    return stream.str();
+}
+
+/**
+ * Create a bitstream holding a valid header with a 1 KB block size, followed by the given bytes.
+ */
+std::string create_stream_with_header(std::vector<fly::byte_type> bytes)
+{
+    std::vector<fly::byte_type> header = {
+        1_u8, // Version
+        0_u8, // Block size KB (high)
+        1_u8, // Block size KB (low)
+    };
+
+    header.insert(header.end(), bytes.begin(), bytes.end());
+    return create_stream(std::move(header));
+}
+
+/**
+ * Create a sequence of text made of randomly chosen words, which contains many repeated
+ * subsequences.
+ */
+std::string create_repetitive_string(std::size_t size)
+{
+    std::vector<std::string> words;
+
+    for (std::size_t i = 0; i < 64; ++i)
+    {
+        words.push_back(fly::String::generate_random_string(3 + (i % 10)));
+    }
+
+    std::string result;
+    std::uint32_t state = 0x12345678;
+
+    while (result.size() < size)
+    {
+        state = state * 1664525 + 1013904223;
+        result += words[(state >> 16) % words.size()];
+        result += ' ';
+    }
+
+    result.resize(size);
+    return result;
+}
+
+} // namespace
+
+CATCH_TEST_CASE("LZ77", "[coders]")
+{
+    auto config = std::make_shared<fly::coders::CoderConfig>();
+
+    fly::coders::Lz77Encoder encoder(config);
+    fly::coders::Lz77Decoder decoder;
+
+    CATCH_SECTION("Cannot encode stream using an invalid configuration")
+    {
+        std::string const raw;
+        std::string enc;
+
+        config = std::make_shared<BadCoderConfig>();
+        fly::coders::Lz77Encoder bad_encoder(config);
+
+        CATCH_CHECK_FALSE(bad_encoder.encode_string(raw, enc));
+    }
+
+    CATCH_SECTION("Cannot decode stream missing the encoder's version")
+    {
+        std::string const enc;
+        std::string dec;
+
+        CATCH_CHECK_FALSE(decoder.decode_string(enc, dec));
+    }
+
+    CATCH_SECTION("Cannot decode stream with an invalid encoder version")
+    {
+        std::string const enc = create_stream({
+            0_u8, // Version
+        });
+        std::string dec;
+
+        CATCH_CHECK_FALSE(enc.empty());
+        CATCH_CHECK_FALSE(decoder.decode_string(enc, dec));
+    }
+
+    CATCH_SECTION("Cannot decode stream missing the encoder's configured block size")
+    {
+        std::string const enc = create_stream({
+            1_u8, // Version
+        });
+        std::string dec;
+
+        CATCH_CHECK_FALSE(enc.empty());
+        CATCH_CHECK_FALSE(decoder.decode_string(enc, dec));
+    }
+
+    CATCH_SECTION("Cannot decode stream with an invalid encoder block size")
+    {
+        std::string const enc = create_stream({
+            1_u8, // Version
+            0_u8, // Block size KB (high)
+            0_u8, // Block size KB (low)
+        });
+        std::string dec;
+
+        CATCH_CHECK_FALSE(enc.empty());
+        CATCH_CHECK_FALSE(decoder.decode_string(enc, dec));
+    }
+
+    CATCH_SECTION("Cannot decode stream with a block larger than the encoder block size")
+    {
+        std::string const enc = create_stream_with_header({
+            0_u8, 0_u8, 4_u8, 1_u8, // Block size (1025 bytes)
+        });
+        std::string dec;
+
+        CATCH_CHECK_FALSE(decoder.decode_string(enc, dec));
+    }
+
+    CATCH_SECTION("Cannot decode stream with an invalid stream mode")
+    {
+        std::string const enc = create_stream_with_header({
+            0_u8, 0_u8, 0_u8, 1_u8, // Block size
+            2_u8, // Literals stream mode
+            0_u8, 0_u8, 0_u8, 1_u8, // Literals stream size
+            0x41, // Literals
+        });
+        std::string dec;
+
+        CATCH_CHECK_FALSE(decoder.decode_string(enc, dec));
+    }
+
+    CATCH_SECTION("Cannot decode stream with more literals than the block size")
+    {
+        std::string const enc = create_stream_with_header({
+            0_u8, 0_u8, 0_u8, 1_u8, // Block size
+            0_u8, // Literals stream mode
+            0_u8, 0_u8, 0_u8, 2_u8, // Literals stream size
+            0x41, 0x41, // Literals
+        });
+        std::string dec;
+
+        CATCH_CHECK_FALSE(decoder.decode_string(enc, dec));
+    }
+
+    CATCH_SECTION("Cannot decode stream missing its sequences")
+    {
+        std::string const enc = create_stream_with_header({
+            0_u8, 0_u8, 0_u8, 1_u8, // Block size
+            0_u8, // Literals stream mode
+            0_u8, 0_u8, 0_u8, 1_u8, // Literals stream size
+            0x41, // Literals
+        });
+        std::string dec;
+
+        CATCH_CHECK_FALSE(decoder.decode_string(enc, dec));
+    }
+
+    CATCH_SECTION("Decode a minimal valid stream")
+    {
+        std::string const enc = create_stream_with_header({
+            0_u8, 0_u8, 0_u8, 1_u8, // Block size
+            0_u8, // Literals stream mode
+            0_u8, 0_u8, 0_u8, 1_u8, // Literals stream size
+            0x41, // Literals
+            0_u8, // Sequences stream mode
+            0_u8, 0_u8, 0_u8, 1_u8, // Sequences stream size
+            0x10, // Final sequence (1 literal)
+        });
+        std::string dec;
+
+        CATCH_REQUIRE(decoder.decode_string(enc, dec));
+        CATCH_CHECK(dec == "A");
+    }
+
+    CATCH_SECTION("Decode a stream with a match which overlaps the bytes being copied")
+    {
+        std::string const enc = create_stream_with_header({
+            0_u8, 0_u8, 0_u8, 21_u8, // Block size
+            0_u8, // Literals stream mode
+            0_u8, 0_u8, 0_u8, 1_u8, // Literals stream size
+            0x41, // Literals
+            0_u8, // Sequences stream mode
+            0_u8, 0_u8, 0_u8, 5_u8, // Sequences stream size
+            0x1f, // Sequence (1 literal, extended match length)
+            1_u8, 0_u8, // Match offset
+            1_u8, // Match length extension (4 + 15 + 1 = 20)
+            0x00, // Final sequence (0 literals)
+        });
+        std::string dec;
+
+        CATCH_REQUIRE(decoder.decode_string(enc, dec));
+        CATCH_CHECK(dec == std::string(21, 'A'));
+    }
+
+    CATCH_SECTION("Cannot decode stream with a match offset of zero")
+    {
+        std::string const enc = create_stream_with_header({
+            0_u8, 0_u8, 0_u8, 5_u8, // Block size
+            0_u8, // Literals stream mode
+            0_u8, 0_u8, 0_u8, 1_u8, // Literals stream size
+            0x41, // Literals
+            0_u8, // Sequences stream mode
+            0_u8, 0_u8, 0_u8, 3_u8, // Sequences stream size
+            0x10, // Sequence (1 literal, match length 4)
+            0_u8, 0_u8, // Match offset
+        });
+        std::string dec;
+
+        CATCH_CHECK_FALSE(decoder.decode_string(enc, dec));
+    }
+
+    CATCH_SECTION("Cannot decode stream with a match offset before the start of the block")
+    {
+        std::string const enc = create_stream_with_header({
+            0_u8, 0_u8, 0_u8, 5_u8, // Block size
+            0_u8, // Literals stream mode
+            0_u8, 0_u8, 0_u8, 1_u8, // Literals stream size
+            0x41, // Literals
+            0_u8, // Sequences stream mode
+            0_u8, 0_u8, 0_u8, 3_u8, // Sequences stream size
+            0x10, // Sequence (1 literal, match length 4)
+            2_u8, 0_u8, // Match offset
+        });
+        std::string dec;
+
+        CATCH_CHECK_FALSE(decoder.decode_string(enc, dec));
+    }
+
+    CATCH_SECTION("Cannot decode stream with a match extending beyond the end of the block")
+    {
+        std::string const enc = create_stream_with_header({
+            0_u8, 0_u8, 0_u8, 4_u8, // Block size
+            0_u8, // Literals stream mode
+            0_u8, 0_u8, 0_u8, 1_u8, // Literals stream size
+            0x41, // Literals
+            0_u8, // Sequences stream mode
+            0_u8, 0_u8, 0_u8, 3_u8, // Sequences stream size
+            0x10, // Sequence (1 literal, match length 4)
+            1_u8, 0_u8, // Match offset
+        });
+        std::string dec;
+
+        CATCH_CHECK_FALSE(decoder.decode_string(enc, dec));
+    }
+
+    CATCH_SECTION("Cannot decode stream with a truncated length extension")
+    {
+        std::string const enc = create_stream_with_header({
+            0_u8, 0_u8, 0_u8, 15_u8, // Block size
+            0_u8, // Literals stream mode
+            0_u8, 0_u8, 0_u8, 15_u8, // Literals stream size
+            0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+            0x41, // Literals
+            0_u8, // Sequences stream mode
+            0_u8, 0_u8, 0_u8, 1_u8, // Sequences stream size
+            0xf0, // Final sequence (extended literal count)
+        });
+        std::string dec;
+
+        CATCH_CHECK_FALSE(decoder.decode_string(enc, dec));
+    }
+
+    CATCH_SECTION("Cannot decode stream whose sequences do not cover the block")
+    {
+        std::string const enc = create_stream_with_header({
+            0_u8, 0_u8, 0_u8, 2_u8, // Block size
+            0_u8, // Literals stream mode
+            0_u8, 0_u8, 0_u8, 1_u8, // Literals stream size
+            0x41, // Literals
+            0_u8, // Sequences stream mode
+            0_u8, 0_u8, 0_u8, 1_u8, // Sequences stream size
+            0x10, // Final sequence (1 literal)
+        });
+        std::string dec;
+
+        CATCH_CHECK_FALSE(decoder.decode_string(enc, dec));
+    }
+
+    CATCH_SECTION("Encode and decode empty stream")
+    {
+        std::string const raw;
+        std::string enc, dec;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, enc));
+        CATCH_REQUIRE(decoder.decode_string(enc, dec));
+
+        CATCH_CHECK(raw == dec);
+    }
+
+    CATCH_SECTION("Encode and decode a stream with a single symbol")
+    {
+        std::string const raw = "a";
+        std::string enc, dec;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, enc));
+        CATCH_REQUIRE(decoder.decode_string(enc, dec));
+
+        CATCH_CHECK(raw == dec);
+    }
+
+    CATCH_SECTION("Encode and decode a stream with a single symbol repeated")
+    {
+        std::string const raw(70, 'a');
+        std::string enc, dec;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, enc));
+        CATCH_REQUIRE(decoder.decode_string(enc, dec));
+
+        CATCH_CHECK(raw.size() > enc.size());
+        CATCH_CHECK(raw == dec);
+    }
+
+    CATCH_SECTION("Encode and decode a small stream")
+    {
+        std::string const raw = "abracadabra, abracadabra, abracadabra";
+        std::string enc, dec;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, enc));
+        CATCH_REQUIRE(decoder.decode_string(enc, dec));
+
+        CATCH_CHECK(raw.size() > enc.size());
+        CATCH_CHECK(raw == dec);
+    }
+
+    CATCH_SECTION("Encode and decode a large stream")
+    {
+        std::string const raw = fly::String::generate_random_string(100 << 10);
+        std::string enc, dec;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, enc));
+        CATCH_REQUIRE(decoder.decode_string(enc, dec));
+
+        CATCH_CHECK(raw == dec);
+    }
+
+    CATCH_SECTION("Encode and decode a large stream with many repeated sequences")
+    {
+        std::string const raw = create_repetitive_string(1 << 20);
+        std::string enc, dec;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, enc));
+        CATCH_REQUIRE(decoder.decode_string(enc, dec));
+
+        CATCH_CHECK(raw.size() > (enc.size() * 2));
+        CATCH_CHECK(raw == dec);
+    }
+
+    CATCH_SECTION("Encode and decode streams spanning many blocks")
+    {
+        config = std::make_shared<SmallBlockSizeConfig>();
+        fly::coders::Lz77Encoder small_block_encoder(config);
+
+        for (std::size_t size : {1023, 1024, 1025, 2048, 10 << 10})
+        {
+            CATCH_CAPTURE(size);
+
+            for (std::string const &raw :
+                 {fly::String::generate_random_string(size), create_repetitive_string(size)})
+            {
+                std::string enc, dec;
+
+                CATCH_REQUIRE(small_block_encoder.encode_string(raw, enc));
+                CATCH_REQUIRE(decoder.decode_string(enc, dec));
+
+                CATCH_CHECK(raw == dec);
+            }
+        }
+    }
+
+    CATCH_SECTION("Encode and decode a stream with matches further than the maximum offset")
+    {
+        // Repeat a random sequence larger than the maximum offset, so that no match may reference
+        // its previous occurrence.
+        std::string const segment = fly::String::generate_random_string(70 << 10);
+        std::string const raw = segment + segment + create_repetitive_string(10 << 10);
+        std::string enc, dec;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, enc));
+        CATCH_REQUIRE(decoder.decode_string(enc, dec));
+
+        CATCH_CHECK(raw == dec);
+    }
+
+    CATCH_SECTION("Encode and decode streams without searching hash chains")
+    {
+        config = std::make_shared<NoChainConfig>();
+        fly::coders::Lz77Encoder no_chain_encoder(config);
+
+        std::string const raw = create_repetitive_string(100 << 10);
+        std::string enc, no_chain_enc, dec;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, enc));
+        CATCH_REQUIRE(no_chain_encoder.encode_string(raw, no_chain_enc));
+        CATCH_REQUIRE(decoder.decode_string(no_chain_enc, dec));
+
+        CATCH_CHECK(raw == dec);
+        CATCH_CHECK(no_chain_enc.size() >= enc.size());
+    }
+
+    CATCH_SECTION("Encode and decode streams with Huffman encoded literals and sequences")
+    {
+        config = std::make_shared<HuffmanStreamsConfig>();
+        fly::coders::Lz77Encoder huffman_encoder(config);
+
+        std::vector<std::string> const inputs {
+            "",
+            "a",
+            create_repetitive_string(1 << 20),
+            fly::String::generate_random_string(100 << 10),
+        };
+
+        for (auto const &raw : inputs)
+        {
+            CATCH_CAPTURE(raw.size());
+
+            std::string enc, huffman_enc, dec;
+
+            CATCH_REQUIRE(encoder.encode_string(raw, enc));
+            CATCH_REQUIRE(huffman_encoder.encode_string(raw, huffman_enc));
+            CATCH_REQUIRE(decoder.decode_string(huffman_enc, dec));
+
+            // Streams are only Huffman encoded if doing so makes them smaller.
+            CATCH_CHECK(raw == dec);
+            CATCH_CHECK(huffman_enc.size() <= enc.size());
+        }
+
+        std::string const raw = create_repetitive_string(1 << 20);
+        std::string enc, huffman_enc;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, enc));
+        CATCH_REQUIRE(huffman_encoder.encode_string(raw, huffman_enc));
+        CATCH_CHECK(huffman_enc.size() < enc.size());
+    }
+
+    CATCH_SECTION("Encode and decode buffers identically to strings")
+    {
+        std::string const raw = create_repetitive_string(100 << 10);
+        auto const raw_bytes = std::as_bytes(std::span(raw));
+
+        std::string expected;
+        CATCH_REQUIRE(encoder.encode_string(raw, expected));
+
+        std::vector<std::byte> enc;
+        CATCH_REQUIRE(encoder.encode_buffer(raw_bytes, enc));
+        CATCH_CHECK(enc.size() == expected.size());
+        CATCH_CHECK(std::equal(enc.begin(), enc.end(), std::as_bytes(std::span(expected)).begin()));
+
+        std::vector<std::byte> dec;
+        CATCH_REQUIRE(decoder.decode_buffer(enc, dec));
+        CATCH_CHECK(dec.size() == raw.size());
+        CATCH_CHECK(std::equal(dec.begin(), dec.end(), raw_bytes.begin()));
+    }
+
+    CATCH_SECTION("Encoded buffers do not exceed the maximum encoded size")
+    {
+        config = std::make_shared<SmallBlockSizeConfig>();
+        fly::coders::Lz77Encoder small_block_encoder(config);
+
+        config = std::make_shared<HuffmanStreamsConfig>();
+        fly::coders::Lz77Encoder huffman_encoder(config);
+
+        std::vector<std::byte> uniform(5000);
+
+        for (std::size_t i = 0; i < uniform.size(); ++i)
+        {
+            uniform[i] = static_cast<std::byte>(i * 7919 >> 3);
+        }
+
+        std::vector<std::vector<std::byte>> const inputs {
+            {},
+            {std::byte('a')},
+            std::vector<std::byte>(5000, std::byte('a')),
+            uniform,
+        };
+
+        for (auto *buffer_encoder : {&encoder, &small_block_encoder, &huffman_encoder})
+        {
+            for (auto const &raw : inputs)
+            {
+                CATCH_CAPTURE(raw.size());
+
+                std::vector<std::byte> enc;
+                CATCH_REQUIRE(buffer_encoder->encode_buffer(raw, enc));
+                CATCH_CHECK(enc.size() <= buffer_encoder->max_encoded_size(raw.size()));
+                CATCH_CHECK(raw.size() <= decoder.max_decoded_size(enc.size()));
+            }
+        }
+    }
+
+    CATCH_SECTION("Encoder sessions produce streams identical to encoding the whole stream")
+    {
+        config = std::make_shared<SmallBlockSizeConfig>();
+        fly::coders::Lz77Encoder small_block_encoder(config);
+
+        for (std::size_t size : {0, 1, 2, 1023, 1024, 1025, 4096, 10 << 10})
+        {
+            std::string const raw = create_repetitive_string(size);
+            std::string expected;
+
+            CATCH_REQUIRE(small_block_encoder.encode_string(raw, expected));
+
+            for (std::size_t piece_size : {1, 7, 1000, 1024, 5000})
+            {
+                CATCH_CAPTURE(size, piece_size);
+
+                std::ostringstream enc;
+                auto session = small_block_encoder.create_encoder_session(enc);
+
+                CATCH_REQUIRE(update_in_pieces(*session, raw, piece_size));
+                CATCH_REQUIRE(session->finish());
+                CATCH_CHECK(enc.str() == expected);
+            }
+        }
+    }
+
+    CATCH_SECTION("Decoder sessions decode streams provided in pieces")
+    {
+        config = std::make_shared<SmallBlockSizeConfig>();
+        fly::coders::Lz77Encoder small_block_encoder(config);
+
+        config = std::make_shared<HuffmanStreamsConfig>();
+        fly::coders::Lz77Encoder huffman_encoder(config);
+
+        for (auto *session_encoder : {&encoder, &small_block_encoder, &huffman_encoder})
+        {
+            for (std::size_t size : {1, 2, 1023, 1024, 1025, 10 << 10})
+            {
+                std::string const raw = create_repetitive_string(size);
+                std::string enc;
+
+                CATCH_REQUIRE(session_encoder->encode_string(raw, enc));
+
+                for (std::size_t piece_size : {1, 7, 100, 1024, 5000})
+                {
+                    CATCH_CAPTURE(size, piece_size);
+
+                    std::ostringstream dec;
+                    auto session = decoder.create_decoder_session(dec);
+
+                    CATCH_REQUIRE(update_in_pieces(*session, enc, piece_size));
+                    CATCH_REQUIRE(session->finish());
+                    CATCH_CHECK(dec.str() == raw);
+                }
+            }
+        }
+    }
+
+    CATCH_SECTION("Decoder sessions decode blocks before the session is finished")
+    {
+        config = std::make_shared<SmallBlockSizeConfig>();
+        fly::coders::Lz77Encoder small_block_encoder(config);
+
+        std::string const raw = fly::String::generate_random_string(100 << 10);
+        std::string enc;
+
+        CATCH_REQUIRE(small_block_encoder.encode_string(raw, enc));
+
+        std::ostringstream dec;
+        auto session = decoder.create_decoder_session(dec);
+
+        CATCH_REQUIRE(session->update(std::as_bytes(std::span(enc))));
+        CATCH_CHECK(dec.str().size() > 0);
+        CATCH_CHECK(dec.str().size() < raw.size());
+
+        CATCH_REQUIRE(session->finish());
+        CATCH_CHECK(dec.str() == raw);
+    }
+
+    CATCH_SECTION("Cannot decode truncated or corrupted streams with sessions")
+    {
+        std::string const raw = create_repetitive_string(10 << 10);
+        std::string enc;
+
+        CATCH_REQUIRE(encoder.encode_string(raw, enc));
+
+        std::ostringstream truncated_dec;
+        auto truncated_session = decoder.create_decoder_session(truncated_dec);
+
+        std::string const truncated = enc.substr(0, enc.size() - 1);
+        CATCH_REQUIRE(update_in_pieces(*truncated_session, truncated, 100));
+        CATCH_CHECK_FALSE(truncated_session->finish());
+
+        std::ostringstream corrupted_dec;
+        auto corrupted_session = decoder.create_decoder_session(corrupted_dec);
+
+        std::string const corrupted = create_stream({3});
+        CATCH_REQUIRE(corrupted_session->update(std::as_bytes(std::span(corrupted))));
+        CATCH_CHECK_FALSE(corrupted_session->finish());
+        CATCH_CHECK_FALSE(corrupted_session->update(std::as_bytes(std::span(enc))));
+    }
+
+    CATCH_SECTION("Cannot encode with sessions using an invalid configuration")
+    {
+        config = std::make_shared<BadCoderConfig>();
+        fly::coders::Lz77Encoder bad_encoder(config);
+
+        std::ostringstream enc;
+        auto session = bad_encoder.create_encoder_session(enc);
+
+        CATCH_CHECK_FALSE(session->update(std::as_bytes(std::span("abc", 3))));
+        CATCH_CHECK_FALSE(session->finish());
+    }
+
+    CATCH_SECTION("File tests")
+    {
+        fly::test::PathUtil::ScopedTempDirectory path;
+        std::filesystem::path encoded_file = path.file();
+        std::filesystem::path decoded_file = path.file();
+
+        CATCH_SECTION("Decode a file whose decoded size is much larger than its encoded size")
+        {
+            // The decoded file is grown while decoding, rather than presized.
+            std::string const segment = fly::String::generate_random_string(1 << 10);
+            std::string contents;
+
+            for (std::size_t i = 0; i < (4 << 10); ++i)
+            {
+                contents += segment;
+            }
+
+            std::string encoded;
+
+            CATCH_REQUIRE(encoder.encode_string(contents, encoded));
+            CATCH_REQUIRE(fly::test::PathUtil::write_file(encoded_file, encoded));
+            CATCH_REQUIRE((encoded.size() * 4) < contents.size());
+
+            CATCH_REQUIRE(decoder.decode_file(encoded_file, decoded_file));
+            CATCH_CHECK(fly::test::PathUtil::read_file(decoded_file) == contents);
+        }
+
+        CATCH_SECTION("Encode and decode a large file containing only ASCII symbols")
+        {
+            auto const here = std::filesystem::path(__FILE__).parent_path();
+            auto const raw = here / "data" / "test.txt";
+
+            CATCH_REQUIRE(encoder.encode_file(raw, encoded_file));
+            CATCH_REQUIRE(decoder.decode_file(encoded_file, decoded_file));
+
+            CATCH_CHECK(fly::test::PathUtil::compare_files(raw, decoded_file));
+        }
+
+        CATCH_SECTION("Encode and decode a large file containing ASCII and non-ASCII symbols")
+        {
+            auto const here = std::filesystem::path(__FILE__).parent_path();
+            auto const raw = here / "data" / "test.bin";
+
+            config = std::make_shared<HuffmanStreamsConfig>();
+            fly::coders::Lz77Encoder huffman_encoder(config);
+
+            CATCH_REQUIRE(huffman_encoder.encode_file(raw, encoded_file));
+            CATCH_REQUIRE(decoder.decode_file(encoded_file, decoded_file));
+
+            CATCH_CHECK(fly::test::PathUtil::compare_files(raw, decoded_file));
+        }
+    }
+}
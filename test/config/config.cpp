@@ -28,6 +28,12 @@ CATCH_TEST_CASE("Config", "[config]")
         CATCH_CHECK(config.get_value<std::nullptr_t>("address", nullptr) == nullptr);
     }
 
+    CATCH_SECTION("Values of a non-object fallback to provided default")
+    {
+        config.update(fly::Json {1, 2, 3});
+        CATCH_CHECK(config.get_value<int>("name", 12) == 12);
+    }
+
     CATCH_SECTION("Mixed conversion of value types")
     {
         fly::Json const values =
@@ -1,4 +1,6 @@
 SRC_$(d) := \
     $(d)/ini_parser.cpp \
     $(d)/json_parser.cpp \
-    $(d)/parser.cpp
+    $(d)/parallel_json_parser.cpp \
+    $(d)/parser.cpp \
+    $(d)/utf8_transcoder.cpp
@@ -1,8 +1,11 @@
 #include "fly/parser/ini_parser.hpp"
 
+#include "test/util/path_util.hpp"
+
 #include "catch2/catch_test_macros.hpp"
 
 #include <filesystem>
+#include <string>
 
 CATCH_TEST_CASE("IniParser", "[parser]")
 {
@@ -396,4 +399,50 @@ CATCH_TEST_CASE("IniParser", "[parser]")
             CATCH_CHECK(values["section"]["address"] == "USA");
         }
     }
+
+    CATCH_SECTION("Windows line endings are ignored")
+    {
+        std::string const contents(
+            "[section]\r\n"
+            "name=John Doe\r\n"
+            "address=USA\r\n");
+
+        auto parsed = parser.parse_string(contents);
+        CATCH_REQUIRE(parsed.has_value());
+
+        fly::Json const values = *std::move(parsed);
+        CATCH_CHECK(values["section"]["name"] == "John Doe");
+        CATCH_CHECK(values["section"]["address"] == "USA");
+    }
+
+    CATCH_SECTION("Names and values must not be empty")
+    {
+        CATCH_CHECK_FALSE(parser.parse_string(std::string("[section]\n=John Doe\n")).has_value());
+        CATCH_CHECK_FALSE(parser.parse_string(std::string("[section]\n = John Doe\n")).has_value());
+        CATCH_CHECK_FALSE(parser.parse_string(std::string("[section]\nname = \n")).has_value());
+        CATCH_CHECK_FALSE(parser.parse_string(std::string("[section]\nname==x\n")).has_value());
+    }
+
+    CATCH_SECTION("Files larger than the parser's read size can be parsed")
+    {
+        fly::test::PathUtil::ScopedTempDirectory path;
+        std::filesystem::path file = path.file();
+
+        std::string contents("[section]\n");
+
+        for (int i = 0; i < 10'000; ++i)
+        {
+            contents += "name" + std::to_string(i) + " = value" + std::to_string(i) + "\n";
+        }
+
+        CATCH_REQUIRE(fly::test::PathUtil::write_file(file, contents));
+
+        auto parsed = parser.parse_file(file);
+        CATCH_REQUIRE(parsed.has_value());
+
+        fly::Json const values = *std::move(parsed);
+        CATCH_CHECK(values["section"].size() == 10'000);
+        CATCH_CHECK(values["section"]["name0"] == "value0");
+        CATCH_CHECK(values["section"]["name9999"] == "value9999");
+    }
 }
@@ -8,7 +8,10 @@
 #include "catch2/catch_test_macros.hpp"
 
 #include <array>
+#include <cstdint>
+#include <cstdlib>
 #include <filesystem>
+#include <limits>
 #include <memory>
 #include <string>
 
@@ -586,6 +589,66 @@ CATCH_TEST_CASE("JsonParser", "[parser]")
         validate_fail("E5");
     }
 
+    CATCH_SECTION("Numbers at the limits of their JSON types")
+    {
+        validate_pass("0", 0U);
+        validate_pass("-0", 0);
+        validate_pass("18446744073709551615", std::numeric_limits<std::uint64_t>::max());
+        validate_pass("-9223372036854775808", std::numeric_limits<std::int64_t>::min());
+
+        validate_fail("18446744073709551616");
+        validate_fail("-9223372036854775809");
+        validate_fail("100000000000000000000000000000");
+
+        validate_fail("-");
+        validate_fail("-a");
+        validate_fail("1.");
+        validate_fail("1.e5");
+        validate_fail("1e");
+        validate_fail("1e+");
+        validate_fail("1e-");
+        validate_fail("1e5.0");
+        validate_fail("1e5000");
+        validate_fail("-1e5000");
+        validate_fail("1e-5000");
+    }
+
+    CATCH_SECTION("Floating-point numbers are correctly rounded")
+    {
+        auto validate_exact = [&](std::string const &test) {
+            CATCH_CAPTURE(test);
+
+            std::optional<fly::Json> actual =
+                parser.parse_string(fly::string::format("{{ \"a\" : {} }}", test));
+            CATCH_REQUIRE(actual.has_value());
+            CATCH_REQUIRE(actual->at("a").is_float());
+
+            auto const expected = std::strtold(test.c_str(), nullptr);
+            CATCH_CHECK(fly::json_floating_point_type(actual->at("a")) == expected);
+        };
+
+        validate_exact("0.0");
+        validate_exact("-0.0");
+        validate_exact("0.1");
+        validate_exact("3.141592653589793");
+        validate_exact("-2.718281828459045");
+        validate_exact("1e0");
+        validate_exact("1E22");
+        validate_exact("1e-22");
+        validate_exact("123456789e27");
+        validate_exact("123456789e-27");
+        validate_exact("9007199254740993.0");
+        validate_exact("18446744073709551615.0");
+        validate_exact("18446744073709551616.0");
+        validate_exact("0.000000000000000000000000000000000000000000001");
+        validate_exact("123456789012345678901234567890.123456789012345678901234567890");
+        validate_exact("1.7976931348623157e308");
+        validate_exact("2.2250738585072014e-308");
+        validate_exact("1e1000");
+        validate_exact("1e-1000");
+        validate_exact("1e000000000000000000000000000000000000001");
+    }
+
     CATCH_SECTION("Single-line comments are ignored only when enabled")
     {
         fly::parser::JsonParser comment_parser(fly::parser::JsonParser::Features::AllowComments);
@@ -0,0 +1,303 @@
+#include "fly/parser/parallel_json_parser.hpp"
+
+#include "test/util/path_util.hpp"
+#include "test/util/task_manager.hpp"
+
+#include "fly/parser/json_parser.hpp"
+#include "fly/task/task_runner.hpp"
+#include "fly/types/json/json.hpp"
+#include "fly/types/string/format.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+
+using Layout = fly::parser::ParallelJsonParser::Layout;
+using Features = fly::parser::JsonParser::Features;
+
+constexpr std::array<std::size_t, 5> s_chunk_sizes {0, 1, 7, 64, 1024};
+
+/**
+ * Create a JSON array with elements that contain structural symbols inside strings, nested values,
+ * and numbers, to stress the boundary detection of the parallel parser.
+ */
+std::string create_array(std::size_t size)
+{
+    std::string contents("[");
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        if (i != 0)
+        {
+            contents.append(",\n");
+        }
+
+        switch (i % 4)
+        {
+            case 0:
+                contents += fly::string::format("{}", i);
+                break;
+
+            case 1:
+                contents += fly::string::format("\"a, [b] {{c}} \\\"{}\\\"\"", i);
+                break;
+
+            case 2:
+                contents += fly::string::format("{{ \"a\" : [{}, {{ \"b\" : \"],\" }}] }}", i);
+                break;
+
+            case 3:
+                contents += fly::string::format("[[{}.5, true], null]", i);
+                break;
+        }
+    }
+
+    contents.append("]");
+    return contents;
+}
+
+} // namespace
+
+CATCH_TEST_CASE("ParallelJsonParser", "[parser]")
+{
+    auto task_runner = fly::task::ParallelTaskRunner::create(fly::test::task_manager());
+    fly::parser::JsonParser serial_parser(Features::AllFeatures);
+
+    auto validate_pass =
+        [&](Layout layout, Features features, std::string const &test, std::size_t chunk_size) {
+            CATCH_CAPTURE(test);
+            CATCH_CAPTURE(chunk_size);
+
+            fly::parser::ParallelJsonParser parser(task_runner, layout, features, chunk_size);
+
+            std::optional<fly::Json> actual = parser.parse_string(test);
+            CATCH_REQUIRE(actual.has_value());
+
+            return *std::move(actual);
+        };
+
+    auto validate_fail =
+        [&](Layout layout, Features features, std::string const &test, std::size_t chunk_size) {
+            CATCH_CAPTURE(test);
+            CATCH_CAPTURE(chunk_size);
+
+            fly::parser::ParallelJsonParser parser(task_runner, layout, features, chunk_size);
+            CATCH_CHECK_FALSE(parser.parse_string(test).has_value());
+        };
+
+    CATCH_SECTION("Large arrays are parsed identically to the serial parser")
+    {
+        std::string const contents = create_array(1000);
+
+        std::optional<fly::Json> expected = serial_parser.parse_string(contents);
+        CATCH_REQUIRE(expected.has_value());
+
+        for (std::size_t chunk_size : s_chunk_sizes)
+        {
+            auto actual = validate_pass(Layout::Array, Features::Strict, contents, chunk_size);
+            CATCH_CHECK(actual == *expected);
+        }
+    }
+
+    CATCH_SECTION("Empty arrays can be parsed")
+    {
+        for (std::size_t chunk_size : s_chunk_sizes)
+        {
+            CATCH_CHECK(validate_pass(Layout::Array, Features::Strict, "[]", chunk_size).empty());
+            CATCH_CHECK(
+                validate_pass(Layout::Array, Features::Strict, " [ ] ", chunk_size).empty());
+        }
+    }
+
+    CATCH_SECTION("Badly formed arrays cannot be parsed")
+    {
+        for (std::size_t chunk_size : s_chunk_sizes)
+        {
+            validate_fail(Layout::Array, Features::Strict, "", chunk_size);
+            validate_fail(Layout::Array, Features::Strict, "{}", chunk_size);
+            validate_fail(Layout::Array, Features::Strict, "1", chunk_size);
+            validate_fail(Layout::Array, Features::Strict, "[", chunk_size);
+            validate_fail(Layout::Array, Features::Strict, "[1, 2", chunk_size);
+            validate_fail(Layout::Array, Features::Strict, "[1, \"2]", chunk_size);
+            validate_fail(Layout::Array, Features::Strict, "[1, 2] 3", chunk_size);
+            validate_fail(Layout::Array, Features::Strict, "[1, 2]]", chunk_size);
+            validate_fail(Layout::Array, Features::Strict, "[1}", chunk_size);
+            validate_fail(Layout::Array, Features::Strict, "[{\"a\":1}}", chunk_size);
+            validate_fail(Layout::Array, Features::Strict, "[,]", chunk_size);
+            validate_fail(Layout::Array, Features::Strict, "[1,,2]", chunk_size);
+            validate_fail(Layout::Array, Features::Strict, "[1, 2,]", chunk_size);
+            validate_fail(Layout::Array, Features::Strict, "[1, {\"a\" : 2,}]", chunk_size);
+            validate_fail(Layout::Array, Features::Strict, "[1, tru]", chunk_size);
+        }
+    }
+
+    CATCH_SECTION("Trailing commas are allowed only when enabled")
+    {
+        for (std::size_t chunk_size : s_chunk_sizes)
+        {
+            auto const features = Features::AllowTrailingComma;
+
+            CATCH_CHECK(validate_pass(Layout::Array, features, "[1, 2,]", chunk_size).size() == 2);
+            CATCH_CHECK(
+                validate_pass(Layout::Array, features, "[1, 2, ]", chunk_size).size() == 2);
+
+            validate_fail(Layout::Array, features, "[,]", chunk_size);
+            validate_fail(Layout::Array, features, "[1,,2]", chunk_size);
+            validate_fail(Layout::Array, features, "[1, 2,,]", chunk_size);
+        }
+    }
+
+    CATCH_SECTION("Comments are ignored only when enabled")
+    {
+        std::string const contents = "// [\n[1, /* ], */ 2 // ]\n, 3] /* ] */";
+
+        for (std::size_t chunk_size : s_chunk_sizes)
+        {
+            auto actual =
+                validate_pass(Layout::Array, Features::AllowComments, contents, chunk_size);
+            CATCH_CHECK(actual == fly::Json {1, 2, 3});
+
+            validate_fail(Layout::Array, Features::Strict, contents, chunk_size);
+            validate_fail(Layout::Array, Features::AllowComments, "[1, /* */, 2]", chunk_size);
+        }
+    }
+
+    CATCH_SECTION("Newline-delimited JSON values can be parsed")
+    {
+        std::string const contents =
+            "{\"a\" : 1}\n\n[1, 2]\r\n  \"string\"  \n3.5\n\t\ntrue\nnull\n"
+            "{\"b\" : {\"c\" : [\"\\n\"]}}";
+
+        fly::Json const expected = {
+            fly::Json {{"a", 1}},
+            fly::Json {1, 2},
+            "string",
+            3.5,
+            true,
+            nullptr,
+            fly::Json {{"b", {{"c", {"\\n"}}}}}};
+
+        for (std::size_t chunk_size : s_chunk_sizes)
+        {
+            auto actual =
+                validate_pass(Layout::NewlineDelimited, Features::Strict, contents, chunk_size);
+            CATCH_CHECK(actual == expected);
+        }
+    }
+
+    CATCH_SECTION("Badly formed newline-delimited JSON values cannot be parsed")
+    {
+        for (std::size_t chunk_size : s_chunk_sizes)
+        {
+            validate_fail(Layout::NewlineDelimited, Features::Strict, "1\n2 3\n4", chunk_size);
+            validate_fail(Layout::NewlineDelimited, Features::Strict, "1\n[2,\n3]", chunk_size);
+            validate_fail(Layout::NewlineDelimited, Features::Strict, "1\n2,\n3", chunk_size);
+            validate_fail(Layout::NewlineDelimited, Features::Strict, "{\"a\" : }", chunk_size);
+        }
+    }
+
+    CATCH_SECTION("Empty newline-delimited JSON contains no records")
+    {
+        for (std::size_t chunk_size : s_chunk_sizes)
+        {
+            auto actual =
+                validate_pass(Layout::NewlineDelimited, Features::Strict, "\n \n\r\n", chunk_size);
+            CATCH_CHECK(actual.empty());
+        }
+    }
+
+    CATCH_SECTION("Records are delivered in order to a callback")
+    {
+        std::string contents;
+
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            contents += fly::string::format("{{\"index\" : {}}}\n", i);
+        }
+
+        for (std::size_t chunk_size : s_chunk_sizes)
+        {
+            fly::parser::ParallelJsonParser parser(
+                task_runner,
+                Layout::NewlineDelimited,
+                Features::Strict,
+                chunk_size);
+
+            std::size_t count = 0;
+
+            auto callback = [&count](std::size_t index, fly::Json &&record) {
+                CATCH_CHECK(index == count++);
+                CATCH_CHECK(record["index"] == index);
+            };
+
+            CATCH_CHECK(parser.parse_string(contents, std::move(callback)));
+            CATCH_CHECK(count == 1000);
+        }
+    }
+
+    CATCH_SECTION("Exceptions thrown by the callback are rethrown after parsing completes")
+    {
+        std::string contents;
+
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            contents += fly::string::format("{{\"index\" : {}}}\n", i);
+        }
+
+        fly::parser::ParallelJsonParser parser(
+            task_runner,
+            Layout::NewlineDelimited,
+            Features::Strict,
+            64);
+
+        std::size_t count = 0;
+
+        auto callback = [&count](std::size_t index, fly::Json &&) {
+            ++count;
+
+            if (index == 10)
+            {
+                throw std::runtime_error("callback failure");
+            }
+        };
+
+        CATCH_CHECK_THROWS_AS(
+            parser.parse_string(contents, std::move(callback)),
+            std::runtime_error);
+        CATCH_CHECK(count == 11);
+    }
+
+    CATCH_SECTION("Files can be parsed")
+    {
+        fly::test::PathUtil::ScopedTempDirectory path;
+        std::filesystem::path file = path.file();
+
+        std::string const contents = create_array(100);
+        CATCH_REQUIRE(fly::test::PathUtil::write_file(file, "\xef\xbb\xbf" + contents));
+
+        std::optional<fly::Json> expected = serial_parser.parse_string(contents);
+        CATCH_REQUIRE(expected.has_value());
+
+        fly::parser::ParallelJsonParser parser(task_runner, Layout::Array, Features::Strict, 16);
+
+        std::optional<fly::Json> actual = parser.parse_file(file);
+        CATCH_REQUIRE(actual.has_value());
+        CATCH_CHECK(*actual == *expected);
+    }
+
+    CATCH_SECTION("Non-existing files cannot be parsed")
+    {
+        fly::parser::ParallelJsonParser parser(task_runner, Layout::Array);
+
+        CATCH_CHECK_FALSE(parser.parse_file(std::filesystem::path("foo_abc") / "a.json"));
+        CATCH_CHECK_FALSE(parser.parse_file(std::filesystem::path("foo_abc") / "a.json", nullptr));
+    }
+}
@@ -7,9 +7,12 @@
 
 #include "catch2/catch_test_macros.hpp"
 
+#include <cstdint>
 #include <filesystem>
 #include <optional>
 #include <sstream>
+#include <string>
+#include <tuple>
 #include <vector>
 
 namespace {
@@ -127,4 +130,84 @@ CATCH_TEST_CASE("Parser", "[parser]")
 
         parse_bytes({0xff, 0xfe, 0x00, 0x00}, {});
     }
+
+    CATCH_SECTION("Large UTF-16 and UTF-32 files are converted to UTF-8")
+    {
+        std::string const pattern = "abc\xc3\xb1\xe4\xb8\x80\xf0\x9f\x8d\x95xyz\n";
+        std::u32string const codepoints = U"abc\u00f1\u4e00\U0001f355xyz\n";
+
+        // Encode the pattern with the given code unit size and endianness, after the given BOM.
+        auto encode = [&codepoints](std::string bom, std::size_t size, bool big_endian) {
+            for (std::size_t i = 0; i < 10'000; ++i)
+            {
+                for (char32_t codepoint : codepoints)
+                {
+                    std::vector<std::uint32_t> units;
+
+                    if ((size == 2) && (codepoint >= 0x10000))
+                    {
+                        units.push_back(0xd800 + ((codepoint - 0x10000) >> 10));
+                        units.push_back(0xdc00 + ((codepoint - 0x10000) & 0x3ff));
+                    }
+                    else
+                    {
+                        units.push_back(codepoint);
+                    }
+
+                    for (std::uint32_t unit : units)
+                    {
+                        for (std::size_t byte = 0; byte < size; ++byte)
+                        {
+                            std::size_t const shift = big_endian ? (size - byte - 1) : byte;
+                            bom.push_back(static_cast<char>((unit >> (8 * shift)) & 0xff));
+                        }
+                    }
+                }
+            }
+
+            return bom;
+        };
+
+        std::vector<int> expected;
+        expected.reserve(pattern.size() * 10'000);
+
+        for (std::size_t i = 0; i < 10'000; ++i)
+        {
+            for (char ch : pattern)
+            {
+                expected.push_back(static_cast<int>(static_cast<unsigned char>(ch)));
+            }
+        }
+
+        for (auto const &[bom, size, big_endian] : {
+                 std::make_tuple(std::string("\xfe\xff"), 2, true),
+                 std::make_tuple(std::string("\xff\xfe"), 2, false),
+                 std::make_tuple(std::string("\x00\x00\xfe\xff", 4), 4, true),
+                 std::make_tuple(std::string("\xff\xfe\x00\x00", 4), 4, false),
+             })
+        {
+            CATCH_CAPTURE(size, big_endian);
+
+            auto contents = encode(bom, static_cast<std::size_t>(size), big_endian);
+            CATCH_REQUIRE(fly::test::PathUtil::write_file(file, contents));
+
+            CATCH_CHECK_FALSE(parser.parse_file(file));
+            parser.compare(std::vector<int>(expected));
+
+            // A trailing partial code unit is dropped.
+            contents.push_back('\x61');
+            CATCH_REQUIRE(fly::test::PathUtil::write_file(file, contents));
+
+            CATCH_CHECK_FALSE(parser.parse_file(file));
+            parser.compare(std::vector<int>(expected));
+        }
+    }
+
+    CATCH_SECTION("Invalid UTF-16 files are not parsed")
+    {
+        std::string const contents("\xfe\xff\xd8\x3d\x00\x61", 6);
+
+        CATCH_REQUIRE(fly::test::PathUtil::write_file(file, contents));
+        CATCH_CHECK_FALSE(parser.parse_file(file));
+    }
 }
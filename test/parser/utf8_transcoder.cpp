@@ -0,0 +1,159 @@
+#include "fly/parser/detail/utf8_transcoder.hpp"
+
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <string>
+#include <string_view>
+
+namespace {
+
+template <typename StringType>
+StringType make_contents(std::size_t repetitions)
+{
+    using char_type = typename StringType::value_type;
+
+    // Mix of 1-byte, 2-byte, 3-byte, and 4-byte UTF-8 codepoints.
+    StringType pattern;
+
+    if constexpr (sizeof(char_type) == 2)
+    {
+        pattern = u"abcñ一\U0001f355xyz 0123456789";
+    }
+    else
+    {
+        pattern = U"abcñ一\U0001f355xyz 0123456789";
+    }
+
+    StringType contents;
+    contents.reserve(pattern.size() * repetitions);
+
+    for (std::size_t i = 0; i < repetitions; ++i)
+    {
+        contents += pattern;
+    }
+
+    return contents;
+}
+
+std::string make_expected(std::size_t repetitions)
+{
+    std::string const pattern = "abc\xc3\xb1\xe4\xb8\x80\xf0\x9f\x8d\x95xyz 0123456789";
+    std::string expected;
+
+    for (std::size_t i = 0; i < repetitions; ++i)
+    {
+        expected += pattern;
+    }
+
+    return expected;
+}
+
+} // namespace
+
+CATCH_TEMPLATE_TEST_CASE("Utf8Transcoder", "[parser]", std::u16string, std::u32string)
+{
+    using string_type = TestType;
+    using char_type = typename string_type::value_type;
+    using view_type = std::basic_string_view<char_type>;
+
+    CATCH_SECTION("Empty strings are transcoded to empty strings")
+    {
+        auto const result = fly::parser::detail::transcode_to_utf8(view_type());
+        CATCH_REQUIRE(result);
+        CATCH_CHECK(result->empty());
+    }
+
+    CATCH_SECTION("ASCII strings are narrowed")
+    {
+        string_type contents;
+
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            contents.push_back(static_cast<char_type>(i % 0x80));
+        }
+
+        std::string expected;
+
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            expected.push_back(static_cast<char>(i % 0x80));
+        }
+
+        auto const result = fly::parser::detail::transcode_to_utf8(view_type(contents));
+        CATCH_REQUIRE(result);
+        CATCH_CHECK(*result == expected);
+    }
+
+    CATCH_SECTION("Mixed ASCII and non-ASCII strings are transcoded")
+    {
+        for (std::size_t repetitions : {1, 2, 10, 1000})
+        {
+            CATCH_CAPTURE(repetitions);
+
+            auto const contents = make_contents<string_type>(repetitions);
+
+            auto const result = fly::parser::detail::transcode_to_utf8(view_type(contents));
+            CATCH_REQUIRE(result);
+            CATCH_CHECK(*result == make_expected(repetitions));
+        }
+    }
+
+    CATCH_SECTION("Strings split into pieces are transcoded identically to unsplit strings")
+    {
+        auto const contents = make_contents<string_type>(100);
+        auto const expected = make_expected(100);
+
+        // Try every piece count up to a length which causes pieces to begin at every code unit of
+        // the pattern, including between the surrogates of a surrogate pair.
+        for (std::size_t pieces = 1; pieces <= 64; ++pieces)
+        {
+            CATCH_CAPTURE(pieces);
+
+            auto const result = fly::parser::detail::transcode_to_utf8(view_type(contents), pieces);
+            CATCH_REQUIRE(result);
+            CATCH_CHECK(*result == expected);
+        }
+
+        auto const result =
+            fly::parser::detail::transcode_to_utf8(view_type(contents), contents.size() * 2);
+        CATCH_REQUIRE(result);
+        CATCH_CHECK(*result == expected);
+    }
+
+    CATCH_SECTION("Invalid code units fail transcoding")
+    {
+        auto contents = make_contents<string_type>(100);
+
+        if constexpr (sizeof(char_type) == 2)
+        {
+            contents[contents.size() / 2] = static_cast<char_type>(0xd800);
+        }
+        else
+        {
+            contents[contents.size() / 2] = static_cast<char_type>(0x110000);
+        }
+
+        CATCH_CHECK_FALSE(fly::parser::detail::transcode_to_utf8(view_type(contents)));
+
+        for (std::size_t pieces = 1; pieces <= 8; ++pieces)
+        {
+            CATCH_CAPTURE(pieces);
+            CATCH_CHECK_FALSE(fly::parser::detail::transcode_to_utf8(view_type(contents), pieces));
+        }
+    }
+
+    CATCH_SECTION("Surrogates which do not form a pair fail transcoding")
+    {
+        if constexpr (sizeof(char_type) == 2)
+        {
+            string_type const lone_high = u"abc\xd83d xyz";
+            string_type const lone_low = u"abc\xdf55 xyz";
+            string_type const reversed = u"abc\xdf55\xd83d xyz";
+
+            CATCH_CHECK_FALSE(fly::parser::detail::transcode_to_utf8(view_type(lone_high)));
+            CATCH_CHECK_FALSE(fly::parser::detail::transcode_to_utf8(view_type(lone_low)));
+            CATCH_CHECK_FALSE(fly::parser::detail::transcode_to_utf8(view_type(reversed)));
+        }
+    }
+}
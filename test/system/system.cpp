@@ -3,6 +3,7 @@
 #include "test/util/capture_stream.hpp"
 
 #include "fly/fly.hpp"
+#include "fly/system/cpu_features.hpp"
 
 #if defined(FLY_LINUX)
 #    include "test/mock/mock_system.hpp"
@@ -184,4 +185,19 @@ CATCH_TEST_CASE("System", "[system]")
 
         fly::system::set_signal_handler(nullptr);
     }
+
+    CATCH_SECTION("Detect the CPU's instruction set extensions once")
+    {
+        auto const &features = fly::system::cpu_features();
+        CATCH_CHECK(&features == &fly::system::cpu_features());
+
+        // Each extension is only supported by CPUs which support the extensions preceding it.
+        CATCH_CHECK((!features.m_avx2 || features.m_sse42));
+        CATCH_CHECK((!features.m_sse42 || features.m_sse41));
+        CATCH_CHECK((!features.m_sse41 || features.m_ssse3));
+
+#if !defined(FLY_X86)
+        CATCH_CHECK_FALSE(features.m_ssse3);
+#endif
+    }
 }
@@ -10,6 +10,7 @@
 #include <atomic>
 #include <chrono>
 #include <memory>
+#include <stdexcept>
 
 using namespace std::chrono_literals;
 
@@ -246,6 +247,34 @@ CATCH_TEST_CASE("Task", "[task]")
         CATCH_CHECK(reply_was_called);
     }
 
+    CATCH_SECTION("Tasks may pass their result to a future")
+    {
+        auto task_runner = fly::test::WaitableParallelTaskRunner::create(fly::test::task_manager());
+
+        auto task = []() -> int {
+            return 12389;
+        };
+
+        auto future = task_runner->post_task_with_future(FROM_HERE, std::move(task));
+        task_runner->wait_for_task_to_complete(__FILE__);
+
+        CATCH_CHECK(future.get() == 12389);
+    }
+
+    CATCH_SECTION("Exceptions thrown by tasks are stored in their future")
+    {
+        auto task_runner = fly::test::WaitableParallelTaskRunner::create(fly::test::task_manager());
+
+        auto task = []() -> int {
+            throw std::runtime_error("task failure");
+        };
+
+        auto future = task_runner->post_task_with_future(FROM_HERE, std::move(task));
+        task_runner->wait_for_task_to_complete(__FILE__);
+
+        CATCH_CHECK_THROWS_AS(future.get(), std::runtime_error);
+    }
+
     CATCH_SECTION("Delayed tasks execute no sooner than their specified delay")
     {
         auto task_runner =
@@ -799,6 +828,21 @@ CATCH_TEST_CASE("TaskManager", "[task]")
         CATCH_CHECK_FALSE(task_runner->post_task_with_delay(FROM_HERE, 0ms, []() {}));
     }
 
+    CATCH_SECTION("Tasks with futures execute immediately after the task manager is deleted")
+    {
+        auto task_runner = fly::task::ParallelTaskRunner::create(task_manager);
+
+        CATCH_REQUIRE(task_manager->stop());
+        task_manager.reset();
+
+        auto task = []() -> int {
+            return 12389;
+        };
+
+        auto future = task_runner->post_task_with_future(FROM_HERE, std::move(task));
+        CATCH_CHECK(future.get() == 12389);
+    }
+
     CATCH_SECTION("Sequenced tasks cannot be posted after the task manager is deleted")
     {
         auto task_runner = fly::task::SequencedTaskRunner::create(task_manager);
@@ -0,0 +1,229 @@
+#include "fly/types/bit_stream/bit_packing.hpp"
+
+#include "fly/types/bit_stream/bit_span_reader.hpp"
+#include "fly/types/bit_stream/bit_stream_reader.hpp"
+#include "fly/types/bit_stream/bit_stream_writer.hpp"
+#include "fly/types/numeric/literals.hpp"
+
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace fly::literals::numeric_literals;
+
+namespace {
+
+/**
+ * Create an array of values with a pattern based on their index, limited to a number of bits.
+ */
+template <typename DataType>
+std::vector<DataType> create_values(std::size_t count, fly::byte_type size, DataType base = 0)
+{
+    std::vector<DataType> values(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto const value = (size == 0) ? 0 : (i * 0x9e37'79b9'7f4a'7c15_u64) >> (64 - size);
+        values[i] = static_cast<DataType>(base + value);
+    }
+
+    return values;
+}
+
+/**
+ * Create a sorted array of values which increase by a small, varying amount.
+ */
+template <typename DataType>
+std::vector<DataType> create_sorted_values(std::size_t count, DataType base = 0)
+{
+    std::vector<DataType> values(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        base = static_cast<DataType>(base + ((i * 7) % 13));
+        values[i] = base;
+    }
+
+    return values;
+}
+
+} // namespace
+
+CATCH_TEMPLATE_TEST_CASE(
+    "BitPacking",
+    "[bit_stream]",
+    std::uint8_t,
+    std::uint16_t,
+    std::uint32_t,
+    std::uint64_t)
+{
+    using data_type = TestType;
+    static constexpr auto s_digits =
+        static_cast<fly::byte_type>(std::numeric_limits<data_type>::digits);
+
+    std::ostringstream output_stream(std::ios::out | std::ios::binary);
+    std::string contents;
+
+    auto bytes = [&contents]() {
+        return std::as_bytes(std::span(contents));
+    };
+
+    // Pack an array of values, and verify it unpacks the same from stream and span readers.
+    auto round_trip = [&](std::vector<data_type> const &values, bool delta) {
+        output_stream.str({});
+        {
+            fly::BitStreamWriter stream(output_stream);
+
+            if (delta)
+            {
+                fly::pack_delta(stream, std::span(values));
+            }
+            else
+            {
+                fly::pack_frame_of_reference(stream, std::span(values));
+            }
+
+            CATCH_REQUIRE(stream.finish());
+            contents = output_stream.str();
+        }
+
+        std::vector<data_type> unpacked_stream(values.size());
+        std::vector<data_type> unpacked_span(values.size());
+
+        std::istringstream input_stream(contents, std::ios::in | std::ios::binary);
+        fly::BitStreamReader stream_reader(input_stream);
+        fly::BitSpanReader span_reader(bytes());
+
+        if (delta)
+        {
+            CATCH_CHECK(fly::unpack_delta(stream_reader, std::span(unpacked_stream)));
+            CATCH_CHECK(fly::unpack_delta(span_reader, std::span(unpacked_span)));
+        }
+        else
+        {
+            CATCH_CHECK(fly::unpack_frame_of_reference(stream_reader, std::span(unpacked_stream)));
+            CATCH_CHECK(fly::unpack_frame_of_reference(span_reader, std::span(unpacked_span)));
+        }
+
+        CATCH_CHECK(stream_reader.fully_consumed());
+        CATCH_CHECK(span_reader.fully_consumed());
+
+        CATCH_CHECK(unpacked_stream == values);
+        CATCH_CHECK(unpacked_span == values);
+    };
+
+    CATCH_SECTION("Empty arrays are packed without any bits")
+    {
+        round_trip({}, false);
+        CATCH_CHECK(contents.size() == 1);
+
+        round_trip({}, true);
+        CATCH_CHECK(contents.size() == 1);
+    }
+
+    CATCH_SECTION("Arrays of values of every width are packed and unpacked")
+    {
+        for (fly::byte_type size = 0; size <= s_digits; ++size)
+        {
+            for (std::size_t count : {1, 4, 127, 128, 129, 300})
+            {
+                CATCH_CAPTURE(size, count);
+
+                round_trip(create_values<data_type>(count, size), false);
+                round_trip(create_values<data_type>(count, size), true);
+            }
+        }
+    }
+
+    CATCH_SECTION("Values are packed as offsets from the minimum value of each block")
+    {
+        static constexpr std::size_t s_count = fly::s_bit_packing_block_size * 4;
+        static constexpr auto s_base =
+            static_cast<data_type>(std::numeric_limits<data_type>::max() - 15);
+
+        auto const values = create_values<data_type>(s_count, 4, s_base);
+        round_trip(values, false);
+
+        // Each block holds a 7-bit width, a full reference, and 4-bit offsets.
+        std::size_t const bits = 4 * (7 + s_digits + (fly::s_bit_packing_block_size * 4));
+        CATCH_CHECK(contents.size() == (1 + ((bits + 7) / 8)));
+    }
+
+    CATCH_SECTION("Blocks of equal values are packed without any offsets")
+    {
+        std::vector<data_type> const values(fly::s_bit_packing_block_size * 2, data_type(42));
+        round_trip(values, false);
+
+        std::size_t const bits = 2 * (7 + s_digits);
+        CATCH_CHECK(contents.size() == (1 + ((bits + 7) / 8)));
+    }
+
+    CATCH_SECTION("Sorted arrays are packed more compactly with delta packing")
+    {
+        static constexpr std::size_t s_count = 1000;
+
+        auto const values = create_sorted_values<data_type>(s_count, data_type(5));
+
+        round_trip(values, false);
+        std::size_t const frame_of_reference_size = contents.size();
+
+        round_trip(values, true);
+        std::size_t const delta_size = contents.size();
+
+        if constexpr (sizeof(data_type) > 1)
+        {
+            CATCH_CHECK(delta_size < frame_of_reference_size);
+        }
+
+        // Every difference fits within 4 bits.
+        CATCH_CHECK(delta_size <= (1 + ((s_digits + 8 * (7 + s_digits + 4 * 128) + 7) / 8)));
+    }
+
+    CATCH_SECTION("Unsorted arrays may be delta packed")
+    {
+        auto values = create_values<data_type>(500, s_digits);
+        round_trip(values, true);
+
+        values = create_sorted_values<data_type>(500, std::numeric_limits<data_type>::max());
+        round_trip(values, true);
+    }
+
+    CATCH_SECTION("Cannot unpack more values than were packed")
+    {
+        auto const values = create_values<data_type>(200, 5);
+        round_trip(values, false);
+
+        std::vector<data_type> unpacked(values.size() + 1);
+
+        std::istringstream input_stream(contents, std::ios::in | std::ios::binary);
+        fly::BitStreamReader stream_reader(input_stream);
+        fly::BitSpanReader span_reader(bytes());
+
+        CATCH_CHECK_FALSE(fly::unpack_frame_of_reference(stream_reader, std::span(unpacked)));
+        CATCH_CHECK_FALSE(fly::unpack_frame_of_reference(span_reader, std::span(unpacked)));
+    }
+
+    CATCH_SECTION("Cannot unpack blocks wider than the value type")
+    {
+        output_stream.str({});
+        {
+            fly::BitStreamWriter stream(output_stream);
+            stream.write_bits(static_cast<fly::byte_type>(s_digits + 1), 7);
+            stream.write_bits(data_type(0), s_digits);
+            CATCH_REQUIRE(stream.finish());
+            contents = output_stream.str();
+        }
+
+        std::vector<data_type> unpacked(1);
+        fly::BitSpanReader span_reader(bytes());
+
+        CATCH_CHECK_FALSE(fly::unpack_frame_of_reference(span_reader, std::span(unpacked)));
+    }
+}
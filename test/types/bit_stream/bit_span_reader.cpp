@@ -0,0 +1,338 @@
+#include "fly/types/bit_stream/bit_span_reader.hpp"
+
+#include "fly/types/bit_stream/bit_stream_reader.hpp"
+#include "fly/types/bit_stream/bit_stream_writer.hpp"
+#include "fly/types/bit_stream/detail/constants.hpp"
+#include "fly/types/numeric/literals.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace fly::literals::numeric_literals;
+
+CATCH_TEST_CASE("BitSpanReader", "[bit_stream]")
+{
+    std::ostringstream output_stream(std::ios::out | std::ios::binary);
+    std::string contents;
+
+    auto create_header = [](fly::byte_type remainder) -> fly::byte_type {
+        return (fly::detail::s_magic << fly::detail::s_magic_shift) |
+            (remainder << fly::detail::s_remainder_shift);
+    };
+
+    auto bytes = [&contents]() {
+        return std::as_bytes(std::span(contents));
+    };
+
+    // Write a number of fixed-width fields, with each field set to a pattern based on its index.
+    auto write_fields = [&](std::size_t count, fly::byte_type size) {
+        fly::BitStreamWriter stream(output_stream);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::uint64_t const value = (i * 0x9e37'79b9'7f4a'7c15_u64) >> (64 - size);
+            stream.write_bits(value, size);
+        }
+
+        CATCH_REQUIRE(stream.finish());
+        contents = output_stream.str();
+    };
+
+    auto expected_field = [](std::size_t index, fly::byte_type size) -> std::uint64_t {
+        return (index * 0x9e37'79b9'7f4a'7c15_u64) >> (64 - size);
+    };
+
+    CATCH_SECTION("Empty spans have no header and cannot be read")
+    {
+        fly::BitSpanReader stream(bytes());
+        fly::byte_type byte;
+
+        CATCH_CHECK_FALSE(stream.is_valid());
+        CATCH_CHECK(stream.header() == 0);
+
+        CATCH_CHECK(stream.read_bits(byte, 1) == 0_u8);
+        CATCH_CHECK(stream.fully_consumed());
+    }
+
+    CATCH_SECTION("Spans with an invalid header cannot be read")
+    {
+        fly::byte_type const header = (fly::detail::s_magic - 1) << fly::detail::s_magic_shift;
+        contents.push_back(static_cast<char>(header));
+        contents.append("data");
+
+        fly::BitSpanReader stream(bytes());
+        fly::byte_type byte;
+
+        CATCH_CHECK_FALSE(stream.is_valid());
+        CATCH_CHECK(stream.header() == header);
+
+        CATCH_CHECK(stream.read_bits(byte, 1) == 0_u8);
+        CATCH_CHECK(stream.remaining_bits() == 0);
+    }
+
+    CATCH_SECTION("Spans with only a header contain no bits")
+    {
+        write_fields(0, 1);
+
+        fly::BitSpanReader stream(bytes());
+        fly::byte_type byte;
+
+        CATCH_CHECK(stream.is_valid());
+        CATCH_CHECK(stream.header() == create_header(0_u8));
+
+        CATCH_CHECK(stream.read_bits(byte, 1) == 0_u8);
+        CATCH_CHECK(stream.fully_consumed());
+    }
+
+    CATCH_SECTION("Spans with only a header cannot have remainder bits")
+    {
+        contents.push_back(static_cast<char>(create_header(7_u8)));
+
+        fly::BitSpanReader stream(bytes());
+        fly::byte_type byte;
+
+        CATCH_CHECK_FALSE(stream.is_valid());
+        CATCH_CHECK(stream.header() == create_header(7_u8));
+
+        CATCH_CHECK(stream.read_bits(byte, 1) == 0_u8);
+        CATCH_CHECK(stream.remaining_bits() == 0);
+    }
+
+    CATCH_SECTION("Zero-filled bits at the end of the span are not read")
+    {
+        write_fields(1, 1);
+
+        fly::BitSpanReader stream(bytes());
+        CATCH_CHECK(stream.header() == create_header(7_u8));
+        CATCH_CHECK(stream.remaining_bits() == 1);
+
+        fly::byte_type byte;
+        CATCH_CHECK(stream.read_bits(byte, 1) == 1_u8);
+        CATCH_CHECK(byte == expected_field(0, 1));
+        CATCH_CHECK(stream.fully_consumed());
+    }
+
+    CATCH_SECTION("Read bytes and words")
+    {
+        {
+            fly::BitStreamWriter stream(output_stream);
+            stream.write_byte(0xab);
+            stream.write_word(0xcdef);
+            stream.write_byte(0x12);
+            CATCH_REQUIRE(stream.finish());
+        }
+
+        contents = output_stream.str();
+        fly::BitSpanReader stream(bytes());
+
+        fly::byte_type byte;
+        fly::word_type word;
+
+        CATCH_CHECK(stream.read_byte(byte));
+        CATCH_CHECK(byte == 0xab);
+        CATCH_CHECK(stream.read_word(word));
+        CATCH_CHECK(word == 0xcdef);
+        CATCH_CHECK(stream.read_byte(byte));
+        CATCH_CHECK(byte == 0x12);
+
+        CATCH_CHECK_FALSE(stream.read_byte(byte));
+        CATCH_CHECK(stream.fully_consumed());
+    }
+
+    CATCH_SECTION("Read the same bits as a stream reader, leaving every possible bit position")
+    {
+        {
+            fly::BitStreamWriter stream(output_stream);
+
+            for (fly::byte_type size = 1; size <= 64; ++size)
+            {
+                stream.write_bits(expected_field(size, size), size);
+            }
+
+            CATCH_REQUIRE(stream.finish());
+        }
+
+        contents = output_stream.str();
+
+        std::istringstream input_stream(contents, std::ios::in | std::ios::binary);
+        fly::BitStreamReader stream_reader(input_stream);
+        fly::BitSpanReader span_reader(bytes());
+
+        CATCH_CHECK(span_reader.header() == stream_reader.header());
+
+        for (fly::byte_type size = 1; size <= 64; ++size)
+        {
+            std::uint64_t expected = 0, actual = 0;
+
+            CATCH_CHECK(stream_reader.read_bits(expected, size) == size);
+            CATCH_CHECK(span_reader.read_bits(actual, size) == size);
+
+            CATCH_CHECK(actual == expected);
+            CATCH_CHECK(actual == expected_field(size, size));
+        }
+
+        CATCH_CHECK(stream_reader.fully_consumed());
+        CATCH_CHECK(span_reader.fully_consumed());
+    }
+
+    CATCH_SECTION("Peeking bits does not discard bits")
+    {
+        write_fields(4, 12);
+        fly::BitSpanReader stream(bytes());
+
+        fly::word_type word;
+
+        CATCH_CHECK(stream.peek_bits(word, 12) == 12_u8);
+        CATCH_CHECK(word == expected_field(0, 12));
+        CATCH_CHECK(stream.remaining_bits() == 48);
+
+        stream.discard_bits(12);
+
+        CATCH_CHECK(stream.peek_bits(word, 12) == 12_u8);
+        CATCH_CHECK(word == expected_field(1, 12));
+        CATCH_CHECK(stream.remaining_bits() == 36);
+    }
+
+    CATCH_SECTION("Try to read more bits than are available")
+    {
+        {
+            fly::BitStreamWriter stream(output_stream);
+            stream.write_bits(0x5_u8, 3);
+            CATCH_REQUIRE(stream.finish());
+        }
+
+        contents = output_stream.str();
+        fly::BitSpanReader stream(bytes());
+
+        // As with stream readers, the available bits fill the most-significant requested bits.
+        fly::byte_type byte;
+        CATCH_CHECK(stream.read_bits(byte, 8) == 3_u8);
+        CATCH_CHECK(byte == (0x5_u8 << 5));
+
+        std::uint64_t buffer;
+        CATCH_CHECK(stream.read_bits(buffer, 64) == 0_u8);
+        CATCH_CHECK(buffer == 0);
+    }
+
+    CATCH_SECTION("Bulk reads of fields of every width read every field")
+    {
+        // Enough fields that some are read after the last 8 bytes of the span are reached.
+        static constexpr std::size_t s_count = 100;
+
+        for (fly::byte_type size = 1; size <= 64; ++size)
+        {
+            CATCH_CAPTURE(size);
+
+            output_stream.str({});
+            write_fields(s_count, size);
+
+            fly::BitSpanReader stream(bytes());
+            std::vector<std::uint64_t> values(s_count);
+
+            CATCH_CHECK(stream.read_bits(std::span<std::uint64_t>(values), size) == s_count);
+            CATCH_CHECK(stream.fully_consumed());
+
+            for (std::size_t i = 0; i < s_count; ++i)
+            {
+                CATCH_CHECK(values[i] == expected_field(i, size));
+            }
+        }
+    }
+
+    CATCH_SECTION("Bulk reads of 32-bit fields of every width starting at every bit position")
+    {
+        // Enough fields that some are read with SIMD instructions, where supported.
+        static constexpr std::size_t s_count = 100;
+
+        for (fly::byte_type size = 1; size <= 32; ++size)
+        {
+            for (fly::byte_type offset = 0; offset < 8; ++offset)
+            {
+                CATCH_CAPTURE(size, offset);
+
+                output_stream.str({});
+                {
+                    fly::BitStreamWriter stream(output_stream);
+
+                    if (offset > 0)
+                    {
+                        stream.write_bits(static_cast<std::uint8_t>((1U << offset) - 1), offset);
+                    }
+
+                    for (std::size_t i = 0; i < s_count; ++i)
+                    {
+                        stream.write_bits(expected_field(i, size), size);
+                    }
+
+                    CATCH_REQUIRE(stream.finish());
+                    contents = output_stream.str();
+                }
+
+                fly::BitSpanReader stream(bytes());
+                std::vector<std::uint32_t> values(s_count);
+
+                std::uint8_t prefix = 0;
+                CATCH_CHECK(stream.read_bits(prefix, offset) == offset);
+                CATCH_CHECK(stream.read_bits(std::span<std::uint32_t>(values), size) == s_count);
+                CATCH_CHECK(stream.fully_consumed());
+
+                for (std::size_t i = 0; i < s_count; ++i)
+                {
+                    CATCH_CHECK(values[i] == expected_field(i, size));
+                }
+            }
+        }
+    }
+
+    CATCH_SECTION("Bulk reads only read fields which are entirely available")
+    {
+        write_fields(10, 7);
+        fly::BitSpanReader stream(bytes());
+
+        std::array<std::uint8_t, 4> values {};
+
+        CATCH_CHECK(stream.read_bits(std::span<std::uint8_t>(values), 7) == 4);
+        CATCH_CHECK(stream.read_bits(std::span<std::uint8_t>(values), 7) == 4);
+
+        CATCH_CHECK(values[0] == expected_field(4, 7));
+        CATCH_CHECK(values[3] == expected_field(7, 7));
+
+        CATCH_CHECK(stream.read_bits(std::span<std::uint8_t>(values), 7) == 2);
+        CATCH_CHECK(values[1] == expected_field(9, 7));
+        CATCH_CHECK(stream.fully_consumed());
+
+        CATCH_CHECK(stream.read_bits(std::span<std::uint8_t>(values), 7) == 0);
+    }
+
+    CATCH_SECTION("Bulk reads of zero-width fields read zeroes")
+    {
+        write_fields(1, 8);
+        fly::BitSpanReader stream(bytes());
+
+        std::array<std::uint32_t, 4> values {1, 2, 3, 4};
+
+        CATCH_CHECK(stream.read_bits(std::span<std::uint32_t>(values), 0) == values.size());
+        CATCH_CHECK(values == std::array<std::uint32_t, 4> {});
+        CATCH_CHECK(stream.remaining_bits() == 8);
+    }
+
+    CATCH_SECTION("Bulk reads are limited to the width of the data type")
+    {
+        write_fields(2, 8);
+        fly::BitSpanReader stream(bytes());
+
+        std::array<std::uint8_t, 2> values {};
+
+        CATCH_CHECK(stream.read_bits(std::span<std::uint8_t>(values), 12) == values.size());
+        CATCH_CHECK(values[0] == expected_field(0, 8));
+        CATCH_CHECK(values[1] == expected_field(1, 8));
+    }
+}
@@ -5,8 +5,11 @@
 
 #include "catch2/catch_test_macros.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <sstream>
+#include <string>
 
 using namespace fly::literals::numeric_literals;
 
@@ -234,6 +237,40 @@ CATCH_TEST_CASE("BitStream", "[bit_stream]")
         }
     }
 
+    CATCH_SECTION("Write and read consecutive full byte buffers")
+    {
+        constexpr auto length = std::numeric_limits<fly::buffer_type>::digits;
+        {
+            fly::BitStreamWriter stream(output_stream);
+            stream.write_bits(0xae1ae1ae1ae1ae1a_u64, length);
+            stream.write_bits(0xbc9bc9bc9bc9bc9b_u64, length);
+            stream.write_bits(0x0123456789abcdef_u64, length);
+            CATCH_CHECK(stream.finish());
+        }
+
+        // A 1-byte header and 3 full internal byte buffers should have been written.
+        CATCH_CHECK(
+            output_stream.str().size() ==
+            1_u64 + ((length * 3) / std::numeric_limits<fly::byte_type>::digits));
+
+        input_stream.str(output_stream.str());
+        {
+            fly::BitStreamReader stream(input_stream);
+            fly::buffer_type buffer;
+
+            CATCH_CHECK(stream.read_bits(buffer, 64) == 64_u8);
+            CATCH_CHECK(buffer == 0xae1ae1ae1ae1ae1a_u64);
+
+            CATCH_CHECK(stream.read_bits(buffer, 64) == 64_u8);
+            CATCH_CHECK(buffer == 0xbc9bc9bc9bc9bc9b_u64);
+
+            CATCH_CHECK(stream.read_bits(buffer, 64) == 64_u8);
+            CATCH_CHECK(buffer == 0x0123456789abcdef_u64);
+
+            CATCH_CHECK(stream.fully_consumed());
+        }
+    }
+
     CATCH_SECTION("Write and read multiple byte buffers, reading in an order that splits a read")
     {
         constexpr auto length = std::numeric_limits<fly::buffer_type>::digits;
@@ -280,6 +317,164 @@ CATCH_TEST_CASE("BitStream", "[bit_stream]")
         }
     }
 
+    CATCH_SECTION("Write and read bits of varying sizes that leave every possible buffer position")
+    {
+        // Reading fields of 1 to 16 bits causes the internal byte buffer to be refilled from every
+        // possible position, including refills which read no bytes and refills of the full buffer.
+        constexpr std::uint16_t count = 1000;
+        {
+            fly::BitStreamWriter stream(output_stream);
+
+            for (std::uint16_t i = 0; i < count; ++i)
+            {
+                fly::byte_type const size = (i % 16) + 1;
+                stream.write_bits(static_cast<std::uint16_t>(i & ((1_u32 << size) - 1)), size);
+            }
+
+            CATCH_CHECK(stream.finish());
+        }
+
+        input_stream.str(output_stream.str());
+        {
+            fly::BitStreamReader stream(input_stream);
+            std::uint16_t bits;
+
+            for (std::uint16_t i = 0; i < count; ++i)
+            {
+                fly::byte_type const size = (i % 16) + 1;
+
+                CATCH_CHECK(stream.read_bits(bits, size) == size);
+                CATCH_CHECK(bits == (i & ((1_u32 << size) - 1)));
+            }
+
+            // No further reads should succeed.
+            CATCH_CHECK(stream.read_bits(bits, 1) == 0_u8);
+            CATCH_CHECK(stream.fully_consumed());
+        }
+    }
+
+    CATCH_SECTION("Writers backed by a block of bytes write the same stream as unbuffered writers")
+    {
+        constexpr std::uint16_t count = 1000;
+
+        auto write_fields = [](fly::BitStreamWriter &stream) {
+            for (std::uint16_t i = 0; i < count; ++i)
+            {
+                fly::byte_type const size = (i % 16) + 1;
+                stream.write_bits(static_cast<std::uint16_t>(i & ((1_u32 << size) - 1)), size);
+            }
+
+            // Leave a partial byte so that the header must be rewritten.
+            stream.write_bits(1_u8, 3);
+            return stream.finish();
+        };
+
+        {
+            fly::BitStreamWriter stream(output_stream);
+            CATCH_CHECK(write_fields(stream));
+        }
+
+        std::string const expected = output_stream.str();
+
+        for (std::size_t block_size : {8_zu, 24_zu, 100_zu, fly::detail::s_default_block_size})
+        {
+            CATCH_CAPTURE(block_size);
+
+            std::ostringstream block_stream(std::ios::out | std::ios::binary);
+            {
+                fly::BitStreamWriter stream(block_stream, block_size);
+                CATCH_CHECK(write_fields(stream));
+            }
+
+            CATCH_CHECK(block_stream.str() == expected);
+        }
+    }
+
+    CATCH_SECTION("Writers backed by a block of bytes only write full blocks before finishing")
+    {
+        constexpr std::size_t block_size = 64;
+
+        fly::BitStreamWriter stream(output_stream, block_size);
+
+        // The header and 7 flushed byte buffers fit within the block. The 8th byte buffer has been
+        // filled, but is not flushed until more bits are written.
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            stream.write_bits(0x0123456789abcdef_u64, 64);
+        }
+
+        CATCH_CHECK(output_stream.str().empty());
+
+        // Flushing the 8th byte buffer does not fit within the block, so the block is written.
+        stream.write_bits(0x0123456789abcdef_u64, 64);
+        CATCH_CHECK(output_stream.str().size() == 57_u64);
+
+        CATCH_CHECK(stream.finish());
+        CATCH_CHECK(output_stream.str().size() == 73_u64);
+        verify_header(0_u8);
+    }
+
+    CATCH_SECTION("Readers backed by a block of bytes read the same bits as unbuffered readers")
+    {
+        constexpr std::uint16_t count = 1000;
+        {
+            fly::BitStreamWriter stream(output_stream);
+
+            for (std::uint16_t i = 0; i < count; ++i)
+            {
+                fly::byte_type const size = (i % 16) + 1;
+                stream.write_bits(static_cast<std::uint16_t>(i & ((1_u32 << size) - 1)), size);
+            }
+
+            stream.write_bits(1_u8, 3);
+            CATCH_CHECK(stream.finish());
+        }
+
+        for (std::size_t block_size : {1_zu, 7_zu, 8_zu, 100_zu, fly::detail::s_default_block_size})
+        {
+            CATCH_CAPTURE(block_size);
+
+            std::istringstream block_stream(output_stream.str(), std::ios::in | std::ios::binary);
+            fly::BitStreamReader stream(block_stream, block_size);
+            std::uint16_t bits;
+
+            CATCH_CHECK(stream.header() == create_header(1_u8));
+
+            for (std::uint16_t i = 0; i < count; ++i)
+            {
+                fly::byte_type const size = (i % 16) + 1;
+
+                CATCH_CHECK(stream.read_bits(bits, size) == size);
+                CATCH_CHECK(bits == (i & ((1_u32 << size) - 1)));
+            }
+
+            CATCH_CHECK_FALSE(stream.fully_consumed());
+            CATCH_CHECK(stream.read_bits(bits, 3) == 3_u8);
+            CATCH_CHECK(bits == 1_u16);
+
+            // No further reads should succeed, as the zero-filled bits should have been discarded.
+            CATCH_CHECK(stream.read_bits(bits, 1) == 0_u8);
+            CATCH_CHECK(stream.fully_consumed());
+        }
+    }
+
+    CATCH_SECTION("Readers backed by a block of bytes detect empty and invalid streams")
+    {
+        fly::BitStreamReader empty(input_stream, fly::detail::s_default_block_size);
+        fly::byte_type byte;
+
+        CATCH_CHECK(empty.header() == 0);
+        CATCH_CHECK(empty.read_bits(byte, 1) == 0_u8);
+        CATCH_CHECK(input_stream.fail());
+
+        std::istringstream invalid_stream("\x01\x02", std::ios::in | std::ios::binary);
+        fly::BitStreamReader invalid(invalid_stream, fly::detail::s_default_block_size);
+
+        CATCH_CHECK(invalid.header() == 1_u8);
+        CATCH_CHECK(invalid_stream.fail());
+        CATCH_CHECK_FALSE(invalid.read_byte(byte));
+    }
+
     CATCH_SECTION("Verify peeking bits does not discard bits")
     {
         {
@@ -1,2 +1,4 @@
 SRC_$(d) := \
+    $(d)/bit_packing.cpp \
+    $(d)/bit_span_reader.cpp \
     $(d)/bit_stream.cpp
@@ -1,10 +1,14 @@
 SRC_$(d) := \
     $(d)/json.cpp \
     $(d)/json_accessors.cpp \
+    $(d)/json_binder.cpp \
+    $(d)/json_cbor.cpp \
     $(d)/json_concepts.cpp \
     $(d)/json_construction.cpp \
     $(d)/json_conversion.cpp \
     $(d)/json_exception.cpp \
     $(d)/json_iterator.cpp \
     $(d)/json_modifiers.cpp \
-    $(d)/json_reverse_iterator.cpp
+    $(d)/json_pointer.cpp \
+    $(d)/json_reverse_iterator.cpp \
+    $(d)/json_snapshot.cpp
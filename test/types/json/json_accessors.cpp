@@ -41,6 +41,42 @@ CATCH_JSON_TEST_CASE("JsonAccessors")
         }
     }
 
+    CATCH_SECTION("Access a JSON array's values via the exception-free accessor 'try_at'")
+    {
+        if constexpr (std::is_same_v<json_type, fly::json_array_type>)
+        {
+            CATCH_REQUIRE(json1.try_at(0) != nullptr);
+            CATCH_CHECK(*json1.try_at(0) == '7');
+            CATCH_CHECK(json1.try_at(0) == &json1.at(0));
+            CATCH_CHECK(json1.try_at(4) == nullptr);
+
+            CATCH_REQUIRE(json2.try_at(3) != nullptr);
+            CATCH_CHECK(*json2.try_at(3) == 10);
+            CATCH_CHECK(json2.try_at(4) == nullptr);
+        }
+        else
+        {
+            CATCH_CHECK(json1.try_at(0) == nullptr);
+            CATCH_CHECK(json2.try_at(0) == nullptr);
+        }
+    }
+
+    CATCH_SECTION("Access a JSON instance's storage via 'get_if'")
+    {
+        CATCH_REQUIRE(json1.get_if<json_type>() != nullptr);
+        CATCH_CHECK(*json1.get_if<json_type>() == *json2.get_if<json_type>());
+
+        if constexpr (std::is_same_v<json_type, fly::json_boolean_type>)
+        {
+            CATCH_CHECK(json1.get_if<fly::json_null_type>() == nullptr);
+        }
+        else
+        {
+            CATCH_CHECK(json1.get_if<fly::json_boolean_type>() == nullptr);
+            CATCH_CHECK(json2.get_if<fly::json_boolean_type>() == nullptr);
+        }
+    }
+
     CATCH_SECTION("Access a JSON array's values via the access operator")
     {
         if constexpr (fly::test::is_null_or_other_type_v<json_type, fly::json_array_type>)
@@ -291,6 +327,31 @@ CATCH_JSON_STRING_TEST_CASE("JsonAccessorsByString")
         }
     }
 
+    CATCH_SECTION("Access a JSON object's values via the exception-free accessor 'try_at'")
+    {
+        if constexpr (std::is_same_v<json_type, fly::json_object_type>)
+        {
+            CATCH_REQUIRE(json1.try_at(J_STR("a")) != nullptr);
+            CATCH_CHECK(*json1.try_at(J_STR("a")) == 1);
+            CATCH_CHECK(json1.try_at(J_STR("a")) == &json1.at(J_STR("a")));
+            CATCH_CHECK(json1.try_at(J_STR("c")) == nullptr);
+
+            CATCH_REQUIRE(json2.try_at(J_STR("b")) != nullptr);
+            CATCH_CHECK(*json2.try_at(J_STR("b")) == 2);
+            CATCH_CHECK(json2.try_at(J_STR("c")) == nullptr);
+
+            // Escaped keys are matched after unescaping, and invalid keys are never found.
+            CATCH_CHECK(json1.try_at(J_STR("\\u0061")) == &json1.at(J_STR("a")));
+            CATCH_CHECK(json1.try_at(J_STR("\\")) == nullptr);
+            CATCH_CHECK(json2.try_at(J_STR("\\u00")) == nullptr);
+        }
+        else
+        {
+            CATCH_CHECK(json1.try_at(J_STR("a")) == nullptr);
+            CATCH_CHECK(json2.try_at(J_STR("a")) == nullptr);
+        }
+    }
+
     CATCH_SECTION("Access a JSON object's values via the access operator")
     {
         if constexpr (fly::test::is_null_or_other_type_v<json_type, fly::json_object_type>)
@@ -0,0 +1,240 @@
+#include "fly/types/json/json_binder.hpp"
+
+#include "fly/types/json/json.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Address
+{
+    std::string street;
+    std::uint16_t number {0};
+
+    bool operator==(Address const &) const = default;
+};
+
+struct Person
+{
+    std::string name;
+    std::int32_t age {0};
+    double height {0.0};
+    bool employed {false};
+    std::vector<std::string> nicknames;
+    std::optional<Address> address;
+    std::vector<Address> previous_addresses;
+
+    bool operator==(Person const &) const = default;
+};
+
+struct Empty
+{
+    bool operator==(Empty const &) const = default;
+};
+
+} // namespace
+
+template <>
+struct fly::JsonFields<Address>
+{
+    static constexpr auto fields = std::make_tuple(
+        fly::json_field("street", &Address::street),
+        fly::json_field("number", &Address::number));
+};
+
+template <>
+struct fly::JsonFields<Person>
+{
+    static constexpr auto fields = std::make_tuple(
+        fly::json_field("name", &Person::name),
+        fly::json_field("age", &Person::age),
+        fly::json_field("height", &Person::height),
+        fly::json_field("employed", &Person::employed),
+        fly::json_field("nicknames", &Person::nicknames),
+        fly::json_field("address", &Person::address),
+        fly::json_field("previous_addresses", &Person::previous_addresses));
+};
+
+template <>
+struct fly::JsonFields<Empty>
+{
+    static constexpr auto fields = std::make_tuple();
+};
+
+CATCH_TEST_CASE("JsonBinder", "[json]")
+{
+    Person const person {
+        "John Doe",
+        26,
+        1.75,
+        true,
+        {"Johnny", "J\tD"},
+        Address {"Main St", 12},
+        {Address {"Elm St", 3}, Address {"\xf0\x9f\x8d\x95 St", 65535}},
+    };
+
+    CATCH_SECTION("Structures are decoded from JSON text")
+    {
+        std::string const contents = R"({
+            "name" : "John Doe",
+            "age" : 26,
+            "height" : 1.75,
+            "employed" : true,
+            "nicknames" : ["Johnny", "J\tD"],
+            "address" : {"street" : "Main St", "number" : 12},
+            "previous_addresses" : [
+                {"street" : "Elm St", "number" : 3},
+                {"number" : 65535, "street" : "🍕 St"}
+            ]
+        })";
+
+        auto const decoded = fly::JsonBinder::decode<Person>(contents);
+        CATCH_REQUIRE(decoded.has_value());
+        CATCH_CHECK(*decoded == person);
+    }
+
+    CATCH_SECTION("Structures are encoded to JSON text")
+    {
+        fly::json_string_type const encoded = fly::JsonBinder::encode(person);
+
+        auto const decoded = fly::JsonBinder::decode<Person>(encoded);
+        CATCH_REQUIRE(decoded.has_value());
+        CATCH_CHECK(*decoded == person);
+    }
+
+    CATCH_SECTION("Encoded JSON text is identical to serialized Json instances")
+    {
+        // Json objects are ordered by key, whereas encoded structures are ordered by field.
+        Address const address {"Main \"St\"\n", 12};
+        fly::Json const json = {{"number", 12}, {"street", "Main \\\"St\\\"\\n"}};
+
+        fly::json_string_type const encoded = fly::JsonBinder::encode(address);
+        CATCH_CHECK(encoded == R"({"street":"Main \"St\"\n","number":12})");
+        CATCH_CHECK(json.serialize() == R"({"number":12,"street":"Main \"St\"\n"})");
+
+        fly::Json const empty = fly::json_object_type();
+        CATCH_CHECK(fly::JsonBinder::encode(Empty {}) == empty.serialize());
+    }
+
+    CATCH_SECTION("Unbound keys are skipped and missing keys retain their default value")
+    {
+        std::string const contents = R"({
+            "unknown" : {"a" : [1, 2.5e3, "]}", {"b" : null}], "c" : false},
+            "name" : "Jane Doe",
+            "other" : [true, -1]
+        })";
+
+        auto const decoded = fly::JsonBinder::decode<Person>(contents);
+        CATCH_REQUIRE(decoded.has_value());
+
+        CATCH_CHECK(decoded->name == "Jane Doe");
+        CATCH_CHECK(decoded->age == 0);
+        CATCH_CHECK(decoded->nicknames.empty());
+        CATCH_CHECK_FALSE(decoded->address.has_value());
+    }
+
+    CATCH_SECTION("Null values reset optional members")
+    {
+        auto const decoded = fly::JsonBinder::decode<Person>(R"({"address" : null})");
+        CATCH_REQUIRE(decoded.has_value());
+        CATCH_CHECK_FALSE(decoded->address.has_value());
+
+        fly::json_string_type const encoded = fly::JsonBinder::encode(Person {});
+        CATCH_CHECK(encoded.find(R"("address":null)") != fly::json_string_type::npos);
+    }
+
+    CATCH_SECTION("Escaped keys are matched to their bound members")
+    {
+        auto const decoded = fly::JsonBinder::decode<Address>(R"({"str\u0065et" : "a"})");
+        CATCH_REQUIRE(decoded.has_value());
+        CATCH_CHECK(decoded->street == "a");
+    }
+
+    CATCH_SECTION("Integers must be in range of their bound members")
+    {
+        CATCH_CHECK(fly::JsonBinder::decode<Address>(R"({"number" : 65535})"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Address>(R"({"number" : 65536})"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Address>(R"({"number" : -1})"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Address>(R"({"number" : 1.5})"));
+
+        CATCH_CHECK(fly::JsonBinder::decode<Person>(R"({"age" : -2147483648})"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"age" : -2147483649})"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"age" : 99999999999999999999})"));
+    }
+
+    CATCH_SECTION("Floating-point values must be in range of their bound members")
+    {
+        CATCH_CHECK(fly::JsonBinder::decode<Person>(R"({"height" : 1e308})"));
+        CATCH_CHECK(fly::JsonBinder::decode<Person>(R"({"height" : -1e308})"));
+
+        if constexpr (sizeof(fly::json_floating_point_type) > sizeof(double))
+        {
+            CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"height" : 1e400})"));
+            CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"height" : -1e400})"));
+        }
+    }
+
+    CATCH_SECTION("Values must match the type of their bound members")
+    {
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"name" : 1})"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"age" : "1"})"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"height" : true})"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"employed" : 1})"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"nicknames" : "a"})"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"nicknames" : [1]})"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"address" : []})"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"name" : null})"));
+    }
+
+    CATCH_SECTION("Badly formed JSON text cannot be decoded")
+    {
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(""));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>("[]"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>("{"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>("{} {}"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"name" "a"})"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"name" : "a",})"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"name" : "a)"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>("{\"name\" : \"a\nb\"}"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"name" : "\x"})"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>("{\"name\" : \"\xff\"}"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"age" : 01})"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"height" : 1.})"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"height" : -})"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"other" : tru})"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"other" : [1,]})"));
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Person>(R"({"other" : {"a" 1}})"));
+    }
+
+    CATCH_SECTION("Deeply nested unbound values cannot be decoded")
+    {
+        std::string const nested = std::string(10'000, '[') + std::string(10'000, ']');
+        CATCH_CHECK_FALSE(fly::JsonBinder::decode<Empty>("{\"a\" : " + nested + "}"));
+
+        std::string const shallow = std::string(100, '[') + std::string(100, ']');
+        CATCH_CHECK(fly::JsonBinder::decode<Empty>("{\"a\" : " + shallow + "}"));
+    }
+
+    CATCH_SECTION("Floating-point values are encoded the same as Json instances")
+    {
+        for (double const value : {0.0, 1.75, -3.14159, 1.5e-7, 6.02e23})
+        {
+            Person decimals;
+            decimals.height = value;
+
+            fly::json_string_type const encoded = fly::JsonBinder::encode(decimals);
+            fly::json_string_type const expected = "\"height\":" + fly::Json(value).serialize();
+            CATCH_CHECK(encoded.find(expected) != fly::json_string_type::npos);
+
+            auto const decoded = fly::JsonBinder::decode<Person>(encoded);
+            CATCH_REQUIRE(decoded.has_value());
+            CATCH_CHECK(fly::Json(decoded->height) == fly::Json(value));
+        }
+    }
+}
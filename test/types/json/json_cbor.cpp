@@ -0,0 +1,382 @@
+#include "fly/types/json/json_cbor.hpp"
+
+#include "fly/types/json/json.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+std::string bytes(std::initializer_list<std::uint8_t> values)
+{
+    std::string result;
+
+    for (std::uint8_t const value : values)
+    {
+        result.push_back(static_cast<char>(value));
+    }
+
+    return result;
+}
+
+/**
+ * Visitor which records each visited string view and rebuilds a flat description of the document.
+ */
+class RecordingVisitor : public fly::JsonCbor::Visitor
+{
+public:
+    void on_null() override
+    {
+        m_events.push_back("null");
+    }
+
+    void on_boolean(fly::json_boolean_type value) override
+    {
+        m_events.push_back(value ? "true" : "false");
+    }
+
+    void on_signed_integer(fly::json_signed_integer_type value) override
+    {
+        m_events.push_back(std::to_string(value));
+    }
+
+    void on_unsigned_integer(fly::json_unsigned_integer_type value) override
+    {
+        m_events.push_back(std::to_string(value));
+    }
+
+    void on_floating_point(fly::json_floating_point_type value) override
+    {
+        m_events.push_back(std::to_string(static_cast<double>(value)));
+    }
+
+    void on_string(std::string_view value) override
+    {
+        m_views.push_back(value);
+        m_events.push_back(std::string(value));
+    }
+
+    void on_array_start(std::optional<std::size_t> size) override
+    {
+        m_events.push_back(size ? "[" + std::to_string(*size) : "[");
+    }
+
+    void on_array_end() override
+    {
+        m_events.push_back("]");
+    }
+
+    void on_object_start(std::optional<std::size_t> size) override
+    {
+        m_events.push_back(size ? "{" + std::to_string(*size) : "{");
+    }
+
+    void on_object_key(std::string_view key) override
+    {
+        m_views.push_back(key);
+        m_events.push_back(std::string(key) + ":");
+    }
+
+    void on_object_end() override
+    {
+        m_events.push_back("}");
+    }
+
+    std::vector<std::string> m_events;
+    std::vector<std::string_view> m_views;
+};
+
+} // namespace
+
+CATCH_TEST_CASE("JsonCbor", "[json]")
+{
+    auto round_trip = [](fly::Json const &json) {
+        std::optional<fly::Json> decoded = fly::JsonCbor::decode(fly::JsonCbor::encode(json));
+        CATCH_REQUIRE(decoded.has_value());
+
+        return *std::move(decoded);
+    };
+
+    CATCH_SECTION("Every JSON type can be round-tripped")
+    {
+        CATCH_CHECK(round_trip(nullptr) == nullptr);
+        CATCH_CHECK(round_trip(true) == true);
+        CATCH_CHECK(round_trip(false) == false);
+        CATCH_CHECK(round_trip(12) == 12);
+        CATCH_CHECK(round_trip(-12) == -12);
+        CATCH_CHECK(round_trip(3.25) == 3.25);
+        CATCH_CHECK(round_trip("") == "");
+        CATCH_CHECK(round_trip("abc \\u00f1 \xf0\x9f\x8d\x95") == "abc \\u00f1 \xf0\x9f\x8d\x95");
+        CATCH_CHECK(round_trip(fly::json_array_type()) == fly::json_array_type());
+        CATCH_CHECK(round_trip(fly::json_object_type()) == fly::json_object_type());
+
+        fly::Json const json = {
+            {"a", 1},
+            {"b", {true, nullptr, -2, 3.5, "c"}},
+            {"d", {{"e", {{"f", fly::json_array_type()}}}}},
+            {"g\\n", "h\\t"},
+        };
+
+        CATCH_CHECK(round_trip(json) == json);
+    }
+
+    CATCH_SECTION("Integers at the limits of their JSON types can be round-tripped")
+    {
+        auto const min_signed = std::numeric_limits<fly::json_signed_integer_type>::min();
+        auto const max_signed = std::numeric_limits<fly::json_signed_integer_type>::max();
+        auto const max_unsigned = std::numeric_limits<fly::json_unsigned_integer_type>::max();
+
+        CATCH_CHECK(round_trip(min_signed) == min_signed);
+        CATCH_CHECK(round_trip(max_signed) == max_signed);
+        CATCH_CHECK(round_trip(max_unsigned) == max_unsigned);
+
+        CATCH_CHECK(
+            fly::JsonCbor::encode(min_signed) ==
+            bytes({0x3b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff}));
+        CATCH_CHECK(
+            fly::JsonCbor::encode(max_unsigned) ==
+            bytes({0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff}));
+
+        // -2^64 is a valid CBOR integer, but cannot be represented by any JSON integer type.
+        CATCH_CHECK_FALSE(
+            fly::JsonCbor::decode(bytes({0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff})));
+        CATCH_CHECK_FALSE(
+            fly::JsonCbor::decode(bytes({0x3b, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00})));
+    }
+
+    CATCH_SECTION("Integers are encoded with the shortest argument")
+    {
+        CATCH_CHECK(fly::JsonCbor::encode(0) == bytes({0x00}));
+        CATCH_CHECK(fly::JsonCbor::encode(23) == bytes({0x17}));
+        CATCH_CHECK(fly::JsonCbor::encode(24) == bytes({0x18, 0x18}));
+        CATCH_CHECK(fly::JsonCbor::encode(255) == bytes({0x18, 0xff}));
+        CATCH_CHECK(fly::JsonCbor::encode(256) == bytes({0x19, 0x01, 0x00}));
+        CATCH_CHECK(fly::JsonCbor::encode(65536) == bytes({0x1a, 0x00, 0x01, 0x00, 0x00}));
+        CATCH_CHECK(
+            fly::JsonCbor::encode(4294967296) ==
+            bytes({0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00}));
+
+        CATCH_CHECK(fly::JsonCbor::encode(-1) == bytes({0x20}));
+        CATCH_CHECK(fly::JsonCbor::encode(-24) == bytes({0x37}));
+        CATCH_CHECK(fly::JsonCbor::encode(-25) == bytes({0x38, 0x18}));
+        CATCH_CHECK(fly::JsonCbor::encode(-1000) == bytes({0x39, 0x03, 0xe7}));
+    }
+
+    CATCH_SECTION("Other values are encoded per RFC 8949")
+    {
+        CATCH_CHECK(fly::JsonCbor::encode(nullptr) == bytes({0xf6}));
+        CATCH_CHECK(fly::JsonCbor::encode(false) == bytes({0xf4}));
+        CATCH_CHECK(fly::JsonCbor::encode(true) == bytes({0xf5}));
+        CATCH_CHECK(fly::JsonCbor::encode("a") == bytes({0x61, 0x61}));
+        CATCH_CHECK(fly::JsonCbor::encode({1, 2}) == bytes({0x82, 0x01, 0x02}));
+        CATCH_CHECK(fly::JsonCbor::encode({{"a", 1}}) == bytes({0xa1, 0x61, 0x61, 0x01}));
+    }
+
+    CATCH_SECTION("Floating-point values are encoded with single precision only if lossless")
+    {
+        CATCH_CHECK(fly::JsonCbor::encode(1.5) == bytes({0xfa, 0x3f, 0xc0, 0x00, 0x00}));
+        CATCH_CHECK(
+            fly::JsonCbor::encode(1.1) ==
+            bytes({0xfb, 0x3f, 0xf1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9a}));
+        CATCH_CHECK(
+            fly::JsonCbor::encode(1.0e300) ==
+            bytes({0xfb, 0x7e, 0x37, 0xe4, 0x3c, 0x88, 0x00, 0x75, 0x9c}));
+
+        CATCH_CHECK(round_trip(1.1) == 1.1);
+        CATCH_CHECK(round_trip(-1.0e300) == -1.0e300);
+    }
+
+    CATCH_SECTION("Half-precision floating-point values can be decoded")
+    {
+        CATCH_CHECK(fly::JsonCbor::decode(bytes({0xf9, 0x00, 0x00})) == 0.0);
+        CATCH_CHECK(fly::JsonCbor::decode(bytes({0xf9, 0x3c, 0x00})) == 1.0);
+        CATCH_CHECK(fly::JsonCbor::decode(bytes({0xf9, 0x3e, 0x00})) == 1.5);
+        CATCH_CHECK(fly::JsonCbor::decode(bytes({0xf9, 0x7b, 0xff})) == 65504.0);
+        CATCH_CHECK(fly::JsonCbor::decode(bytes({0xf9, 0xc4, 0x00})) == -4.0);
+        CATCH_CHECK(fly::JsonCbor::decode(bytes({0xf9, 0x00, 0x01})) == std::ldexp(1.0, -24));
+
+        auto infinity = fly::JsonCbor::decode(bytes({0xf9, 0x7c, 0x00}));
+        CATCH_REQUIRE(infinity.has_value());
+        CATCH_CHECK(std::isinf(static_cast<fly::json_floating_point_type>(*infinity)));
+
+        auto nan = fly::JsonCbor::decode(bytes({0xf9, 0x7e, 0x00}));
+        CATCH_REQUIRE(nan.has_value());
+        CATCH_CHECK(std::isnan(static_cast<fly::json_floating_point_type>(*nan)));
+    }
+
+    CATCH_SECTION("Indefinite-length data items can be decoded")
+    {
+        // (_ "strea", "ming")
+        CATCH_CHECK(
+            fly::JsonCbor::decode(
+                bytes({0x7f, 0x65, 's', 't', 'r', 'e', 'a', 0x64, 'm', 'i', 'n', 'g', 0xff})) ==
+            "streaming");
+
+        // [_ 1, [2, 3], [_ 4, 5]]
+        CATCH_CHECK(
+            fly::JsonCbor::decode(
+                bytes({0x9f, 0x01, 0x82, 0x02, 0x03, 0x9f, 0x04, 0x05, 0xff, 0xff})) ==
+            fly::Json {1, {2, 3}, {4, 5}});
+
+        // {_ "a": 1, (_ "b", "c"): [_ ]}
+        CATCH_CHECK(
+            fly::JsonCbor::decode(bytes(
+                {0xbf, 0x61, 'a', 0x01, 0x7f, 0x61, 'b', 0x61, 'c', 0xff, 0x9f, 0xff, 0xff})) ==
+            fly::Json {{"a", 1}, {"bc", fly::json_array_type()}});
+    }
+
+    CATCH_SECTION("Semantic tags and undefined values are ignored")
+    {
+        // 1(1363896240)
+        CATCH_CHECK(
+            fly::JsonCbor::decode(bytes({0xc1, 0x1a, 0x51, 0x4b, 0x67, 0xb0})) == 1363896240);
+
+        // 55799(32("a"))
+        CATCH_CHECK(
+            fly::JsonCbor::decode(bytes({0xd9, 0xd9, 0xf7, 0xd8, 0x20, 0x61, 'a'})) == "a");
+
+        CATCH_CHECK(fly::JsonCbor::decode(bytes({0xf7})) == nullptr);
+    }
+
+    CATCH_SECTION("Data items without a JSON representation cannot be decoded")
+    {
+        // Byte strings.
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(bytes({0x41, 0x00})));
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(bytes({0x5f, 0xff})));
+
+        // Non-text map keys.
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(bytes({0xa1, 0x01, 0x02})));
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(bytes({0xa1, 0xf6, 0x02})));
+
+        // Unassigned simple values.
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(bytes({0xf0})));
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(bytes({0xf8, 0xff})));
+    }
+
+    CATCH_SECTION("Malformed data items cannot be decoded")
+    {
+        // Empty input.
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(std::string_view()));
+
+        // Truncated arguments, strings, and containers.
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(bytes({0x19, 0x01})));
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(bytes({0x63, 'a', 'b'})));
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(bytes({0x82, 0x01})));
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(bytes({0x9f, 0x01})));
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(bytes({0xa1, 0x61, 'a'})));
+        CATCH_CHECK_FALSE(
+            fly::JsonCbor::decode(bytes({0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff})));
+
+        // Reserved arguments.
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(bytes({0x1c})));
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(bytes({0x7e})));
+
+        // Indefinite-length integers and misplaced break codes.
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(bytes({0x1f})));
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(bytes({0xff})));
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(bytes({0x82, 0x01, 0xff})));
+
+        // Indefinite-length strings with chunks of another type.
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(bytes({0x7f, 0x01, 0xff})));
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(bytes({0x7f, 0x7f, 0xff, 0xff})));
+
+        // Invalid UTF-8.
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(bytes({0x61, 0xff})));
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(bytes({0x62, 0xc3, 0x28})));
+
+        // Trailing data.
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(bytes({0x01, 0x02})));
+    }
+
+    CATCH_SECTION("Deeply nested data items cannot be decoded")
+    {
+        std::string const nested_arrays(100'000, static_cast<char>(0x81));
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(nested_arrays + bytes({0x01})));
+
+        std::string const nested_tags(100'000, static_cast<char>(0xc1));
+        CATCH_CHECK_FALSE(fly::JsonCbor::decode(nested_tags + bytes({0x01})));
+
+        std::string const shallow_arrays(100, static_cast<char>(0x81));
+        CATCH_CHECK(fly::JsonCbor::decode(shallow_arrays + bytes({0x01})));
+    }
+
+    CATCH_SECTION("JSON can be encoded onto and decoded from streams")
+    {
+        fly::Json json = fly::json_array_type();
+
+        for (std::size_t i = 0; i < 10'000; ++i)
+        {
+            json.push_back({{"index", i}, {"name", std::string(i % 64, 'a')}});
+        }
+
+        std::stringstream stream;
+        CATCH_REQUIRE(fly::JsonCbor::encode(json, stream));
+        CATCH_CHECK(stream.str() == fly::JsonCbor::encode(json));
+
+        std::optional<fly::Json> decoded = fly::JsonCbor::decode(stream);
+        CATCH_REQUIRE(decoded.has_value());
+        CATCH_CHECK(*decoded == json);
+    }
+
+    CATCH_SECTION("Visitors receive strings without copying them")
+    {
+        fly::Json const json = {{"key", {"value", 1, -1, true, nullptr}}};
+        std::string const encoded = fly::JsonCbor::encode(json);
+
+        RecordingVisitor visitor;
+        CATCH_REQUIRE(fly::JsonCbor::visit(encoded, visitor));
+
+        std::vector<std::string> const expected {
+            "{1",
+            "key:",
+            "[5",
+            "value",
+            "1",
+            "-1",
+            "true",
+            "null",
+            "]",
+            "}",
+        };
+
+        CATCH_CHECK(visitor.m_events == expected);
+        CATCH_REQUIRE(visitor.m_views.size() == 2);
+
+        for (std::string_view const view : visitor.m_views)
+        {
+            CATCH_CHECK(view.data() >= encoded.data());
+            CATCH_CHECK((view.data() + view.size()) <= (encoded.data() + encoded.size()));
+        }
+    }
+
+    CATCH_SECTION("Visitors receive indefinite-length data items")
+    {
+        // {_ (_ "a", "b"): [_ 1.5]}
+        std::string const encoded =
+            bytes({0xbf, 0x7f, 0x61, 'a', 0x61, 'b', 0xff, 0x9f, 0xf9, 0x3e, 0x00, 0xff, 0xff});
+
+        RecordingVisitor visitor;
+        CATCH_REQUIRE(fly::JsonCbor::visit(encoded, visitor));
+
+        std::vector<std::string> const expected {"{", "ab:", "[", "1.500000", "]", "}"};
+        CATCH_CHECK(visitor.m_events == expected);
+    }
+
+    CATCH_SECTION("Visitors are not given malformed data items")
+    {
+        RecordingVisitor visitor;
+
+        CATCH_CHECK_FALSE(fly::JsonCbor::visit(bytes({0x41, 0x00}), visitor));
+        CATCH_CHECK_FALSE(fly::JsonCbor::visit(bytes({0x82, 0x01}), visitor));
+        CATCH_CHECK_FALSE(fly::JsonCbor::visit(bytes({0x01, 0x02}), visitor));
+    }
+}
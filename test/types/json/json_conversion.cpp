@@ -7,6 +7,7 @@
 #include "catch2/catch_test_macros.hpp"
 
 #include <array>
+#include <cstddef>
 
 CATCH_JSON_STRING_TEST_CASE("JsonConversion")
 {
@@ -226,6 +227,157 @@ CATCH_JSON_STRING_TEST_CASE("JsonConversion")
     }
 }
 
+CATCH_JSON_STRING_TEST_CASE("JsonTryConversion")
+{
+    using json_type = typename TestType::first_type;
+    using string_type = typename TestType::second_type;
+    using char_type = typename string_type::value_type;
+
+    fly::Json json = fly::test::create_json<json_type, string_type>();
+    fly::Json empty = json_type();
+
+    CATCH_SECTION("Try to convert a JSON instance to itself")
+    {
+        CATCH_CHECK(json.try_as<fly::Json>() == json);
+        CATCH_CHECK(empty.try_as<fly::Json>() == empty);
+    }
+
+    CATCH_SECTION("Try to convert a JSON instance to string-like types")
+    {
+        if constexpr (std::is_same_v<json_type, fly::json_string_type>)
+        {
+            CATCH_CHECK(json.try_as<string_type>() == J_STR("abcdef"));
+            CATCH_CHECK(empty.try_as<string_type>() == J_STR(""));
+        }
+        else if constexpr (fly::JsonNumber<json_type>)
+        {
+            CATCH_CHECK(json.try_as<string_type>() == J_STR("1"));
+            CATCH_CHECK(empty.try_as<string_type>() == J_STR("0"));
+        }
+        else
+        {
+            CATCH_CHECK_FALSE(json.try_as<string_type>());
+        }
+    }
+
+    CATCH_SECTION("Try to convert a JSON instance to object-like types")
+    {
+        auto validate = [&json]<typename T1, typename T2, typename T3>(char const *name) {
+            CATCH_CAPTURE(name);
+
+            auto test1 = T1 {{J_STR("a"), 2}, {J_STR("b"), 4}};
+            auto test2 = T2 {{J_STR("a"), "2"}, {J_STR("b"), "4"}};
+            auto test3 = T3 {{J_STR("a"), 2}, {J_STR("b"), "4"}};
+
+            json = test3;
+            CATCH_CHECK(json.try_as<T1>() == test1);
+            CATCH_CHECK(json.try_as<T2>() == test2);
+            CATCH_CHECK(json.try_as<T3>() == test3);
+
+            json = {{"a", true}};
+            CATCH_CHECK_FALSE(json.try_as<T1>());
+
+            json = {{"a", J_STR("string")}};
+            CATCH_CHECK_FALSE(json.try_as<T1>());
+        };
+
+        auto invalidate = [&json]<typename T>(char const *name) {
+            CATCH_CAPTURE(name);
+            CATCH_CHECK_FALSE(json.try_as<T>());
+        };
+
+        fly::test::run_test_for_object_types<json_type, string_type>(
+            std::move(validate),
+            std::move(invalidate));
+    }
+
+    CATCH_SECTION("Try to convert a JSON instance to array-like types")
+    {
+        auto validate = [&json]<typename T1, typename T2, typename T3>(char const *name) {
+            CATCH_CAPTURE(name);
+
+            auto test1 = T1 {50, 60, 70, 80};
+            auto test2 = T2 {J_STR("50"), J_STR("60"), J_STR("70"), J_STR("80")};
+            auto test3 = T3 {50, J_STR("60"), 70, J_STR("80")};
+
+            json = test3;
+            CATCH_CHECK(json.try_as<T1>() == test1);
+            CATCH_CHECK(json.try_as<T2>() == test2);
+            CATCH_CHECK(json.try_as<T3>() == test3);
+
+            json = {true};
+            CATCH_CHECK_FALSE(json.try_as<std::array<int, 1>>());
+
+            json = {J_STR("string")};
+            CATCH_CHECK_FALSE(json.try_as<std::array<int, 1>>());
+        };
+
+        auto invalidate = [&json]<typename T>(char const *name) {
+            CATCH_CAPTURE(name);
+            CATCH_CHECK_FALSE(json.try_as<T>());
+        };
+
+        fly::test::run_test_for_array_types<json_type, string_type>(
+            std::move(validate),
+            std::move(invalidate));
+
+        // Extra test to ensure std::array lengths are accounted for.
+        if constexpr (std::is_same_v<json_type, fly::json_array_type>)
+        {
+            std::array<int, 1> array1 = {7};
+            std::array<int, 3> array3 = {7, 8, 0};
+            json = std::array<int, 2> {7, 8};
+
+            CATCH_CHECK(json.try_as<decltype(array1)>() == array1);
+            CATCH_CHECK(json.try_as<decltype(array3)>() == array3);
+        }
+    }
+
+    CATCH_SECTION("Try to convert a JSON instance to Boolean-like types")
+    {
+        CATCH_CHECK(json.try_as<bool>() == bool(json));
+        CATCH_CHECK(empty.try_as<bool>() == false);
+    }
+
+    CATCH_SECTION("Try to convert a JSON instance to numeric types")
+    {
+        if constexpr (fly::JsonNumber<json_type>)
+        {
+            CATCH_CHECK(json.try_as<int>() == 1);
+            CATCH_CHECK(json.try_as<unsigned>() == unsigned(1));
+            CATCH_CHECK(json.try_as<double>() == Catch::Approx(double(1)));
+        }
+        else
+        {
+            CATCH_CHECK_FALSE(json.try_as<int>());
+            CATCH_CHECK_FALSE(json.try_as<unsigned>());
+            CATCH_CHECK_FALSE(json.try_as<double>());
+
+            if constexpr (std::is_same_v<json_type, fly::json_string_type>)
+            {
+                json = J_STR("-123");
+                CATCH_CHECK(json.try_as<int>() == -123);
+                CATCH_CHECK_FALSE(json.try_as<unsigned>());
+
+                json = J_STR("123.5");
+                CATCH_CHECK(json.try_as<double>() == Catch::Approx(123.5));
+            }
+        }
+    }
+
+    CATCH_SECTION("Try to convert a JSON instance to null-like types")
+    {
+        if constexpr (std::is_same_v<json_type, fly::json_null_type>)
+        {
+            CATCH_CHECK(json.try_as<std::nullptr_t>() == nullptr);
+        }
+        else
+        {
+            CATCH_CHECK_FALSE(json.try_as<std::nullptr_t>());
+        }
+    }
+}
+
 CATCH_JSON_TEST_CASE("JsonMoveConversion")
 {
     using json_type = TestType;
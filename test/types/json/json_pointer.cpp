@@ -0,0 +1,179 @@
+#include "fly/types/json/json_pointer.hpp"
+
+#include "fly/types/json/json.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <optional>
+#include <string_view>
+
+CATCH_TEST_CASE("JsonPointer", "[json]")
+{
+    // The example document from RFC 6901.
+    fly::Json const rfc = {
+        {"foo", {"bar", "baz"}},
+        {"", 0},
+        {"a/b", 1},
+        {"c%d", 2},
+        {"e^f", 3},
+        {"g|h", 4},
+        {"i\\\\j", 5},
+        {"k\\\"l", 6},
+        {" ", 7},
+        {"m~n", 8},
+    };
+
+    fly::Json const store = {
+        {"store",
+         {{"book",
+           {
+               {{"title", "Sayings of the Century"}, {"price", 8.95}},
+               {{"title", "Sword of Honour"}, {"price", 12.99}},
+           }},
+          {"bicycle", {{"color", "red"}, {"price", 19.95}}}}},
+        {"a.b", {{"c]d", "e"}}},
+    };
+
+    auto find_pointer = [](fly::Json const &json, std::string_view pointer) -> fly::Json const * {
+        std::optional<fly::JsonPointer> compiled = fly::JsonPointer::from_string(pointer);
+        CATCH_REQUIRE(compiled.has_value());
+
+        return compiled->find(json);
+    };
+
+    auto find_path = [](fly::Json const &json, std::string_view path) -> fly::Json const * {
+        std::optional<fly::JsonPointer> compiled = fly::JsonPointer::from_path(path);
+        CATCH_REQUIRE(compiled.has_value());
+
+        return compiled->find(json);
+    };
+
+    CATCH_SECTION("JSON Pointers from RFC 6901 are evaluated")
+    {
+        CATCH_CHECK(find_pointer(rfc, "") == &rfc);
+        CATCH_CHECK(*find_pointer(rfc, "/foo") == fly::Json {"bar", "baz"});
+        CATCH_CHECK(*find_pointer(rfc, "/foo/0") == "bar");
+        CATCH_CHECK(*find_pointer(rfc, "/") == 0);
+        CATCH_CHECK(*find_pointer(rfc, "/a~1b") == 1);
+        CATCH_CHECK(*find_pointer(rfc, "/c%d") == 2);
+        CATCH_CHECK(*find_pointer(rfc, "/e^f") == 3);
+        CATCH_CHECK(*find_pointer(rfc, "/g|h") == 4);
+        CATCH_CHECK(*find_pointer(rfc, "/i\\j") == 5);
+        CATCH_CHECK(*find_pointer(rfc, "/k\"l") == 6);
+        CATCH_CHECK(*find_pointer(rfc, "/ ") == 7);
+        CATCH_CHECK(*find_pointer(rfc, "/m~0n") == 8);
+    }
+
+    CATCH_SECTION("JSON Pointers to missing values are not found")
+    {
+        CATCH_CHECK(find_pointer(rfc, "/bar") == nullptr);
+        CATCH_CHECK(find_pointer(rfc, "/foo/2") == nullptr);
+        CATCH_CHECK(find_pointer(rfc, "/foo/-") == nullptr);
+        CATCH_CHECK(find_pointer(rfc, "/foo/01") == nullptr);
+        CATCH_CHECK(find_pointer(rfc, "/foo/0/0") == nullptr);
+        CATCH_CHECK(find_pointer(rfc, "/a/b") == nullptr);
+        CATCH_CHECK(find_pointer(rfc, "/foo/99999999999999999999999999") == nullptr);
+    }
+
+    CATCH_SECTION("Numeric reference tokens are used as object keys")
+    {
+        fly::Json const json = {{"0", "zero"}, {"01", "one"}};
+
+        CATCH_CHECK(*find_pointer(json, "/0") == "zero");
+        CATCH_CHECK(*find_pointer(json, "/01") == "one");
+    }
+
+    CATCH_SECTION("Invalid JSON Pointers cannot be compiled")
+    {
+        CATCH_CHECK_FALSE(fly::JsonPointer::from_string("foo"));
+        CATCH_CHECK_FALSE(fly::JsonPointer::from_string("/foo~"));
+        CATCH_CHECK_FALSE(fly::JsonPointer::from_string("/foo~2"));
+        CATCH_CHECK_FALSE(fly::JsonPointer::from_string("/~a/b"));
+    }
+
+    CATCH_SECTION("JSONPath expressions are evaluated")
+    {
+        CATCH_CHECK(find_path(store, "$") == &store);
+        CATCH_CHECK(*find_path(store, "$.store.bicycle.color") == "red");
+        CATCH_CHECK(*find_path(store, "$.store.book[0].title") == "Sayings of the Century");
+        CATCH_CHECK(*find_path(store, "$['store']['book'][1]['price']") == 12.99);
+        CATCH_CHECK(*find_path(store, "$[\"store\"].book[1].title") == "Sword of Honour");
+        CATCH_CHECK(*find_path(store, "$['a.b']['c]d']") == "e");
+        CATCH_CHECK(*find_path(rfc, "$['k\\\"l']") == 6);
+        CATCH_CHECK(*find_path(rfc, "$['i\\\\j']") == 5);
+        CATCH_CHECK(*find_path(rfc, "$['']") == 0);
+    }
+
+    CATCH_SECTION("JSONPath steps only apply to their JSON type")
+    {
+        fly::Json const json = {{"0", "zero"}, {"list", {"a", "b"}}};
+
+        CATCH_CHECK(*find_path(json, "$['0']") == "zero");
+        CATCH_CHECK(find_path(json, "$[0]") == nullptr);
+        CATCH_CHECK(*find_path(json, "$.list[1]") == "b");
+        CATCH_CHECK(find_path(json, "$.list['1']") == nullptr);
+        CATCH_CHECK(find_path(json, "$.list[2]") == nullptr);
+        CATCH_CHECK(find_path(json, "$.list.a") == nullptr);
+    }
+
+    CATCH_SECTION("Invalid JSONPath expressions cannot be compiled")
+    {
+        CATCH_CHECK_FALSE(fly::JsonPointer::from_path(""));
+        CATCH_CHECK_FALSE(fly::JsonPointer::from_path("store"));
+        CATCH_CHECK_FALSE(fly::JsonPointer::from_path("$."));
+        CATCH_CHECK_FALSE(fly::JsonPointer::from_path("$..store"));
+        CATCH_CHECK_FALSE(fly::JsonPointer::from_path("$store"));
+        CATCH_CHECK_FALSE(fly::JsonPointer::from_path("$["));
+        CATCH_CHECK_FALSE(fly::JsonPointer::from_path("$[]"));
+        CATCH_CHECK_FALSE(fly::JsonPointer::from_path("$[0"));
+        CATCH_CHECK_FALSE(fly::JsonPointer::from_path("$[-1]"));
+        CATCH_CHECK_FALSE(fly::JsonPointer::from_path("$[01]"));
+        CATCH_CHECK_FALSE(fly::JsonPointer::from_path("$[*]"));
+        CATCH_CHECK_FALSE(fly::JsonPointer::from_path("$['a'"));
+        CATCH_CHECK_FALSE(fly::JsonPointer::from_path("$['a]"));
+        CATCH_CHECK_FALSE(fly::JsonPointer::from_path("$['a'x]"));
+    }
+
+    CATCH_SECTION("Compiled paths may be evaluated against many documents")
+    {
+        auto const pointer = fly::JsonPointer::from_string("/a/1");
+        CATCH_REQUIRE(pointer.has_value());
+
+        for (int i = 0; i < 10; ++i)
+        {
+            fly::Json const json = {{"a", {i, i * 2}}};
+            CATCH_CHECK(*pointer->find(json) == i * 2);
+        }
+    }
+
+    CATCH_SECTION("Found values may be modified")
+    {
+        fly::Json json = store;
+
+        auto const path = fly::JsonPointer::from_path("$.store.bicycle.color");
+        CATCH_REQUIRE(path.has_value());
+
+        fly::Json *color = path->find(json);
+        CATCH_REQUIRE(color != nullptr);
+
+        *color = "blue";
+        CATCH_CHECK(json["store"]["bicycle"]["color"] == "blue");
+        CATCH_CHECK(path->contains(json));
+    }
+
+    CATCH_SECTION("Compiled paths are serialized as JSON Pointers")
+    {
+        auto pointer = fly::JsonPointer::from_string("/a~1b/m~0n/0");
+        CATCH_REQUIRE(pointer.has_value());
+        CATCH_CHECK(pointer->size() == 3);
+        CATCH_CHECK(pointer->to_string() == "/a~1b/m~0n/0");
+
+        auto path = fly::JsonPointer::from_path("$.store['a/b'][3]");
+        CATCH_REQUIRE(path.has_value());
+        CATCH_CHECK(path->size() == 3);
+        CATCH_CHECK(path->to_string() == "/store/a~1b/3");
+
+        CATCH_CHECK(fly::JsonPointer().empty());
+        CATCH_CHECK(fly::JsonPointer().to_string().empty());
+    }
+}
@@ -0,0 +1,83 @@
+#include "fly/types/json/json_snapshot.hpp"
+
+#include "fly/types/json/json.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+CATCH_TEST_CASE("JsonSnapshot", "[json]")
+{
+    fly::Json const json = {{"a", {{"b", {1, 2, 3}}}}, {"c", "d"}};
+
+    CATCH_SECTION("Default snapshots hold a null value")
+    {
+        fly::JsonSnapshot snapshot;
+        CATCH_CHECK(snapshot->is_null());
+    }
+
+    CATCH_SECTION("Copies of a snapshot share the same value")
+    {
+        fly::JsonSnapshot snapshot(json);
+        CATCH_CHECK(*snapshot == json);
+
+        fly::JsonSnapshot copy = snapshot;
+        CATCH_CHECK(&copy.get() == &snapshot.get());
+    }
+
+    CATCH_SECTION("Snapshots of nested values share ownership of their parent")
+    {
+        fly::JsonSnapshot child;
+        fly::Json const *address = nullptr;
+        {
+            fly::JsonSnapshot snapshot(json);
+            address = &snapshot->at("a").at("b");
+
+            child = snapshot.child("a").child("b");
+        }
+
+        CATCH_CHECK(&child.get() == address);
+        CATCH_CHECK(*child == fly::Json {1, 2, 3});
+    }
+
+    CATCH_SECTION("Snapshots of missing values hold a null value")
+    {
+        fly::JsonSnapshot snapshot(json);
+
+        CATCH_CHECK(snapshot.child("e")->is_null());
+        CATCH_CHECK(snapshot.child("c").child("d")->is_null());
+        CATCH_CHECK(fly::JsonSnapshot().child("a")->is_null());
+    }
+
+    CATCH_SECTION("Snapshots may be read concurrently")
+    {
+        fly::JsonSnapshot snapshot(json);
+        std::atomic<std::size_t> matches {0};
+
+        std::vector<std::thread> threads;
+
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            threads.emplace_back([snapshot, &json, &matches]() {
+                for (std::size_t j = 0; j < 1000; ++j)
+                {
+                    fly::JsonSnapshot const copy = snapshot.child("a");
+
+                    if (*copy == json["a"])
+                    {
+                        ++matches;
+                    }
+                }
+            });
+        }
+
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+
+        CATCH_CHECK(matches == 4000);
+    }
+}